@@ -22,10 +22,81 @@ void FPYRichTextSyntaxHighlighterTextLayoutMarshaller::SetText(const FString& So
 	{
 		TArray<FPythonSyntaxTokenizer::FTokenizedLine> TokenizedLines;
 		Tokenizer->Process(TokenizedLines, SourceString);
-		ParseTokens(SourceString, TargetTextLayout, TokenizedLines);
+
+		// the lines before and after the edited ones are unchanged
+		const int32 NumLines = TokenizedLines.Num();
+		const int32 NumOldLines = StyledLines.Num();
+		const int32 MaxCommon = FMath::Min(NumLines, NumOldLines);
+		int32 NumPrefix = 0;
+		while (NumPrefix < MaxCommon && StyledLines[NumPrefix].Text.Equals(TokenizedLines[NumPrefix].Text, ESearchCase::CaseSensitive))
+		{
+			NumPrefix++;
+		}
+		int32 NumSuffix = 0;
+		while (NumSuffix < MaxCommon - NumPrefix && StyledLines[NumOldLines - 1 - NumSuffix].Text.Equals(TokenizedLines[NumLines - 1 - NumSuffix].Text, ESearchCase::CaseSensitive))
+		{
+			NumSuffix++;
+		}
+
+		TArray<FStyledLine> NewStyledLines;
+		NewStyledLines.SetNum(NumLines);
+		for (int32 LineIndex = 0; LineIndex < NumPrefix; LineIndex++)
+		{
+			NewStyledLines[LineIndex] = MoveTemp(StyledLines[LineIndex]);
+		}
+		for (int32 LineIndex = NumLines - NumSuffix; LineIndex < NumLines; LineIndex++)
+		{
+			NewStyledLines[LineIndex] = MoveTemp(StyledLines[LineIndex - NumLines + NumOldLines]);
+		}
+
+		TArray<FTextLayout::FNewLineData> LinesToAdd;
+		LinesToAdd.Reserve(NumLines);
+
+		EParseState ParseState = EParseState::None;
+		for (int32 LineIndex = 0; LineIndex < NumLines; LineIndex++)
+		{
+			FPythonSyntaxTokenizer::FTokenizedLine& TokenizedLine = TokenizedLines[LineIndex];
+			FStyledLine& StyledLine = NewStyledLines[LineIndex];
+			const bool bUnchanged = LineIndex < NumPrefix || LineIndex >= NumLines - NumSuffix;
+			if (!bUnchanged || StyledLine.EntryState != ParseState)
+			{
+				StyledLine.Runs.Reset();
+				StyledLine.EntryState = ParseState;
+				StyledLine.ExitState = ParseLine(TokenizedLine, ParseState, StyledLine.Runs);
+				if (!bUnchanged)
+				{
+					StyledLine.Text = MoveTemp(TokenizedLine.Text);
+				}
+			}
+			ParseState = StyledLine.ExitState;
+
+			// the layout owns (and modifies while editing) the line strings and runs, so they are created for every call
+			TSharedRef<FString> ModelString = MakeShareable(new FString(StyledLine.Text));
+			TArray< TSharedRef< IRun > > Runs;
+			Runs.Reserve(StyledLine.Runs.Num());
+			for (const FStyledRun& StyledRun : StyledLine.Runs)
+			{
+				FRunInfo RunInfo(StyledRun.RunName);
+				if (StyledRun.Style == ERunStyle::WhiteSpace)
+				{
+					Runs.Add(FWhiteSpaceTextRun::Create(RunInfo, ModelString, SyntaxTextStyle.NormalTextStyle, StyledRun.Range, 4));
+				}
+				else
+				{
+					Runs.Add(FSlateTextRun::Create(RunInfo, ModelString, GetRunTextStyle(StyledRun.Style), StyledRun.Range));
+				}
+			}
+
+			LinesToAdd.Emplace(MoveTemp(ModelString), MoveTemp(Runs));
+		}
+
+		StyledLines = MoveTemp(NewStyledLines);
+
+		TargetTextLayout.AddLines(LinesToAdd);
 	}
 	else
 	{
+		StyledLines.Empty();
 		FPlainTextLayoutMarshaller::SetText(SourceString, TargetTextLayout);
 	}
 }
@@ -38,6 +109,8 @@ bool FPYRichTextSyntaxHighlighterTextLayoutMarshaller::RequiresLiveUpdate() cons
 void FPYRichTextSyntaxHighlighterTextLayoutMarshaller::EnableSyntaxHighlighting(const bool bEnable)
 {
 	bSyntaxHighlightingEnabled = bEnable;
+	Tokenizer->ResetCache();
+	StyledLines.Empty();
 	MakeDirty();
 }
 
@@ -267,188 +340,191 @@ TSharedRef< FPYRichTextSyntaxHighlighterTextLayoutMarshaller > FPYRichTextSyntax
 
 
 
-void FPYRichTextSyntaxHighlighterTextLayoutMarshaller::ParseTokens(const FString& SourceString, FTextLayout& TargetTextLayout, TArray<FPythonSyntaxTokenizer::FTokenizedLine> TokenizedLines)
+const FTextBlockStyle& FPYRichTextSyntaxHighlighterTextLayoutMarshaller::GetRunTextStyle(const ERunStyle Style) const
 {
-	enum class EParseState : uint8
+	switch (Style)
 	{
-		None,
-		LookingForString,
-		LookingForCharacter,
-		LookingForDefine,
-		LookingForSingleLineComment,
-		LookingForMultiLineString,
-	};
-
-	TArray<FTextLayout::FNewLineData> LinesToAdd;
-	LinesToAdd.Reserve(TokenizedLines.Num());
-
-	// Parse the tokens, generating the styled runs for each line
-	EParseState ParseState = EParseState::None;
-	for(const FPythonSyntaxTokenizer::FTokenizedLine& TokenizedLine : TokenizedLines)
+	case ERunStyle::Operator:
+		return SyntaxTextStyle.OperatorTextStyle;
+	case ERunStyle::Keyword:
+		return SyntaxTextStyle.KeywordTextStyle;
+	case ERunStyle::String:
+		return SyntaxTextStyle.StringTextStyle;
+	case ERunStyle::Comment:
+		return SyntaxTextStyle.CommentTextStyle;
+	case ERunStyle::BuiltIn:
+		return SyntaxTextStyle.BuiltInKeywordTextStyle;
+	case ERunStyle::Define:
+		return SyntaxTextStyle.DefineTextStyle;
+	default:
+		break;
+	}
+	return SyntaxTextStyle.NormalTextStyle;
+}
+
+static bool PythonTokenIs(const FString& LineText, const FTextRange& Range, const TCHAR* Match)
+{
+	return FCString::Strlen(Match) == Range.Len() && FCString::Strncmp(*LineText + Range.BeginIndex, Match, Range.Len()) == 0;
+}
+
+FPYRichTextSyntaxHighlighterTextLayoutMarshaller::EParseState FPYRichTextSyntaxHighlighterTextLayoutMarshaller::ParseLine(const FPythonSyntaxTokenizer::FTokenizedLine& TokenizedLine, EParseState ParseState, TArray<FStyledRun>& OutRuns) const
+{
+	const FString& LineText = TokenizedLine.Text;
+
+	if(ParseState == EParseState::LookingForSingleLineComment)
 	{
-		TSharedRef<FString> ModelString = MakeShareable(new FString());
-		TArray< TSharedRef< IRun > > Runs;
+		ParseState = EParseState::None;
+	}
 
-		if(ParseState == EParseState::LookingForSingleLineComment)
-		{
-			ParseState = EParseState::None;
+	OutRuns.Reserve(TokenizedLine.Tokens.Num());
+
+	for(const FPythonSyntaxTokenizer::FToken& Token : TokenizedLine.Tokens)
+	{
+		// token ranges are relative to the whole text, runs to their line
+		const FTextRange Range(Token.Range.BeginIndex - TokenizedLine.Range.BeginIndex, Token.Range.EndIndex - TokenizedLine.Range.BeginIndex);
+		bool hasNextChar = false;
+		if (Range.EndIndex < LineText.Len()) {
+			const TCHAR NextChar = LineText[Range.EndIndex];
+			if (TChar<WIDECHAR>::IsAlpha(NextChar) || NextChar==TEXT('_')) {
+				hasNextChar = true;
+			}
 		}
 
-		for(const FPythonSyntaxTokenizer::FToken& Token : TokenizedLine.Tokens)
+		const TCHAR* RunName = TEXT("SyntaxHighlight.PY.Normal");
+		ERunStyle RunStyle = ERunStyle::Normal;
+
+		bool bIsWhitespace = true;
+		for (int32 Index = Range.BeginIndex; Index < Range.EndIndex; Index++)
 		{
-			const FString TokenText = SourceString.Mid(Token.Range.BeginIndex, Token.Range.Len());
-			bool hasNextChar = false;
-			if (Token.Range.BeginIndex + Token.Range.Len() <= SourceString.Len()-1) {
-				const FString NextText = SourceString.Mid(Token.Range.BeginIndex + Token.Range.Len(), 1);
-				if (TChar<WIDECHAR>::IsAlpha(NextText[0]) || NextText[0]==TEXT('_')) {
-					hasNextChar = true;
-				}
+			if (!FChar::IsWhitespace(LineText[Index]))
+			{
+				bIsWhitespace = false;
+				break;
 			}
-			
-			const FTextRange ModelRange(ModelString->Len(), ModelString->Len() + TokenText.Len());
-			ModelString->Append(TokenText);
-
-			FRunInfo RunInfo(TEXT("SyntaxHighlight.PY.Normal"));
-			FTextBlockStyle TextBlockStyle = SyntaxTextStyle.NormalTextStyle;
-
-#if ENGINE_MAJOR_VERSION == 5 || (ENGINE_MAJOR_VERSION == 4 && ENGINE_MINOR_VERSION >= 18)
-			const bool bIsWhitespace = FString(TokenText).TrimEnd().IsEmpty();
-#else
-			const bool bIsWhitespace = FString(TokenText).TrimTrailing().IsEmpty();
-#endif
-			if(!bIsWhitespace)
+		}
+		if(!bIsWhitespace)
+		{
+			bool bHasMatchedSyntax = false;
+			if(Token.Type == FPythonSyntaxTokenizer::ETokenType::Syntax)
 			{
-				bool bHasMatchedSyntax = false;
-				if(Token.Type == FPythonSyntaxTokenizer::ETokenType::Syntax)
+				if (ParseState == EParseState::None && PythonTokenIs(LineText, Range, TEXT("\"\"\"")))
 				{
-					if (ParseState == EParseState::None && TokenText == TEXT("\"\"\""))
-					{
-						RunInfo.Name = TEXT("SyntaxHighlight.PY.String");
-						TextBlockStyle = SyntaxTextStyle.StringTextStyle;
-						ParseState = EParseState::LookingForMultiLineString;
-					}
-					else if (ParseState == EParseState::LookingForMultiLineString && TokenText == TEXT("\"\"\""))
-					{
-						RunInfo.Name = TEXT("SyntaxHighlight.PY.String");
-						TextBlockStyle = SyntaxTextStyle.StringTextStyle;
-						ParseState = EParseState::None;
-					}
-					else if(ParseState == EParseState::None && TokenText == TEXT("\""))
-					{
-						RunInfo.Name = TEXT("SyntaxHighlight.PY.String");
-						TextBlockStyle = SyntaxTextStyle.StringTextStyle;
-						ParseState = EParseState::LookingForString;
-						bHasMatchedSyntax = true;
-					}
-					else if(ParseState == EParseState::LookingForString && TokenText == TEXT("\""))
-					{
-						RunInfo.Name = TEXT("SyntaxHighlight.PY.Normal");
-						TextBlockStyle = SyntaxTextStyle.StringTextStyle;
-						ParseState = EParseState::None;
-					}
-					else if(ParseState == EParseState::None && TokenText == TEXT("\'"))
-					{
-						RunInfo.Name = TEXT("SyntaxHighlight.PY.String");
-						TextBlockStyle = SyntaxTextStyle.StringTextStyle;
-						ParseState = EParseState::LookingForCharacter;
+					RunName = TEXT("SyntaxHighlight.PY.String");
+					RunStyle = ERunStyle::String;
+					ParseState = EParseState::LookingForMultiLineString;
+				}
+				else if (ParseState == EParseState::LookingForMultiLineString && PythonTokenIs(LineText, Range, TEXT("\"\"\"")))
+				{
+					RunName = TEXT("SyntaxHighlight.PY.String");
+					RunStyle = ERunStyle::String;
+					ParseState = EParseState::None;
+				}
+				else if(ParseState == EParseState::None && PythonTokenIs(LineText, Range, TEXT("\"")))
+				{
+					RunName = TEXT("SyntaxHighlight.PY.String");
+					RunStyle = ERunStyle::String;
+					ParseState = EParseState::LookingForString;
+					bHasMatchedSyntax = true;
+				}
+				else if(ParseState == EParseState::LookingForString && PythonTokenIs(LineText, Range, TEXT("\"")))
+				{
+					RunName = TEXT("SyntaxHighlight.PY.Normal");
+					RunStyle = ERunStyle::String;
+					ParseState = EParseState::None;
+				}
+				else if(ParseState == EParseState::None && PythonTokenIs(LineText, Range, TEXT("\'")))
+				{
+					RunName = TEXT("SyntaxHighlight.PY.String");
+					RunStyle = ERunStyle::String;
+					ParseState = EParseState::LookingForCharacter;
+					bHasMatchedSyntax = true;
+				}
+				else if(ParseState == EParseState::LookingForCharacter && PythonTokenIs(LineText, Range, TEXT("\'")))
+				{
+					RunName = TEXT("SyntaxHighlight.PY.Normal");
+					RunStyle = ERunStyle::String;
+					ParseState = EParseState::None;
+				}
+				else if(ParseState == EParseState::None && PythonTokenIs(LineText, Range, TEXT("#")))
+				{
+					RunName = TEXT("SyntaxHighlight.PY.Comment");
+					RunStyle = ERunStyle::Comment;
+					ParseState = EParseState::LookingForSingleLineComment;
+				}
+				else if(ParseState == EParseState::None && !hasNextChar && Token.SyntaxType==FPythonSyntaxTokenizer::ESyntaxType::Keywords)
+				{
+					RunName = TEXT("SyntaxHighlight.PY.Keyword");
+					RunStyle = ERunStyle::Keyword;
+					ParseState = EParseState::None;
+				}
+				else if (ParseState == EParseState::None && !hasNextChar && Token.SyntaxType == FPythonSyntaxTokenizer::ESyntaxType::Function)
+				{
+					RunName = TEXT("SyntaxHighlight.PY.BuiltIn");
+					RunStyle = ERunStyle::BuiltIn;
+					ParseState = EParseState::None;
+					if (PythonTokenIs(LineText, Range, TEXT("def")) || PythonTokenIs(LineText, Range, TEXT("class"))) {
 						bHasMatchedSyntax = true;
+						ParseState = EParseState::LookingForDefine;
 					}
-					else if(ParseState == EParseState::LookingForCharacter && TokenText == TEXT("\'"))
-					{
-						RunInfo.Name = TEXT("SyntaxHighlight.PY.Normal");
-						TextBlockStyle = SyntaxTextStyle.StringTextStyle;
-						ParseState = EParseState::None;
-					}
-					//else if(ParseState == EParseState::None && TokenText.StartsWith(TEXT("#")))
-					//{
-					//	RunInfo.Name = TEXT("SyntaxHighlight.CPP.PreProcessorKeyword");
-					//	TextBlockStyle = SyntaxTextStyle.PreProcessorKeywordTextStyle;
-					//	ParseState = EParseState::None;
-					//}
-					else if(ParseState == EParseState::None && TokenText == TEXT("#"))
-					{
-						RunInfo.Name = TEXT("SyntaxHighlight.PY.Comment");
-						TextBlockStyle = SyntaxTextStyle.CommentTextStyle;
-						ParseState = EParseState::LookingForSingleLineComment;
-					}
-
-					else if(ParseState == EParseState::None && !hasNextChar && Token.SyntaxType==FPythonSyntaxTokenizer::ESyntaxType::Keywords)
-					{
-						RunInfo.Name = TEXT("SyntaxHighlight.PY.Keyword");
-						TextBlockStyle = SyntaxTextStyle.KeywordTextStyle;
-						ParseState = EParseState::None;
-					}
-					else if (ParseState == EParseState::None && !hasNextChar && Token.SyntaxType == FPythonSyntaxTokenizer::ESyntaxType::Function)
-					{
-						RunInfo.Name = TEXT("SyntaxHighlight.PY.BuiltIn");
-						TextBlockStyle = SyntaxTextStyle.BuiltInKeywordTextStyle;
-						ParseState = EParseState::None;
-						if (TokenText == TEXT("def") || TokenText == TEXT("class")) {
-							bHasMatchedSyntax = true;
-							ParseState = EParseState::LookingForDefine;
-						}
-					}
-					else if (ParseState == EParseState::LookingForDefine && Token.SyntaxType == FPythonSyntaxTokenizer::ESyntaxType::Terminals)
-					{
-						RunInfo.Name = TEXT("SyntaxHighlight.PY.Normal");
-						TextBlockStyle = SyntaxTextStyle.NormalTextStyle;
-						ParseState = EParseState::None;
-					}
-					else if (ParseState == EParseState::None && Token.SyntaxType == FPythonSyntaxTokenizer::ESyntaxType::Operators)
-					{
-						RunInfo.Name = TEXT("SyntaxHighlight.PY.Operator");
-						TextBlockStyle = SyntaxTextStyle.OperatorTextStyle;
-						ParseState = EParseState::None;
-					}
-
 				}
-				
-				// It's possible that we fail to match a syntax token if we're in a state where it isn't parsed
-				// In this case, we treat it as a literal token
-				if(Token.Type == FPythonSyntaxTokenizer::ETokenType::Literal || !bHasMatchedSyntax)
+				else if (ParseState == EParseState::LookingForDefine && Token.SyntaxType == FPythonSyntaxTokenizer::ESyntaxType::Terminals)
 				{
-					if(ParseState == EParseState::LookingForString)
-					{
-						RunInfo.Name = TEXT("SyntaxHighlight.PY.String");
-						TextBlockStyle = SyntaxTextStyle.StringTextStyle;
-					}
-					else if (ParseState == EParseState::LookingForDefine)
-					{
-						RunInfo.Name = TEXT("SyntaxHighlight.PY.Define");
-						TextBlockStyle = SyntaxTextStyle.DefineTextStyle;
-					}
-					else if(ParseState == EParseState::LookingForCharacter)
-					{
-						RunInfo.Name = TEXT("SyntaxHighlight.PY.String");
-						TextBlockStyle = SyntaxTextStyle.StringTextStyle;
-					}
-					else if(ParseState == EParseState::LookingForSingleLineComment)
-					{
-						RunInfo.Name = TEXT("SyntaxHighlight.PY.Comment");
-						TextBlockStyle = SyntaxTextStyle.CommentTextStyle;
-					}
-					else if(ParseState == EParseState::LookingForMultiLineString)
-					{
-						RunInfo.Name = TEXT("SyntaxHighlight.PY.String");
-						TextBlockStyle = SyntaxTextStyle.StringTextStyle;
-					}
+					RunName = TEXT("SyntaxHighlight.PY.Normal");
+					RunStyle = ERunStyle::Normal;
+					ParseState = EParseState::None;
+				}
+				else if (ParseState == EParseState::None && Token.SyntaxType == FPythonSyntaxTokenizer::ESyntaxType::Operators)
+				{
+					RunName = TEXT("SyntaxHighlight.PY.Operator");
+					RunStyle = ERunStyle::Operator;
+					ParseState = EParseState::None;
 				}
 
-				TSharedRef< ISlateRun > Run = FSlateTextRun::Create(RunInfo, ModelString, TextBlockStyle, ModelRange);
-				Runs.Add(Run);
 			}
-			else
+			
+			// It's possible that we fail to match a syntax token if we're in a state where it isn't parsed
+			// In this case, we treat it as a literal token
+			if(Token.Type == FPythonSyntaxTokenizer::ETokenType::Literal || !bHasMatchedSyntax)
 			{
-				RunInfo.Name = TEXT("SyntaxHighlight.CPP.WhiteSpace");
-				TSharedRef< ISlateRun > Run = FWhiteSpaceTextRun::Create(RunInfo, ModelString, TextBlockStyle, ModelRange, 4);
-				Runs.Add(Run);
+				if(ParseState == EParseState::LookingForString)
+				{
+					RunName = TEXT("SyntaxHighlight.PY.String");
+					RunStyle = ERunStyle::String;
+				}
+				else if (ParseState == EParseState::LookingForDefine)
+				{
+					RunName = TEXT("SyntaxHighlight.PY.Define");
+					RunStyle = ERunStyle::Define;
+				}
+				else if(ParseState == EParseState::LookingForCharacter)
+				{
+					RunName = TEXT("SyntaxHighlight.PY.String");
+					RunStyle = ERunStyle::String;
+				}
+				else if(ParseState == EParseState::LookingForSingleLineComment)
+				{
+					RunName = TEXT("SyntaxHighlight.PY.Comment");
+					RunStyle = ERunStyle::Comment;
+				}
+				else if(ParseState == EParseState::LookingForMultiLineString)
+				{
+					RunName = TEXT("SyntaxHighlight.PY.String");
+					RunStyle = ERunStyle::String;
+				}
 			}
 		}
+		else
+		{
+			RunName = TEXT("SyntaxHighlight.CPP.WhiteSpace");
+			RunStyle = ERunStyle::WhiteSpace;
+		}
 
-		LinesToAdd.Emplace(MoveTemp(ModelString), MoveTemp(Runs));
+		FStyledRun StyledRun;
+		StyledRun.Range = Range;
+		StyledRun.RunName = RunName;
+		StyledRun.Style = RunStyle;
+		OutRuns.Add(StyledRun);
 	}
 
-	TargetTextLayout.AddLines(LinesToAdd);
+	return ParseState;
 }
-
-
@@ -64,12 +64,61 @@ public:
 
 protected:
 
-	void ParseTokens(const FString& SourceString, FTextLayout& TargetTextLayout, TArray<FPythonSyntaxTokenizer::FTokenizedLine> TokenizedLines);
+	enum class EParseState : uint8
+	{
+		None,
+		LookingForString,
+		LookingForCharacter,
+		LookingForDefine,
+		LookingForSingleLineComment,
+		LookingForMultiLineString,
+	};
 
+	enum class ERunStyle : uint8
+	{
+		Normal,
+		Operator,
+		Keyword,
+		String,
+		Comment,
+		BuiltIn,
+		Define,
+		WhiteSpace,
+	};
+
+	/** Style of a run, with its range relative to the line */
+	struct FStyledRun
+	{
+		FTextRange Range;
+		const TCHAR* RunName;
+		ERunStyle Style;
+	};
 
-	/** Tokenizer used to style the text */
+	/** A line styled by the previous SetText call */
+	struct FStyledLine
+	{
+		FString Text;
+		/** Parse state at the beginning and at the end of the line */
+		EParseState EntryState = EParseState::None;
+		EParseState ExitState = EParseState::None;
+		TArray<FStyledRun> Runs;
+	};
+
+	/** Style the tokens of a line starting from the given state, returns the state at the end of the line */
+	EParseState ParseLine(const FPythonSyntaxTokenizer::FTokenizedLine& TokenizedLine, EParseState ParseState, TArray<FStyledRun>& OutRuns) const;
+
+	const FTextBlockStyle& GetRunTextStyle(const ERunStyle Style) const;
+
+	/** Tokenizer used to style the text, it caches the tokens of the unchanged lines between SetText calls */
 	TSharedPtr< FPythonSyntaxTokenizer > Tokenizer;
 
+	/**
+	 * Lines styled by the previous SetText call. The unchanged lines before and after the edited ones keep their styles
+	 * (unless the parse state entering them changed, like after opening a multi line string), only the others are parsed again.
+	 * The run objects are still created for every line, as the layout owns (and modifies while editing) them.
+	 */
+	TArray<FStyledLine> StyledLines;
+
 	/** True if syntax highlighting is enabled, false to fallback to plain text */
 	bool bSyntaxHighlightingEnabled;
 
@@ -1,7 +1,6 @@
 // Copyright 1998-2016 Epic Games, Inc. All Rights Reserved.
 
 #include "PythonSyntaxTokenizer.h"
-#include "Runtime/Core/Public/Internationalization/BreakIterator.h"
 
 TSharedRef< FPythonSyntaxTokenizer > FPythonSyntaxTokenizer::Create(TArray<FRule> InRules)
 {
@@ -14,73 +13,234 @@ FPythonSyntaxTokenizer::~FPythonSyntaxTokenizer()
 
 void FPythonSyntaxTokenizer::Process(TArray<FTokenizedLine>& OutTokenizedLines, const FString& Input)
 {
-#if UE_ENABLE_ICU
 	TArray<FTextRange> LineRanges;
 	FTextRange::CalculateLineRangesFromString(Input, LineRanges);
-	TokenizeLineRanges(Input, LineRanges, OutTokenizedLines);
-#else
-	FTokenizedLine FakeTokenizedLine;
-	FakeTokenizedLine.Range = FTextRange(0, Input.Len());
-	FakeTokenizedLine.Tokens.Emplace(FToken(ETokenType::Literal, FakeTokenizedLine.Range));
-	OutTokenizedLines.Add(FakeTokenizedLine);
-#endif
+
+	CacheGeneration++;
+	OutTokenizedLines.Reserve(OutTokenizedLines.Num() + LineRanges.Num());
+
+	// Tokenize line ranges, only the lines not found in the cache are tokenized
+	for (const FTextRange& LineRange : LineRanges)
+	{
+		FTokenizedLine TokenizedLine;
+		TokenizedLine.Range = LineRange;
+		TokenizedLine.Text = Input.Mid(LineRange.BeginIndex, LineRange.Len());
+
+		const uint32 LineHash = FLineKeyFuncs::GetKeyHash(TokenizedLine.Text);
+		FCachedLine* CachedLine = LineCache.FindByHash(LineHash, TokenizedLine.Text);
+		if (!CachedLine)
+		{
+			FCachedLine NewLine;
+			TokenizeLine(*TokenizedLine.Text, TokenizedLine.Text.Len(), NewLine.Tokens);
+			CachedLine = &LineCache.AddByHash(LineHash, TokenizedLine.Text, MoveTemp(NewLine));
+		}
+		CachedLine->Generation = CacheGeneration;
+
+		TokenizedLine.Tokens.Reserve(CachedLine->Tokens.Num());
+		for (const FToken& Token : CachedLine->Tokens)
+		{
+			TokenizedLine.Tokens.Emplace(FToken(Token.Type, FTextRange(LineRange.BeginIndex + Token.Range.BeginIndex, LineRange.BeginIndex + Token.Range.EndIndex), Token.SyntaxType));
+		}
+
+		OutTokenizedLines.Add(MoveTemp(TokenizedLine));
+	}
+
+	// drop the lines removed (or edited) since the previous call
+	for (auto It = LineCache.CreateIterator(); It; ++It)
+	{
+		if (It.Value().Generation != CacheGeneration)
+		{
+			It.RemoveCurrent();
+		}
+	}
+}
+
+void FPythonSyntaxTokenizer::ResetCache()
+{
+	LineCache.Empty();
 }
 
 FPythonSyntaxTokenizer::FPythonSyntaxTokenizer(TArray<FRule> InRules)
 	: Rules(MoveTemp(InRules))
+	, CacheGeneration(0)
 {
+	// build a temporary pointer based trie, then flatten it (children sorted by character)
+	struct FBuildNode
+	{
+		int32 RuleIndex = INDEX_NONE;
+		TMap<TCHAR, int32> Children;
+	};
+
+	TArray<FBuildNode> BuildNodes;
+	BuildNodes.AddDefaulted();
+
+	for (int32 RuleIndex = 0; RuleIndex < Rules.Num(); RuleIndex++)
+	{
+		const FString& MatchText = Rules[RuleIndex].MatchText;
+		if (MatchText.IsEmpty())
+		{
+			continue;
+		}
+
+		int32 Current = 0;
+		for (const TCHAR Char : MatchText)
+		{
+			int32* Child = BuildNodes[Current].Children.Find(Char);
+			if (Child)
+			{
+				Current = *Child;
+			}
+			else
+			{
+				const int32 NewNode = BuildNodes.AddDefaulted();
+				BuildNodes[Current].Children.Add(Char, NewNode);
+				Current = NewNode;
+			}
+		}
+
+		// the first rule wins, as in the linear scan
+		if (BuildNodes[Current].RuleIndex == INDEX_NONE)
+		{
+			BuildNodes[Current].RuleIndex = RuleIndex;
+		}
+	}
+
+	// breadth first flattening, so siblings are contiguous
+	TrieNodes.SetNum(1);
+	TrieNodes[0].RuleIndex = BuildNodes[0].RuleIndex;
+	TArray<int32> Queue;
+	Queue.Add(0);
+	TArray<int32> FlatIndices;
+	FlatIndices.Add(0);
+	for (int32 QueueIndex = 0; QueueIndex < Queue.Num(); QueueIndex++)
+	{
+		FBuildNode& BuildNode = BuildNodes[Queue[QueueIndex]];
+		const int32 FlatIndex = FlatIndices[QueueIndex];
+
+		BuildNode.Children.KeySort(TLess<TCHAR>());
+		TrieNodes[FlatIndex].FirstChild = TrieNodes.Num();
+		TrieNodes[FlatIndex].NumChildren = BuildNode.Children.Num();
+		for (const TPair<TCHAR, int32>& Pair : BuildNode.Children)
+		{
+			FTrieNode Node;
+			Node.Char = Pair.Key;
+			Node.RuleIndex = BuildNodes[Pair.Value].RuleIndex;
+			FlatIndices.Add(TrieNodes.Add(Node));
+			Queue.Add(Pair.Value);
+		}
+	}
+
+	for (int32 Char = 0; Char < 128; Char++)
+	{
+		RootChildren[Char] = INDEX_NONE;
+	}
+	for (int32 Child = TrieNodes[0].FirstChild; Child < TrieNodes[0].FirstChild + TrieNodes[0].NumChildren; Child++)
+	{
+		if (TrieNodes[Child].Char < 128)
+		{
+			RootChildren[TrieNodes[Child].Char] = Child;
+		}
+	}
 }
 
-void FPythonSyntaxTokenizer::TokenizeLineRanges(const FString& Input, const TArray<FTextRange>& LineRanges, TArray<FTokenizedLine>& OutTokenizedLines)
+int32 FPythonSyntaxTokenizer::MatchRule(const TCHAR* Text, const int32 TextLen, ESyntaxType& OutSyntaxType) const
 {
-	TSharedRef<IBreakIterator> WBI = FBreakIterator::CreateWordBreakIterator();
-	WBI->SetString(Input);
+	if (TextLen <= 0 || (uint32)Text[0] >= 128)
+	{
+		return 0;
+	}
 
-	// Tokenize line ranges
-	for(const FTextRange& LineRange : LineRanges)
+	int32 Node = RootChildren[Text[0]];
+	int32 BestRule = INDEX_NONE;
+	int32 BestLen = 0;
+	int32 Len = 1;
+
+	while (Node != INDEX_NONE)
 	{
-		FTokenizedLine TokenizedLine;
-		TokenizedLine.Range = LineRange;
+		const FTrieNode& TrieNode = TrieNodes[Node];
+		// multiple rules can match (e.g. 'in' and 'import'), the one coming first in Rules wins
+		if (TrieNode.RuleIndex != INDEX_NONE && (BestRule == INDEX_NONE || TrieNode.RuleIndex < BestRule))
+		{
+			BestRule = TrieNode.RuleIndex;
+			BestLen = Len;
+		}
 
-		if(TokenizedLine.Range.IsEmpty())
+		if (Len >= TextLen)
 		{
-			TokenizedLine.Tokens.Emplace(FToken(ETokenType::Literal, TokenizedLine.Range, ESyntaxType::None));
+			break;
 		}
-		else
+
+		// binary search the next character between the children
+		const TCHAR Next = Text[Len];
+		int32 Low = TrieNode.FirstChild;
+		int32 High = TrieNode.FirstChild + TrieNode.NumChildren - 1;
+		Node = INDEX_NONE;
+		while (Low <= High)
 		{
-			int32 CurrentOffset = LineRange.BeginIndex;
-			while(CurrentOffset < LineRange.EndIndex)
+			const int32 Middle = (Low + High) / 2;
+			if (TrieNodes[Middle].Char == Next)
+			{
+				Node = Middle;
+				break;
+			}
+			if (TrieNodes[Middle].Char < Next)
+			{
+				Low = Middle + 1;
+			}
+			else
 			{
-				// First check for a match against any syntax token rules
-				bool bHasMatchedSyntax = false;
-				for(const FRule& Rule : Rules)
-				{
-					if(FCString::Strncmp(&Input[CurrentOffset], *Rule.MatchText, Rule.MatchText.Len()) == 0)
-					{
-						const int32 SyntaxTokenEnd = CurrentOffset + Rule.MatchText.Len();
-						TokenizedLine.Tokens.Emplace(FToken(ETokenType::Syntax, FTextRange(CurrentOffset, SyntaxTokenEnd), Rule.SyntaxType));
-
-						check(SyntaxTokenEnd <= LineRange.EndIndex);
-
-						bHasMatchedSyntax = true;
-						CurrentOffset = SyntaxTokenEnd;
-						break;
-					}
-				}
-
-				if(bHasMatchedSyntax)
-				{
-					continue;
-				}
-
-				// If none matched, consume the character(s) as text
-				const int32 NextWordBoundary = WBI->MoveToCandidateAfter(CurrentOffset);
-				const int32 TextTokenEnd = (NextWordBoundary == INDEX_NONE) ? LineRange.EndIndex : FMath::Min(NextWordBoundary, LineRange.EndIndex);
-				TokenizedLine.Tokens.Emplace(FToken(ETokenType::Literal, FTextRange(CurrentOffset, TextTokenEnd), ESyntaxType::None));
-				CurrentOffset = TextTokenEnd;
+				High = Middle - 1;
 			}
 		}
+		Len++;
+	}
+
+	if (BestRule != INDEX_NONE)
+	{
+		OutSyntaxType = Rules[BestRule].SyntaxType;
+	}
+	return BestLen;
+}
 
-		OutTokenizedLines.Add(TokenizedLine);
+void FPythonSyntaxTokenizer::TokenizeLine(const TCHAR* Line, const int32 LineLen, TArray<FToken>& OutTokens) const
+{
+	if (LineLen <= 0)
+	{
+		OutTokens.Emplace(FToken(ETokenType::Literal, FTextRange(0, 0), ESyntaxType::None));
+		return;
+	}
+
+	int32 CurrentOffset = 0;
+	while (CurrentOffset < LineLen)
+	{
+		// First check for a match against any syntax token rules
+		ESyntaxType SyntaxType = ESyntaxType::None;
+		const int32 MatchLen = MatchRule(Line + CurrentOffset, LineLen - CurrentOffset, SyntaxType);
+		if (MatchLen > 0)
+		{
+			OutTokens.Emplace(FToken(ETokenType::Syntax, FTextRange(CurrentOffset, CurrentOffset + MatchLen), SyntaxType));
+			CurrentOffset += MatchLen;
+			continue;
+		}
+
+		// If none matched, consume the word (or the whitespace run, or the single character) as text
+		int32 TextTokenEnd = CurrentOffset + 1;
+		const TCHAR Char = Line[CurrentOffset];
+		if (FChar::IsAlnum(Char) || Char == TEXT('_'))
+		{
+			while (TextTokenEnd < LineLen && (FChar::IsAlnum(Line[TextTokenEnd]) || Line[TextTokenEnd] == TEXT('_')))
+			{
+				TextTokenEnd++;
+			}
+		}
+		else if (FChar::IsWhitespace(Char))
+		{
+			while (TextTokenEnd < LineLen && FChar::IsWhitespace(Line[TextTokenEnd]))
+			{
+				TextTokenEnd++;
+			}
+		}
+		OutTokens.Emplace(FToken(ETokenType::Literal, FTextRange(CurrentOffset, TextTokenEnd), ESyntaxType::None));
+		CurrentOffset = TextTokenEnd;
 	}
 }
@@ -48,6 +48,8 @@ public:
 	{
 		FTextRange Range;
 		TArray<FToken> Tokens;
+		/** Text of the line, so callers do not need to extract it again */
+		FString Text;
 	};
 
 	/** Rule used to match syntax token types */
@@ -71,15 +73,67 @@ public:
 
 	virtual ~FPythonSyntaxTokenizer();
 
+	/** Tokenize the whole input, lines already seen by the previous call are not tokenized again */
 	void Process(TArray<FTokenizedLine>& OutTokenizedLines, const FString& Input);
 
+	/** Tokenize a single line (without line terminators), token ranges are relative to the line */
+	void TokenizeLine(const TCHAR* Line, const int32 LineLen, TArray<FToken>& OutTokens) const;
+
+	/** Forget the tokens of the previously processed lines */
+	void ResetCache();
+
 private:
 
 	FPythonSyntaxTokenizer(TArray<FRule> InRules);
 
-	void TokenizeLineRanges(const FString& Input, const TArray<FTextRange>& LineRanges, TArray<FTokenizedLine>& OutTokenizedLines);
+	/** Returns the length of the first (in rules order) rule matching at the given position, 0 if none */
+	int32 MatchRule(const TCHAR* Text, const int32 TextLen, ESyntaxType& OutSyntaxType) const;
 
 	/** Rules to control the tokenizer, processed in-order so the most greedy matches must come first */
 	TArray<FRule> Rules;
 
+	/** Node of the rules trie, children are stored contiguously sorted by character */
+	struct FTrieNode
+	{
+		TCHAR Char = 0;
+		/** Index of the rule ending in this node (the one with the lowest index if duplicated) */
+		int32 RuleIndex = INDEX_NONE;
+		int32 FirstChild = INDEX_NONE;
+		int32 NumChildren = 0;
+	};
+
+	/** Flattened trie built from Rules, node 0 is the root */
+	TArray<FTrieNode> TrieNodes;
+
+	/** Direct lookup of the root children for ASCII characters */
+	int32 RootChildren[128];
+
+	struct FCachedLine
+	{
+		/** Tokens relative to the line */
+		TArray<FToken> Tokens;
+		/** Last Process call using this line */
+		uint32 Generation;
+	};
+
+	/** FString keys are case insensitive by default, python is not */
+	struct FLineKeyFuncs : TDefaultMapKeyFuncs<FString, FCachedLine, false>
+	{
+		static bool Matches(const FString& A, const FString& B)
+		{
+			return A.Equals(B, ESearchCase::CaseSensitive);
+		}
+
+		static uint32 GetKeyHash(const FString& Key)
+		{
+			return FCrc::StrCrc32(*Key);
+		}
+	};
+
+	/** Lines seen by the last Process call, keyed by line text */
+	TMap<FString, FCachedLine, FDefaultSetAllocator, FLineKeyFuncs> LineCache;
+
+	/** Incremented by every Process call, lines not used by the current call are dropped from the cache */
+	uint32 CacheGeneration;
+
 };
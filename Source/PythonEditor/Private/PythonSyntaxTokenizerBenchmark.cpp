@@ -0,0 +1,101 @@
+// Copyright 1998-2016 Epic Games, Inc. All Rights Reserved.
+
+#include "PythonSyntaxTokenizer.h"
+#include "Runtime/Core/Public/Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPythonSyntaxTokenizerBenchmark, "Python.Editor.SyntaxTokenizer.Benchmark", EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+static bool PythonSyntaxTokenizerBenchmarkSameTokens(const TArray<FPythonSyntaxTokenizer::FTokenizedLine>& A, const TArray<FPythonSyntaxTokenizer::FTokenizedLine>& B)
+{
+	if (A.Num() != B.Num())
+	{
+		return false;
+	}
+
+	for (int32 LineIndex = 0; LineIndex < A.Num(); LineIndex++)
+	{
+		if (A[LineIndex].Range != B[LineIndex].Range || !A[LineIndex].Text.Equals(B[LineIndex].Text, ESearchCase::CaseSensitive) || A[LineIndex].Tokens.Num() != B[LineIndex].Tokens.Num())
+		{
+			return false;
+		}
+		for (int32 TokenIndex = 0; TokenIndex < A[LineIndex].Tokens.Num(); TokenIndex++)
+		{
+			const FPythonSyntaxTokenizer::FToken& TokenA = A[LineIndex].Tokens[TokenIndex];
+			const FPythonSyntaxTokenizer::FToken& TokenB = B[LineIndex].Tokens[TokenIndex];
+			if (TokenA.Type != TokenB.Type || TokenA.Range != TokenB.Range || TokenA.SyntaxType != TokenB.SyntaxType)
+			{
+				return false;
+			}
+		}
+	}
+
+	return true;
+}
+
+bool FPythonSyntaxTokenizerBenchmark::RunTest(const FString& Parameters)
+{
+	const TCHAR* Keywords[] = { TEXT("and"), TEXT("for"), TEXT("from"), TEXT("if"), TEXT("import"), TEXT("in"), TEXT("is"), TEXT("return"), TEXT("None"), TEXT("as") };
+	const TCHAR* Operators[] = { TEXT("="), TEXT("=="), TEXT("+"), TEXT("-"), TEXT("*"), TEXT("**"), TEXT("+="), TEXT("'"), TEXT("\"\"\""), TEXT("\""), TEXT("#") };
+	const TCHAR* Terminals[] = { TEXT("("), TEXT(")"), TEXT("["), TEXT("]"), TEXT(":") };
+	const TCHAR* BuiltIns[] = { TEXT("def"), TEXT("class"), TEXT("len"), TEXT("range"), TEXT("print"), TEXT("__init__") };
+
+	TArray<FPythonSyntaxTokenizer::FRule> Rules;
+	for (const TCHAR* Operator : Operators)
+	{
+		Rules.Emplace(FPythonSyntaxTokenizer::FRule(Operator, FPythonSyntaxTokenizer::ESyntaxType::Operators));
+	}
+	for (const TCHAR* Terminal : Terminals)
+	{
+		Rules.Emplace(FPythonSyntaxTokenizer::FRule(Terminal, FPythonSyntaxTokenizer::ESyntaxType::Terminals));
+	}
+	for (const TCHAR* Keyword : Keywords)
+	{
+		Rules.Emplace(FPythonSyntaxTokenizer::FRule(Keyword, FPythonSyntaxTokenizer::ESyntaxType::Keywords));
+	}
+	for (const TCHAR* BuiltIn : BuiltIns)
+	{
+		Rules.Emplace(FPythonSyntaxTokenizer::FRule(BuiltIn, FPythonSyntaxTokenizer::ESyntaxType::Function));
+	}
+
+	// a 5000 lines script
+	FString Script;
+	for (int32 Index = 0; Index < 1000; Index++)
+	{
+		Script += FString::Printf(TEXT("class Foo%d(object):\n"), Index);
+		Script += TEXT("    \"\"\"docstring with import and for\"\"\"\n");
+		Script += FString::Printf(TEXT("    def __init__(self, value=%d):\n"), Index);
+		Script += TEXT("        self.values = [value ** 2 for value in range(len('hello'))] # comment\n");
+		Script += TEXT("        return None\n");
+	}
+
+	TSharedRef<FPythonSyntaxTokenizer> Tokenizer = FPythonSyntaxTokenizer::Create(Rules);
+
+	TArray<FPythonSyntaxTokenizer::FTokenizedLine> FullLines;
+	double StartTime = FPlatformTime::Seconds();
+	Tokenizer->Process(FullLines, Script);
+	const double FullTime = FPlatformTime::Seconds() - StartTime;
+
+	// single keystroke in the middle of the script, the syntax highlighter calls Process on every change
+	const int32 EditOffset = Script.Find(TEXT("return None"), ESearchCase::CaseSensitive, ESearchDir::FromStart, Script.Len() / 2);
+	Script.InsertAt(EditOffset, TEXT('x'));
+
+	TArray<FPythonSyntaxTokenizer::FTokenizedLine> IncrementalLines;
+	StartTime = FPlatformTime::Seconds();
+	Tokenizer->Process(IncrementalLines, Script);
+	const double IncrementalTime = FPlatformTime::Seconds() - StartTime;
+
+	// the incremental result must match a full tokenization
+	TSharedRef<FPythonSyntaxTokenizer> ColdTokenizer = FPythonSyntaxTokenizer::Create(Rules);
+	TArray<FPythonSyntaxTokenizer::FTokenizedLine> ColdLines;
+	ColdTokenizer->Process(ColdLines, Script);
+
+	TestTrue(TEXT("Incremental tokenization matches full tokenization"), PythonSyntaxTokenizerBenchmarkSameTokens(IncrementalLines, ColdLines));
+
+	AddInfo(FString::Printf(TEXT("Tokenized %d lines in %.3f ms, single keystroke retokenized in %.3f ms"), FullLines.Num(), FullTime * 1000, IncrementalTime * 1000));
+
+	return true;
+}
+
+#endif
@@ -14,6 +14,7 @@
 #include "Editor/AIGraph/Classes/AIGraph.h"
 #include "Editor/AIGraph/Classes/AIGraphNode.h"
 #include "Editor/BlueprintGraph/Classes/K2Node_FunctionEntry.h"
+#include "UEPyGraphBatch.h"
 
 PyObject *py_ue_graph_add_node_call_function(ue_PyUObject * self, PyObject * args)
 {
@@ -68,12 +69,9 @@ PyObject *py_ue_graph_add_node_call_function(ue_PyUObject * self, PyObject * arg
 	node->NodePosX = x;
 	node->NodePosY = y;
 	UEdGraphSchema_K2::SetNodeMetaData(node, FNodeMetadata::DefaultGraphNode);
-	graph->AddNode(node);
+	FPythonGraphBatch::Get().AddNode(graph, node);
 
-	if (UBlueprint *bp = Cast<UBlueprint>(node->GetGraph()->GetOuter()))
-	{
-		FBlueprintEditorUtils::MarkBlueprintAsStructurallyModified(bp);
-	}
+	FPythonGraphBatch::Get().MarkStructurallyModified(node->GetGraph());
 
 	Py_RETURN_UOBJECT(node);
 }
@@ -108,12 +106,9 @@ PyObject *py_ue_graph_add_node_custom_event(ue_PyUObject * self, PyObject * args
 	node->NodePosX = x;
 	node->NodePosY = y;
 	UEdGraphSchema_K2::SetNodeMetaData(node, FNodeMetadata::DefaultGraphNode);
-	graph->AddNode(node);
+	FPythonGraphBatch::Get().AddNode(graph, node);
 
-	if (UBlueprint *bp = Cast<UBlueprint>(node->GetGraph()->GetOuter()))
-	{
-		FBlueprintEditorUtils::MarkBlueprintAsStructurallyModified(bp);
-	}
+	FPythonGraphBatch::Get().MarkStructurallyModified(node->GetGraph());
 
 	Py_RETURN_UOBJECT(node);
 }
@@ -177,12 +172,20 @@ PyObject *py_ue_graph_add_node_event(ue_PyUObject * self, PyObject * args)
 	if (!node)
 	{
 		node = NewObject<UK2Node_Event>(graph);
-		UEdGraphSchema_K2::SetNodeMetaData(node, FNodeMetadata::DefaultGraphNode);
+
+		node->CreateNewGuid();
+		node->PostPlacedNewNode();
 		node->EventReference.SetExternalMember(UTF8_TO_TCHAR(name), u_class);
-		node = FEdGraphSchemaAction_K2NewNode::SpawnNodeFromTemplate<UK2Node_Event>(graph, node, FVector2D(x, y));
+		node->bOverrideFunction = true;
+		node->SetFlags(RF_Transactional);
+		node->AllocateDefaultPins();
+		node->NodePosX = x;
+		node->NodePosY = y;
+		UEdGraphSchema_K2::SetNodeMetaData(node, FNodeMetadata::DefaultGraphNode);
+		FPythonGraphBatch::Get().AddNode(graph, node);
 	}
 
-	FBlueprintEditorUtils::MarkBlueprintAsStructurallyModified(bp);
+	FPythonGraphBatch::Get().MarkStructurallyModified(bp);
 
 	Py_RETURN_UOBJECT(node);
 }
@@ -223,14 +226,21 @@ PyObject *py_ue_graph_add_node_variable_get(ue_PyUObject * self, PyObject * args
 		u_struct = (UStruct *)ue_py_struct->ue_object;
 	}
 
-	UK2Node_VariableGet *node = NewObject<UK2Node_VariableGet>();
-
 	UBlueprint *bp = FBlueprintEditorUtils::FindBlueprintForGraph(graph);
 
+	UK2Node_VariableGet *node = NewObject<UK2Node_VariableGet>(graph);
+
+	node->CreateNewGuid();
+	node->PostPlacedNewNode();
 	UEdGraphSchema_K2::ConfigureVarNode(node, FName(UTF8_TO_TCHAR(name)), u_struct, bp);
-	node = FEdGraphSchemaAction_K2NewNode::SpawnNodeFromTemplate<UK2Node_VariableGet>(graph, node, FVector2D(x, y));
+	node->SetFlags(RF_Transactional);
+	node->AllocateDefaultPins();
+	node->NodePosX = x;
+	node->NodePosY = y;
+	UEdGraphSchema_K2::SetNodeMetaData(node, FNodeMetadata::DefaultGraphNode);
+	FPythonGraphBatch::Get().AddNode(graph, node);
 
-	FBlueprintEditorUtils::MarkBlueprintAsStructurallyModified(bp);
+	FPythonGraphBatch::Get().MarkStructurallyModified(bp);
 
 	Py_RETURN_UOBJECT(node);
 }
@@ -271,14 +281,21 @@ PyObject *py_ue_graph_add_node_variable_set(ue_PyUObject * self, PyObject * args
 		u_struct = (UStruct *)ue_py_struct->ue_object;
 	}
 
-	UK2Node_VariableSet *node = NewObject<UK2Node_VariableSet>();
-
 	UBlueprint *bp = FBlueprintEditorUtils::FindBlueprintForGraph(graph);
 
+	UK2Node_VariableSet *node = NewObject<UK2Node_VariableSet>(graph);
+
+	node->CreateNewGuid();
+	node->PostPlacedNewNode();
 	UEdGraphSchema_K2::ConfigureVarNode(node, FName(UTF8_TO_TCHAR(name)), u_struct, bp);
-	node = FEdGraphSchemaAction_K2NewNode::SpawnNodeFromTemplate<UK2Node_VariableSet>(graph, node, FVector2D(x, y));
+	node->SetFlags(RF_Transactional);
+	node->AllocateDefaultPins();
+	node->NodePosX = x;
+	node->NodePosY = y;
+	UEdGraphSchema_K2::SetNodeMetaData(node, FNodeMetadata::DefaultGraphNode);
+	FPythonGraphBatch::Get().AddNode(graph, node);
 
-	FBlueprintEditorUtils::MarkBlueprintAsStructurallyModified(bp);
+	FPythonGraphBatch::Get().MarkStructurallyModified(bp);
 
 	Py_RETURN_UOBJECT(node);
 }
@@ -375,12 +392,9 @@ PyObject *py_ue_graph_add_node(ue_PyUObject * self, PyObject * args)
 	{
 		UEdGraphSchema_K2::SetNodeMetaData(node, FName(UTF8_TO_TCHAR(metadata)));
 	}
-	graph->AddNode(node);
+	FPythonGraphBatch::Get().AddNode(graph, node);
 
-	if (UBlueprint *bp = Cast<UBlueprint>(node->GetGraph()->GetOuter()))
-	{
-		FBlueprintEditorUtils::MarkBlueprintAsStructurallyModified(bp);
-	}
+	FPythonGraphBatch::Get().MarkStructurallyModified(node->GetGraph());
 
 	Py_RETURN_UOBJECT(node);
 }
@@ -435,12 +449,9 @@ PyObject *py_ue_graph_remove_node(ue_PyUObject * self, PyObject * args)
 	if (!node)
 		return PyErr_Format(PyExc_Exception, "argument is not a supported type");
 
-	graph->RemoveNode(node);
+	FPythonGraphBatch::Get().RemoveNode(graph, node);
 
-	if (UBlueprint *bp = Cast<UBlueprint>(node->GetGraph()->GetOuter()))
-	{
-		FBlueprintEditorUtils::MarkBlueprintAsStructurallyModified(bp);
-	}
+	FPythonGraphBatch::Get().MarkStructurallyModified(node->GetGraph());
 
 	Py_RETURN_NONE;
 }
@@ -496,11 +507,14 @@ PyObject *py_ue_graph_reconstruct_node(ue_PyUObject * self, PyObject * args)
 		return PyErr_Format(PyExc_Exception, "argument is not a supported type");
 
 	//graph->RemoveNode(node);
-	node->ReconstructNode();
-
-	if (UBlueprint *bp = Cast<UBlueprint>(node->GetGraph()->GetOuter()))
+	if (FPythonGraphBatch::Get().IsActive())
 	{
-		FBlueprintEditorUtils::MarkBlueprintAsStructurallyModified(bp);
+		FPythonGraphBatch::Get().QueueReconstruction(node);
+	}
+	else
+	{
+		node->ReconstructNode();
+		FPythonGraphBatch::Get().MarkStructurallyModified(node->GetGraph());
 	}
 
 	Py_RETURN_NONE;
@@ -554,12 +568,9 @@ PyObject *py_ue_graph_add_node_dynamic_cast(ue_PyUObject * self, PyObject * args
 	{
 		UEdGraphSchema_K2::SetNodeMetaData(node, FName(UTF8_TO_TCHAR(metadata)));
 	}
-	graph->AddNode(node);
+	FPythonGraphBatch::Get().AddNode(graph, node);
 
-	if(UBlueprint *bp = Cast<UBlueprint>(node->GetGraph()->GetOuter()))
-	{
-		FBlueprintEditorUtils::MarkBlueprintAsStructurallyModified(bp);
-	}
+	FPythonGraphBatch::Get().MarkStructurallyModified(node->GetGraph());
 
 	EXTRA_UE_LOG(LogPython, Warning, TEXT("add_node_dynamic_cast: targettype is %p"), (void *)(node->TargetType));
 
@@ -630,7 +641,14 @@ PyObject *py_ue_node_reconstruct(ue_PyUObject * self, PyObject * args)
 	if (!node)
 		return PyErr_Format(PyExc_Exception, "uobject is not a UEdGraphNode");
 
-	node->GetSchema()->ReconstructNode(*node);
+	if (FPythonGraphBatch::Get().IsActive())
+	{
+		FPythonGraphBatch::Get().QueueReconstruction(node);
+	}
+	else
+	{
+		node->GetSchema()->ReconstructNode(*node);
+	}
 
 	Py_RETURN_NONE;
 }
@@ -781,10 +799,7 @@ PyObject *py_ue_node_create_pin(ue_PyUObject * self, PyObject * args)
 		return PyErr_Format(PyExc_Exception, "unable to create pin \"%s\"", name);
 	}
 
-	if (UBlueprint *bp = Cast<UBlueprint>(node->GetGraph()->GetOuter()))
-	{
-		FBlueprintEditorUtils::MarkBlueprintAsStructurallyModified(bp);
-	}
+	FPythonGraphBatch::Get().MarkStructurallyModified(node->GetGraph());
 
 	return py_ue_new_edgraphpin(pin);
 }
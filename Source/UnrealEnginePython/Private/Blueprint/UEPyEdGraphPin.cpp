@@ -4,6 +4,7 @@
 
 #include "Runtime/Engine/Classes/EdGraph/EdGraphPin.h"
 #include "Editor/UnrealEd/Public/Kismet2/BlueprintEditorUtils.h"
+#include "UEPyGraphBatch.h"
 
 static PyObject *py_ue_edgraphpin_make_link_to(ue_PyEdGraphPin *self, PyObject * args)
 {
@@ -21,10 +22,7 @@ static PyObject *py_ue_edgraphpin_make_link_to(ue_PyEdGraphPin *self, PyObject *
 
 	self->pin->MakeLinkTo(py_other_pin->pin);
 
-	if (UBlueprint *bp = Cast<UBlueprint>(self->pin->GetOwningNode()->GetGraph()->GetOuter()))
-	{
-		FBlueprintEditorUtils::MarkBlueprintAsStructurallyModified(bp);
-	}
+	FPythonGraphBatch::Get().MarkStructurallyModified(self->pin->GetOwningNode()->GetGraph());
 
 	Py_RETURN_NONE;
 }
@@ -48,10 +46,7 @@ static PyObject *py_ue_edgraphpin_connect(ue_PyEdGraphPin *self, PyObject * args
 		return PyErr_Format(PyExc_Exception, "unable to connect pins");
 	}
 
-	if (UBlueprint *bp = Cast<UBlueprint>(self->pin->GetOwningNode()->GetGraph()->GetOuter()))
-	{
-		FBlueprintEditorUtils::MarkBlueprintAsStructurallyModified(bp);
-	}
+	FPythonGraphBatch::Get().MarkStructurallyModified(self->pin->GetOwningNode()->GetGraph());
 
 	Py_RETURN_NONE;
 }
@@ -72,10 +67,7 @@ static PyObject *py_ue_edgraphpin_break_link_to(ue_PyEdGraphPin *self, PyObject
 
 	self->pin->BreakLinkTo(py_other_pin->pin);
 
-	if (UBlueprint *bp = Cast<UBlueprint>(self->pin->GetOwningNode()->GetGraph()->GetOuter()))
-	{
-		FBlueprintEditorUtils::MarkBlueprintAsStructurallyModified(bp);
-	}
+	FPythonGraphBatch::Get().MarkStructurallyModified(self->pin->GetOwningNode()->GetGraph());
 
 	Py_RETURN_NONE;
 }
@@ -94,10 +86,7 @@ static PyObject *py_ue_edgraphpin_break_all_pin_links(ue_PyEdGraphPin *self, PyO
 
 	self->pin->BreakAllPinLinks(notify_nodes);
 
-	if (UBlueprint *bp = Cast<UBlueprint>(self->pin->GetOwningNode()->GetGraph()->GetOuter()))
-	{
-		FBlueprintEditorUtils::MarkBlueprintAsStructurallyModified(bp);
-	}
+	FPythonGraphBatch::Get().MarkStructurallyModified(self->pin->GetOwningNode()->GetGraph());
 
 	Py_RETURN_NONE;
 }
@@ -0,0 +1,249 @@
+#include "UEPyGraphBatch.h"
+
+#if WITH_EDITOR
+
+#include "Runtime/Engine/Classes/EdGraph/EdGraph.h"
+#include "Runtime/Engine/Classes/EdGraph/EdGraphSchema.h"
+#include "Editor/UnrealEd/Public/Kismet2/BlueprintEditorUtils.h"
+#include "Editor/UnrealEd/Public/Kismet2/KismetEditorUtilities.h"
+#if ENGINE_MAJOR_VERSION == 5 || (ENGINE_MAJOR_VERSION == 4 && ENGINE_MINOR_VERSION >= 21)
+#include "Editor/Kismet/Public/BlueprintCompilationManager.h"
+#endif
+
+FPythonGraphBatch &FPythonGraphBatch::Get()
+{
+	static FPythonGraphBatch Singleton;
+	return Singleton;
+}
+
+FPythonGraphBatch::FPythonGraphBatch()
+{
+	Depth = 0;
+}
+
+void FPythonGraphBatch::Begin()
+{
+	Depth++;
+}
+
+bool FPythonGraphBatch::End(bool bCompile, TArray<UBlueprint *> &Touched, TArray<UBlueprint *> &Failed)
+{
+	if (Depth <= 0)
+		return false;
+
+	if (--Depth > 0)
+		return true;
+
+	// every node is reconstructed once, in the order of the first request
+	for (const TWeakObjectPtr<UEdGraphNode> &Node : PendingReconstructions)
+	{
+		if (Node.IsValid())
+		{
+			Node->GetSchema()->ReconstructNode(*Node.Get());
+		}
+	}
+
+	for (const TWeakObjectPtr<UEdGraph> &Graph : ChangedGraphs)
+	{
+		if (Graph.IsValid())
+		{
+			Graph->NotifyGraphChanged();
+		}
+	}
+
+	for (const TWeakObjectPtr<UBlueprint> &Blueprint : ModifiedBlueprints)
+	{
+		if (Blueprint.IsValid())
+		{
+			FBlueprintEditorUtils::MarkBlueprintAsStructurallyModified(Blueprint.Get());
+			Touched.Add(Blueprint.Get());
+		}
+	}
+
+	PendingReconstructions.Empty();
+	PendingReconstructionsSet.Empty();
+	ChangedGraphs.Empty();
+	ModifiedBlueprints.Empty();
+
+	if (bCompile && Touched.Num() > 0)
+	{
+		CompileBlueprints(Touched, Failed);
+	}
+
+	return true;
+}
+
+void FPythonGraphBatch::AddNode(UEdGraph *Graph, UEdGraphNode *Node)
+{
+	if (!IsActive())
+	{
+		Graph->AddNode(Node);
+		return;
+	}
+
+	// what UEdGraph::AddNode() does, without broadcasting the change to the graph editors
+	Graph->Modify();
+	Graph->Nodes.Add(Node);
+	ChangedGraphs.Add(Graph);
+}
+
+void FPythonGraphBatch::QueueReconstruction(UEdGraphNode *Node)
+{
+	bool bAlreadyQueued = false;
+	PendingReconstructionsSet.Add(Node, &bAlreadyQueued);
+	if (!bAlreadyQueued)
+	{
+		PendingReconstructions.Add(Node);
+	}
+	if (UEdGraph *Graph = Node->GetGraph())
+	{
+		MarkStructurallyModified(Graph);
+	}
+}
+
+void FPythonGraphBatch::RemoveNode(UEdGraph *Graph, UEdGraphNode *Node)
+{
+	// a removed node must not be reconstructed at the end of the batch
+	if (PendingReconstructionsSet.Remove(Node) > 0)
+	{
+		PendingReconstructions.Remove(Node);
+	}
+	Graph->RemoveNode(Node);
+}
+
+void FPythonGraphBatch::MarkStructurallyModified(UEdGraph *Graph)
+{
+	if (UBlueprint *Blueprint = Cast<UBlueprint>(Graph->GetOuter()))
+	{
+		MarkStructurallyModified(Blueprint);
+	}
+}
+
+void FPythonGraphBatch::MarkStructurallyModified(UBlueprint *Blueprint)
+{
+	if (!Blueprint)
+		return;
+
+	if (!IsActive())
+	{
+		FBlueprintEditorUtils::MarkBlueprintAsStructurallyModified(Blueprint);
+		return;
+	}
+
+	ModifiedBlueprints.AddUnique(Blueprint);
+}
+
+void FPythonGraphBatch::CompileBlueprints(const TArray<UBlueprint *> &Blueprints, TArray<UBlueprint *> &Failed)
+{
+#if ENGINE_MAJOR_VERSION == 5 || (ENGINE_MAJOR_VERSION == 4 && ENGINE_MINOR_VERSION >= 21)
+	// the compilation manager compiles the whole queue together: dependencies are resolved once,
+	// and reinstancing and garbage collection run a single time for all of the blueprints
+	for (UBlueprint *Blueprint : Blueprints)
+	{
+		FBlueprintCompilationManager::QueueForCompilation(Blueprint);
+	}
+	FBlueprintCompilationManager::FlushCompilationQueueAndReinstance();
+#else
+	for (UBlueprint *Blueprint : Blueprints)
+	{
+		FKismetEditorUtilities::CompileBlueprint(Blueprint);
+	}
+#endif
+
+	for (UBlueprint *Blueprint : Blueprints)
+	{
+		if (Blueprint->Status == BS_Error)
+		{
+			Failed.Add(Blueprint);
+		}
+	}
+}
+
+static PyObject *ue_py_blueprints_to_list(const TArray<UBlueprint *> &Blueprints)
+{
+	PyObject *py_list = PyList_New(0);
+	for (UBlueprint *Blueprint : Blueprints)
+	{
+		ue_PyUObject *py_blueprint = ue_get_python_uobject(Blueprint);
+		if (py_blueprint)
+		{
+			PyList_Append(py_list, (PyObject *)py_blueprint);
+		}
+	}
+	return py_list;
+}
+
+PyObject *py_unreal_engine_begin_graph_batch(PyObject *self, PyObject *args)
+{
+	FPythonGraphBatch::Get().Begin();
+	Py_RETURN_NONE;
+}
+
+PyObject *py_unreal_engine_end_graph_batch(PyObject *self, PyObject *args, PyObject *kwargs)
+{
+	PyObject *py_compile = nullptr;
+	static char *kw_names[] = { (char *)"compile", nullptr };
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "|O:end_graph_batch", kw_names, &py_compile))
+	{
+		return nullptr;
+	}
+
+	const bool bCompile = !py_compile || PyObject_IsTrue(py_compile);
+
+	TArray<UBlueprint *> Touched;
+	TArray<UBlueprint *> Failed;
+	bool bEnded;
+
+	Py_BEGIN_ALLOW_THREADS
+		bEnded = FPythonGraphBatch::Get().End(bCompile, Touched, Failed);
+	Py_END_ALLOW_THREADS
+
+	if (!bEnded)
+		return PyErr_Format(PyExc_Exception, "no graph batch to end");
+
+	PyObject *py_touched = ue_py_blueprints_to_list(Touched);
+	PyObject *py_failed = ue_py_blueprints_to_list(Failed);
+	PyObject *ret = Py_BuildValue((char *)"(OO)", py_touched, py_failed);
+	Py_DECREF(py_touched);
+	Py_DECREF(py_failed);
+	return ret;
+}
+
+PyObject *py_unreal_engine_compile_blueprints(PyObject *self, PyObject *args)
+{
+	PyObject *py_blueprints;
+	if (!PyArg_ParseTuple(args, "O:compile_blueprints", &py_blueprints))
+	{
+		return nullptr;
+	}
+
+	PyObject *py_iter = PyObject_GetIter(py_blueprints);
+	if (!py_iter)
+		return PyErr_Format(PyExc_Exception, "argument is not an iterable of UBlueprint");
+
+	TArray<UBlueprint *> Blueprints;
+	while (PyObject *py_item = PyIter_Next(py_iter))
+	{
+		UBlueprint *bp = ue_py_check_type<UBlueprint>(py_item);
+		Py_DECREF(py_item);
+		if (!bp)
+		{
+			Py_DECREF(py_iter);
+			return PyErr_Format(PyExc_Exception, "uobject is not a UBlueprint");
+		}
+		Blueprints.AddUnique(bp);
+	}
+	Py_DECREF(py_iter);
+	if (PyErr_Occurred())
+		return nullptr;
+
+	TArray<UBlueprint *> Failed;
+
+	Py_BEGIN_ALLOW_THREADS
+		FPythonGraphBatch::CompileBlueprints(Blueprints, Failed);
+	Py_END_ALLOW_THREADS
+
+	return ue_py_blueprints_to_list(Failed);
+}
+
+#endif
@@ -0,0 +1,60 @@
+#pragma once
+
+
+
+#include "UEPyModule.h"
+
+#if WITH_EDITOR
+
+class UEdGraph;
+class UEdGraphNode;
+class UBlueprint;
+
+/*
+
+Batched graph edits.
+
+Between unreal_engine.begin_graph_batch() and unreal_engine.end_graph_batch() the graph functions do not
+notify their changes: added nodes are not broadcast to the graph editors, node reconstructions are queued
+and blueprints are not marked as structurally modified. When the outermost batch ends every queued node is
+reconstructed once, every touched graph is notified once, every touched blueprint is marked as structurally
+modified once and (optionally) all of them are compiled together.
+
+*/
+class FPythonGraphBatch
+{
+public:
+	static FPythonGraphBatch &Get();
+
+	bool IsActive() const { return Depth > 0; }
+
+	void Begin();
+	// returns false if there is no batch to end
+	bool End(bool bCompile, TArray<UBlueprint *> &Touched, TArray<UBlueprint *> &Failed);
+
+	// replacements for UEdGraph::AddNode() and MarkBlueprintAsStructurallyModified(), deferred while a batch is active
+	void AddNode(UEdGraph *Graph, UEdGraphNode *Node);
+	void RemoveNode(UEdGraph *Graph, UEdGraphNode *Node);
+	void QueueReconstruction(UEdGraphNode *Node);
+	// the blueprint owning the graph (if any)
+	void MarkStructurallyModified(UEdGraph *Graph);
+	void MarkStructurallyModified(UBlueprint *Blueprint);
+
+	// compiles the blueprints in a single pass of the compilation manager (shared reinstancing and GC)
+	static void CompileBlueprints(const TArray<UBlueprint *> &Blueprints, TArray<UBlueprint *> &Failed);
+
+private:
+	FPythonGraphBatch();
+
+	int32 Depth;
+	TArray<TWeakObjectPtr<UEdGraphNode>> PendingReconstructions;
+	TSet<TWeakObjectPtr<UEdGraphNode>> PendingReconstructionsSet;
+	TSet<TWeakObjectPtr<UEdGraph>> ChangedGraphs;
+	TArray<TWeakObjectPtr<UBlueprint>> ModifiedBlueprints;
+};
+
+PyObject *py_unreal_engine_begin_graph_batch(PyObject *, PyObject *);
+PyObject *py_unreal_engine_end_graph_batch(PyObject *, PyObject *, PyObject *);
+PyObject *py_unreal_engine_compile_blueprints(PyObject *, PyObject *);
+
+#endif
@@ -108,6 +108,274 @@ static PyObject *py_ue_fbx_mesh_get_polygon_vertex_uvs(ue_PyFbxMesh *self, PyObj
 	return py_list;
 }
 
+static PyObject *py_ue_fbx_mesh_get_control_points_buffer(ue_PyFbxMesh *self, PyObject *args)
+{
+	const int num = self->fbx_mesh->GetControlPointsCount();
+	FbxVector4 *control_points = self->fbx_mesh->GetControlPoints();
+
+	PyObject *py_buf = PyByteArray_FromStringAndSize(nullptr, (Py_ssize_t)num * sizeof(float) * 3);
+	float *positions = (float *)PyByteArray_AsString(py_buf);
+	for (int i = 0; i < num; i++)
+	{
+		positions[i * 3] = control_points[i][0];
+		positions[i * 3 + 1] = control_points[i][1];
+		positions[i * 3 + 2] = control_points[i][2];
+	}
+	return py_buf;
+}
+
+static PyObject *py_ue_fbx_mesh_get_polygon_vertices_buffer(ue_PyFbxMesh *self, PyObject *args)
+{
+	return PyByteArray_FromStringAndSize((const char *)self->fbx_mesh->GetPolygonVertices(), (Py_ssize_t)self->fbx_mesh->GetPolygonVertexCount() * sizeof(int32));
+}
+
+static PyObject *py_ue_fbx_mesh_get_polygon_sizes_buffer(ue_PyFbxMesh *self, PyObject *args)
+{
+	const int num = self->fbx_mesh->GetPolygonCount();
+	PyObject *py_buf = PyByteArray_FromStringAndSize(nullptr, (Py_ssize_t)num * sizeof(int32));
+	int32 *sizes = (int32 *)PyByteArray_AsString(py_buf);
+	for (int i = 0; i < num; i++)
+	{
+		sizes[i] = self->fbx_mesh->GetPolygonSize(i);
+	}
+	return py_buf;
+}
+
+// resolve the mapping and reference modes of a layer element for a polygon vertex, -1 if unsupported
+template<typename T>
+static int ue_py_fbx_element_index(FbxLayerElementTemplate<T> *element, int polygon, int polygon_vertex, int control_point)
+{
+	int index;
+	switch (element->GetMappingMode())
+	{
+	case FbxLayerElement::eByControlPoint:
+		index = control_point;
+		break;
+	case FbxLayerElement::eByPolygonVertex:
+		index = polygon_vertex;
+		break;
+	case FbxLayerElement::eByPolygon:
+		index = polygon;
+		break;
+	case FbxLayerElement::eAllSame:
+		index = 0;
+		break;
+	default:
+		return -1;
+	}
+
+	if (element->GetReferenceMode() != FbxLayerElement::eDirect)
+	{
+		if (index >= element->GetIndexArray().GetCount())
+			return -1;
+		index = element->GetIndexArray().GetAt(index);
+	}
+
+	if (index < 0 || index >= element->GetDirectArray().GetCount())
+		return -1;
+	return index;
+}
+
+// fill a float buffer with one value per polygon vertex, missing values are zeroed
+template<typename T, int Components>
+static PyObject *ue_py_fbx_mesh_element_buffer(FbxMesh *mesh, FbxLayerElementTemplate<T> *element)
+{
+	const int num_polygon_vertices = mesh->GetPolygonVertexCount();
+	const int *polygon_vertices = mesh->GetPolygonVertices();
+
+	PyObject *py_buf = PyByteArray_FromStringAndSize(nullptr, (Py_ssize_t)num_polygon_vertices * sizeof(float) * Components);
+	float *values = (float *)PyByteArray_AsString(py_buf);
+	FMemory::Memzero(values, (SIZE_T)num_polygon_vertices * sizeof(float) * Components);
+
+	const FbxLayerElementArrayTemplate<T> &direct = element->GetDirectArray();
+	const int num_polygons = mesh->GetPolygonCount();
+	for (int p = 0; p < num_polygons; p++)
+	{
+		const int start = mesh->GetPolygonVertexIndex(p);
+		const int size = mesh->GetPolygonSize(p);
+		for (int v = start; v < start + size; v++)
+		{
+			const int index = ue_py_fbx_element_index(element, p, v, polygon_vertices[v]);
+			if (index < 0)
+				continue;
+			T value = direct.GetAt(index);
+			for (int c = 0; c < Components; c++)
+			{
+				values[v * Components + c] = value[c];
+			}
+		}
+	}
+
+	return py_buf;
+}
+
+static PyObject *py_ue_fbx_mesh_get_polygon_vertex_normals_buffer(ue_PyFbxMesh *self, PyObject *args)
+{
+	int layer = 0;
+	if (!PyArg_ParseTuple(args, "|i", &layer))
+		return nullptr;
+
+	FbxGeometryElementNormal *element = self->fbx_mesh->GetElementNormal(layer);
+	if (!element)
+	{
+		Py_RETURN_NONE;
+	}
+
+	return ue_py_fbx_mesh_element_buffer<FbxVector4, 3>(self->fbx_mesh, element);
+}
+
+static PyObject *py_ue_fbx_mesh_get_polygon_vertex_uvs_buffer(ue_PyFbxMesh *self, PyObject *args)
+{
+	char *uv_set;
+	if (!PyArg_ParseTuple(args, "s", &uv_set))
+		return nullptr;
+
+	FbxGeometryElementUV *element = self->fbx_mesh->GetElementUV(uv_set);
+	if (!element)
+	{
+		Py_RETURN_NONE;
+	}
+
+	return ue_py_fbx_mesh_element_buffer<FbxVector2, 2>(self->fbx_mesh, element);
+}
+
+static PyObject *py_ue_fbx_mesh_get_polygon_vertex_colors_buffer(ue_PyFbxMesh *self, PyObject *args)
+{
+	int layer = 0;
+	if (!PyArg_ParseTuple(args, "|i", &layer))
+		return nullptr;
+
+	FbxGeometryElementVertexColor *element = self->fbx_mesh->GetElementVertexColor(layer);
+	if (!element)
+	{
+		Py_RETURN_NONE;
+	}
+
+	return ue_py_fbx_mesh_element_buffer<FbxColor, 4>(self->fbx_mesh, element);
+}
+
+static PyObject *py_ue_fbx_mesh_get_skin_weights_buffers(ue_PyFbxMesh *self, PyObject *args)
+{
+	int max_influences = 0;
+	int skin_index = 0;
+	if (!PyArg_ParseTuple(args, "|ii", &max_influences, &skin_index))
+		return nullptr;
+
+	FbxSkin *skin = (FbxSkin *)self->fbx_mesh->GetDeformer(skin_index, FbxDeformer::eSkin);
+	if (!skin)
+	{
+		Py_RETURN_NONE;
+	}
+
+	const int num_control_points = self->fbx_mesh->GetControlPointsCount();
+	const int num_clusters = skin->GetClusterCount();
+
+	// gather the influences of every control point (compressed rows, control point major)
+	TArray<int32> offsets;
+	offsets.AddZeroed(num_control_points + 1);
+	for (int c = 0; c < num_clusters; c++)
+	{
+		FbxCluster *cluster = skin->GetCluster(c);
+		const int *cluster_indices = cluster->GetControlPointIndices();
+		for (int i = 0; i < cluster->GetControlPointIndicesCount(); i++)
+		{
+			if (cluster_indices[i] >= 0 && cluster_indices[i] < num_control_points)
+				offsets[cluster_indices[i] + 1]++;
+		}
+	}
+
+	int32 most_influences = 0;
+	for (int i = 0; i < num_control_points; i++)
+	{
+		most_influences = FMath::Max(most_influences, offsets[i + 1]);
+		offsets[i + 1] += offsets[i];
+	}
+
+	TArray<TPair<int32, float>> influences;
+	influences.SetNumUninitialized(offsets[num_control_points]);
+	TArray<int32> cursors(offsets.GetData(), num_control_points);
+	for (int c = 0; c < num_clusters; c++)
+	{
+		FbxCluster *cluster = skin->GetCluster(c);
+		const int *cluster_indices = cluster->GetControlPointIndices();
+		const double *cluster_weights = cluster->GetControlPointWeights();
+		for (int i = 0; i < cluster->GetControlPointIndicesCount(); i++)
+		{
+			if (cluster_indices[i] >= 0 && cluster_indices[i] < num_control_points)
+				influences[cursors[cluster_indices[i]]++] = TPair<int32, float>(c, (float)cluster_weights[i]);
+		}
+	}
+
+	const bool bTruncate = max_influences > 0 && max_influences < most_influences;
+	const int32 stride = max_influences > 0 ? max_influences : most_influences;
+
+	PyObject *py_indices = PyByteArray_FromStringAndSize(nullptr, (Py_ssize_t)num_control_points * stride * sizeof(int32));
+	PyObject *py_weights = PyByteArray_FromStringAndSize(nullptr, (Py_ssize_t)num_control_points * stride * sizeof(float));
+	int32 *indices = (int32 *)PyByteArray_AsString(py_indices);
+	float *weights = (float *)PyByteArray_AsString(py_weights);
+
+	for (int i = 0; i < num_control_points; i++)
+	{
+		TPair<int32, float> *first = influences.GetData() + offsets[i];
+		const int32 count = offsets[i + 1] - offsets[i];
+		int32 used = count;
+		float scale = 1;
+		if (bTruncate && count > stride)
+		{
+			// keep the strongest influences and renormalize them
+			TArrayView<TPair<int32, float>>(first, count).Sort([](const TPair<int32, float> &A, const TPair<int32, float> &B) { return A.Value > B.Value; });
+			used = stride;
+			float total = 0;
+			for (int32 j = 0; j < used; j++)
+				total += first[j].Value;
+			if (total > 0)
+				scale = 1 / total;
+		}
+
+		for (int32 j = 0; j < stride; j++)
+		{
+			if (j < used)
+			{
+				indices[i * stride + j] = first[j].Key;
+				weights[i * stride + j] = first[j].Value * scale;
+			}
+			else
+			{
+				indices[i * stride + j] = -1;
+				weights[i * stride + j] = 0;
+			}
+		}
+	}
+
+	PyObject *py_bones = PyList_New(num_clusters);
+	for (int c = 0; c < num_clusters; c++)
+	{
+		FbxNode *link = skin->GetCluster(c)->GetLink();
+		if (link)
+		{
+			PyList_SetItem(py_bones, c, py_ue_new_fbx_node(link));
+		}
+		else
+		{
+			Py_INCREF(Py_None);
+			PyList_SetItem(py_bones, c, Py_None);
+		}
+	}
+
+	PyObject *py_dict = PyDict_New();
+	PyDict_SetItemString(py_dict, "indices", py_indices);
+	Py_DECREF(py_indices);
+	PyDict_SetItemString(py_dict, "weights", py_weights);
+	Py_DECREF(py_weights);
+	PyObject *py_influences = PyLong_FromLong(stride);
+	PyDict_SetItemString(py_dict, "influences", py_influences);
+	Py_DECREF(py_influences);
+	PyDict_SetItemString(py_dict, "bones", py_bones);
+	Py_DECREF(py_bones);
+
+	return py_dict;
+}
+
 static PyObject *py_ue_fbx_mesh_remove_bad_polygons(ue_PyFbxMesh *self, PyObject *args)
 {
 	self->fbx_mesh->RemoveBadPolygons();
@@ -125,6 +393,13 @@ static PyMethodDef ue_PyFbxMesh_methods[] = {
 	{ "get_uv_set_names", (PyCFunction)py_ue_fbx_mesh_get_uv_set_names, METH_VARARGS, "" },
 	{ "get_name", (PyCFunction)py_ue_fbx_mesh_get_name, METH_VARARGS, "" },
 	{ "get_polygon_vertex_normals", (PyCFunction)py_ue_fbx_mesh_get_polygon_vertex_normals, METH_VARARGS, "" },
+	{ "get_control_points_buffer", (PyCFunction)py_ue_fbx_mesh_get_control_points_buffer, METH_VARARGS, "" },
+	{ "get_polygon_vertices_buffer", (PyCFunction)py_ue_fbx_mesh_get_polygon_vertices_buffer, METH_VARARGS, "" },
+	{ "get_polygon_sizes_buffer", (PyCFunction)py_ue_fbx_mesh_get_polygon_sizes_buffer, METH_VARARGS, "" },
+	{ "get_polygon_vertex_normals_buffer", (PyCFunction)py_ue_fbx_mesh_get_polygon_vertex_normals_buffer, METH_VARARGS, "" },
+	{ "get_polygon_vertex_uvs_buffer", (PyCFunction)py_ue_fbx_mesh_get_polygon_vertex_uvs_buffer, METH_VARARGS, "" },
+	{ "get_polygon_vertex_colors_buffer", (PyCFunction)py_ue_fbx_mesh_get_polygon_vertex_colors_buffer, METH_VARARGS, "" },
+	{ "get_skin_weights_buffers", (PyCFunction)py_ue_fbx_mesh_get_skin_weights_buffers, METH_VARARGS, "" },
 	{ NULL }  /* Sentinel */
 };
 
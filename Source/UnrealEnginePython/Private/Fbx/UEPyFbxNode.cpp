@@ -101,6 +101,18 @@ static PyObject *py_ue_fbx_node_get_mesh(ue_PyFbxNode *self, PyObject *args)
 	return py_ue_new_fbx_mesh(fbx_mesh);
 }
 
+FTransform py_ue_fbx_matrix_to_transform(const FbxAMatrix &matrix)
+{
+	FTransform transform;
+	FbxVector4 mt = matrix.GetT();
+	FbxQuaternion mq = matrix.GetQ();
+	FbxVector4 ms = matrix.GetS();
+	transform.SetTranslation(FVector(mt[0], -mt[1], mt[2]));
+	transform.SetRotation(FQuat(mq[0], -mq[1], mq[2], -mq[3]));
+	transform.SetScale3D(FVector(ms[0], ms[1], ms[2]));
+	return transform;
+}
+
 static PyObject *py_ue_fbx_node_evaluate_local_transform(ue_PyFbxNode *self, PyObject *args)
 {
 	float t;
@@ -111,14 +123,7 @@ static PyObject *py_ue_fbx_node_evaluate_local_transform(ue_PyFbxNode *self, PyO
 	FbxTime time;
 	time.SetSecondDouble(t);
 	FbxAMatrix& matrix = self->fbx_node->EvaluateLocalTransform(time);
-	FTransform transform;
-	FbxVector4 mt = matrix.GetT();
-	FbxQuaternion mq = matrix.GetQ();
-	FbxVector4 ms = matrix.GetS();
-	transform.SetTranslation(FVector(mt[0], -mt[1], mt[2]));
-	transform.SetRotation(FQuat(mq[0], -mq[1], mq[2], -mq[3]));
-	transform.SetScale3D(FVector(ms[0], ms[1], ms[2]));
-	return py_ue_new_ftransform(transform);
+	return py_ue_new_ftransform(py_ue_fbx_matrix_to_transform(matrix));
 }
 
 static PyObject *py_ue_fbx_node_evaluate_global_transform(ue_PyFbxNode *self, PyObject *args)
@@ -131,14 +136,7 @@ static PyObject *py_ue_fbx_node_evaluate_global_transform(ue_PyFbxNode *self, Py
 	FbxTime time;
 	time.SetSecondDouble(t);
 	FbxAMatrix& matrix = self->fbx_node->EvaluateGlobalTransform(time);
-	FTransform transform;
-	FbxVector4 mt = matrix.GetT();
-	FbxQuaternion mq = matrix.GetQ();
-	FbxVector4 ms = matrix.GetS();
-	transform.SetTranslation(FVector(mt[0], -mt[1], mt[2]));
-	transform.SetRotation(FQuat(mq[0], -mq[1], mq[2], -mq[3]));
-	transform.SetScale3D(FVector(ms[0], ms[1], ms[2]));
-	return py_ue_new_ftransform(transform);
+	return py_ue_new_ftransform(py_ue_fbx_matrix_to_transform(matrix));
 }
 
 static PyMethodDef ue_PyFbxNode_methods[] = {
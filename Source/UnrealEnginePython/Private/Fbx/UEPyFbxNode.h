@@ -26,5 +26,8 @@ PyObject *py_ue_new_fbx_node(FbxNode *);
 
 ue_PyFbxNode *py_ue_is_fbx_node(PyObject *);
 
+// converts an fbx matrix to an unreal transform (mirroring the Y axis)
+FTransform py_ue_fbx_matrix_to_transform(const FbxAMatrix &);
+
 #endif
 #endif
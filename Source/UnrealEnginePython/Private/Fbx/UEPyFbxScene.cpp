@@ -5,6 +5,7 @@
 #if WITH_EDITOR
 
 #include "UEPyFbx.h"
+#include "Wrappers/UEPyFMathArrays.h"
 
 static PyObject *py_ue_fbx_scene_get_root_node(ue_PyFbxScene *self, PyObject *args)
 {
@@ -90,6 +91,87 @@ static PyObject *py_ue_fbx_scene_triangulate(ue_PyFbxScene *self, PyObject *args
 	Py_RETURN_FALSE;
 }
 
+static PyObject *py_ue_fbx_scene_evaluate_transforms(ue_PyFbxScene *self, PyObject *args, PyObject *kwargs)
+{
+	double start;
+	double end;
+	double frame_rate = 30;
+	PyObject *py_local = nullptr;
+	PyObject *py_nodes = nullptr;
+
+	static char *kw_names[] = { (char *)"start", (char *)"end", (char *)"frame_rate", (char *)"local", (char *)"nodes", nullptr };
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "dd|dOO:evaluate_transforms", kw_names, &start, &end, &frame_rate, &py_local, &py_nodes))
+	{
+		return nullptr;
+	}
+
+	if (frame_rate <= 0)
+		return PyErr_Format(PyExc_Exception, "frame_rate must be greater than 0");
+
+	if (end < start)
+		return PyErr_Format(PyExc_Exception, "end must not be lower than start");
+
+	const bool bLocal = py_local && PyObject_IsTrue(py_local);
+
+	TArray<FbxNode *> nodes;
+	if (py_nodes && py_nodes != Py_None)
+	{
+		PyObject *py_iter = PyObject_GetIter(py_nodes);
+		if (!py_iter)
+			return PyErr_Format(PyExc_Exception, "nodes must be an iterable of FbxNode");
+		while (PyObject *py_item = PyIter_Next(py_iter))
+		{
+			ue_PyFbxNode *py_fbx_node = py_ue_is_fbx_node(py_item);
+			Py_DECREF(py_item);
+			if (!py_fbx_node)
+			{
+				Py_DECREF(py_iter);
+				return PyErr_Format(PyExc_Exception, "nodes must be an iterable of FbxNode");
+			}
+			nodes.Add(py_fbx_node->fbx_node);
+		}
+		Py_DECREF(py_iter);
+		if (PyErr_Occurred())
+			return nullptr;
+	}
+	else
+	{
+		for (int i = 0; i < self->fbx_scene->GetNodeCount(); i++)
+		{
+			nodes.Add(self->fbx_scene->GetNode(i));
+		}
+	}
+
+	// samples are frame major: all of the nodes at frame 0, then all of the nodes at frame 1...
+	const int32 num_frames = (int32)FMath::FloorToDouble((end - start) * frame_rate + 0.5) + 1;
+	TArray<FTransform> transforms;
+	transforms.SetNumUninitialized(num_frames * nodes.Num());
+
+	FbxAnimEvaluator *evaluator = self->fbx_scene->GetAnimationEvaluator();
+	FbxTime time;
+	for (int32 frame = 0; frame < num_frames; frame++)
+	{
+		time.SetSecondDouble(start + frame / frame_rate);
+		for (int32 i = 0; i < nodes.Num(); i++)
+		{
+			const FbxAMatrix &matrix = bLocal ? evaluator->GetNodeLocalTransform(nodes[i], time) : evaluator->GetNodeGlobalTransform(nodes[i], time);
+			transforms[frame * nodes.Num() + i] = py_ue_fbx_matrix_to_transform(matrix);
+		}
+	}
+
+	PyObject *py_list = PyList_New(nodes.Num());
+	for (int32 i = 0; i < nodes.Num(); i++)
+	{
+		PyList_SetItem(py_list, i, py_ue_new_fbx_node(nodes[i]));
+	}
+
+	PyObject *py_transforms = py_ue_new_ftransform_array_from(transforms);
+	PyObject *ret = Py_BuildValue((char *)"(OOi)", py_transforms, py_list, num_frames);
+	Py_DECREF(py_transforms);
+	Py_DECREF(py_list);
+	return ret;
+}
+
 static PyMethodDef ue_PyFbxScene_methods[] = {
 	{ "convert", (PyCFunction)py_ue_fbx_scene_convert, METH_VARARGS, "" },
 	{ "triangulate", (PyCFunction)py_ue_fbx_scene_triangulate, METH_VARARGS, "" },
@@ -98,6 +180,7 @@ static PyMethodDef ue_PyFbxScene_methods[] = {
 	{ "get_src_object", (PyCFunction)py_ue_fbx_scene_get_src_object, METH_VARARGS, "" },
 	{ "get_pose_count", (PyCFunction)py_ue_fbx_scene_get_pose_count, METH_VARARGS, "" },
 	{ "get_pose", (PyCFunction)py_ue_fbx_scene_get_pose, METH_VARARGS, "" },
+	{ "evaluate_transforms", (PyCFunction)py_ue_fbx_scene_evaluate_transforms, METH_VARARGS | METH_KEYWORDS, "" },
 	{ NULL }  /* Sentinel */
 };
 
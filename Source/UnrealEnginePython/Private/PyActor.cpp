@@ -2,6 +2,7 @@
 
 #include "PyActor.h"
 #include "UEPyModule.h"
+#include "UEPyModuleRegistry.h"
 
 APyActor::APyActor()
 {
@@ -28,23 +29,13 @@ void APyActor::PreInitializeComponents()
 		return;
 	}
 
-	PyObject *py_actor_module = PyImport_ImportModule(TCHAR_TO_UTF8(*PythonModule));
+	PyObject *py_actor_module = FPythonModuleRegistry::Get().Import(PythonModule);
 	if (!py_actor_module)
 	{
 		unreal_engine_py_log_error();
 		return;
 	}
 
-#if WITH_EDITOR
-	// todo implement autoreload with a dictionary of module timestamps
-	py_actor_module = PyImport_ReloadModule(py_actor_module);
-	if (!py_actor_module)
-	{
-		unreal_engine_py_log_error();
-		return;
-	}
-#endif
-
 	if (PythonClass.IsEmpty())
 		return;
 
@@ -65,6 +56,7 @@ void APyActor::PreInitializeComponents()
 	}
 
 	py_uobject->py_proxy = py_actor_instance;
+	FPythonModuleRegistry::Get().TrackInstance(PythonModule, this);
 
 	PyObject_SetAttrString(py_actor_instance, (char*)"uobject", (PyObject *)py_uobject);
 
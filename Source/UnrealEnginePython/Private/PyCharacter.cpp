@@ -2,6 +2,7 @@
 
 #include "PyCharacter.h"
 #include "UEPyModule.h"
+#include "UEPyModuleRegistry.h"
 #include "Components/InputComponent.h"
 
 APyCharacter::APyCharacter()
@@ -35,23 +36,13 @@ void APyCharacter::PreInitializeComponents()
 		return;
 	}
 
-	PyObject *py_character_module = PyImport_ImportModule(TCHAR_TO_UTF8(*PythonModule));
+	PyObject *py_character_module = FPythonModuleRegistry::Get().Import(PythonModule);
 	if (!py_character_module)
 	{
 		unreal_engine_py_log_error();
 		return;
 	}
 
-#if WITH_EDITOR
-	// todo implement autoreload with a dictionary of module timestamps
-	py_character_module = PyImport_ReloadModule(py_character_module);
-	if (!py_character_module)
-	{
-		unreal_engine_py_log_error();
-		return;
-	}
-#endif
-
 	if (PythonClass.IsEmpty())
 		return;
 
@@ -72,6 +63,7 @@ void APyCharacter::PreInitializeComponents()
 	}
 
 	py_uobject->py_proxy = py_character_instance;
+	FPythonModuleRegistry::Get().TrackInstance(PythonModule, this);
 
 	PyObject_SetAttrString(py_character_instance, (char *)"uobject", (PyObject *)py_uobject);
 
@@ -3,6 +3,7 @@
 #include "PyCommandlet.h"
 
 #include "UEPyModule.h"
+#include "UEPyShards.h"
 #if WITH_EDITOR
 #include "Editor.h"
 #endif
@@ -17,6 +18,23 @@ UPyCommandlet::UPyCommandlet(const FObjectInitializer& ObjectInitializer)
 
 int32 UPyCommandlet::Main(const FString& CommandLine)
 {
+	TArray<FString> Tokens, Switches;
+	TMap<FString, FString> Params;
+	ParseCommandLine(*CommandLine, Tokens, Switches, Params);
+
+	if (Tokens.Num() == 0)
+	{
+		UE_LOG(LogPython, Error, TEXT("Usage: -run=py <script.py> [args]"));
+		return -1;
+	}
+
+	// the coordinator only spawns and monitors the shard processes, it does not need python
+	if (Params.Contains(TEXT("PyShards")))
+	{
+		FPythonShardCoordinator Coordinator(Params);
+		return Coordinator.Run();
+	}
+
 	FScopePythonGIL gil;
 
 #if WITH_EDITOR
@@ -25,9 +43,11 @@ int32 UPyCommandlet::Main(const FString& CommandLine)
 
 #endif
 
-	TArray<FString> Tokens, Switches;
-	TMap<FString, FString> Params;
-	ParseCommandLine(*CommandLine, Tokens, Switches, Params);
+	if (FString *ShardFile = Params.Find(TEXT("PyShard")))
+	{
+		if (!FPythonShard::Get().Load(ShardFile->TrimQuotes()))
+			return -1;
+	}
 
 	FString Filepath = Tokens[0];
 	if (!FPaths::FileExists(*Filepath))
@@ -45,6 +65,7 @@ int32 UPyCommandlet::Main(const FString& CommandLine)
 #else
 	FString PyCommandLine = myMatcher.GetCaptureGroup(0).Trim().TrimTrailing();
 #endif
+	PyCommandLine = FPythonShardCoordinator::StripSwitches(PyCommandLine).TrimStartAndEnd();
 
 	TArray<FString> PyArgv;
 	PyArgv.Add(FString());
@@ -89,7 +110,7 @@ int32 UPyCommandlet::Main(const FString& CommandLine)
 	for (int i = 0; i < PyArgv.Num(); i++)
 	{
 #if PY_MAJOR_VERSION >= 3
-		argv[i] = (wchar_t*)malloc(PyArgv[i].Len() + 1);
+		argv[i] = (wchar_t*)malloc((PyArgv[i].Len() + 1) * sizeof(wchar_t));
 #if PLATFORM_MAC || PLATFORM_LINUX
 	#if ENGINE_MAJOR_VERSION == 5 || (ENGINE_MAJOR_VERSION == 4 && ENGINE_MINOR_VERSION >= 20)
 		wcsncpy(argv[i], (const wchar_t *) TCHAR_TO_WCHAR(*PyArgv[i].ReplaceEscapedCharWithChar()), PyArgv[i].Len() + 1);
@@ -120,5 +141,10 @@ int32 UPyCommandlet::Main(const FString& CommandLine)
 	PythonModule.RunFile(TCHAR_TO_UTF8(*Filepath));
 
 	Py_END_ALLOW_THREADS;
+
+	if (FPythonShard::Get().IsActive())
+	{
+		FPythonShard::Get().Done();
+	}
 	return 0;
 }
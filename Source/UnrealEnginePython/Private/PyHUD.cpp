@@ -1,6 +1,7 @@
 
 #include "PyHUD.h"
 #include "UEPyModule.h"
+#include "UEPyModuleRegistry.h"
 #include "PythonDelegate.h"
 
 APyHUD::APyHUD()
@@ -32,23 +33,13 @@ void APyHUD::BeginPlay()
 		return;
 	}
 
-	PyObject *py_hud_module = PyImport_ImportModule(TCHAR_TO_UTF8(*PythonModule));
+	PyObject *py_hud_module = FPythonModuleRegistry::Get().Import(PythonModule);
 	if (!py_hud_module)
 	{
 		unreal_engine_py_log_error();
 		return;
 	}
 
-#if WITH_EDITOR
-	// todo implement autoreload with a dictionary of module timestamps
-	py_hud_module = PyImport_ReloadModule(py_hud_module);
-	if (!py_hud_module)
-	{
-		unreal_engine_py_log_error();
-		return;
-	}
-#endif
-
 	if (PythonClass.IsEmpty())
 		return;
 
@@ -69,6 +60,7 @@ void APyHUD::BeginPlay()
 	}
 
 	py_uobject->py_proxy = py_hud_instance;
+	FPythonModuleRegistry::Get().TrackInstance(PythonModule, this);
 
 	PyObject_SetAttrString(py_hud_instance, (char*)"uobject", (PyObject *)py_uobject);
 
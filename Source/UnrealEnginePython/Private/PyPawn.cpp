@@ -1,6 +1,7 @@
 
 #include "PyPawn.h"
 #include "UEPyModule.h"
+#include "UEPyModuleRegistry.h"
 
 APyPawn::APyPawn()
 {
@@ -47,21 +48,12 @@ void APyPawn::PreInitializeComponents()
 		return;
 	}
 
-	PyObject *py_pawn_module = PyImport_ImportModule(TCHAR_TO_UTF8(*PythonModule));
+	PyObject *py_pawn_module = FPythonModuleRegistry::Get().Import(PythonModule);
 	if (!py_pawn_module) {
 		unreal_engine_py_log_error();
 		return;
 	}
 
-#if WITH_EDITOR
-	// todo implement autoreload with a dictionary of module timestamps
-	py_pawn_module = PyImport_ReloadModule(py_pawn_module);
-	if (!py_pawn_module) {
-		unreal_engine_py_log_error();
-		return;
-	}
-#endif
-
 	if (PythonClass.IsEmpty())
 		return;
 
@@ -80,6 +72,7 @@ void APyPawn::PreInitializeComponents()
 	}
 
 	py_uobject->py_proxy = py_pawn_instance;
+	FPythonModuleRegistry::Get().TrackInstance(PythonModule, this);
 
 	PyObject_SetAttrString(py_pawn_instance, (char *)"uobject", (PyObject *)py_uobject);
 
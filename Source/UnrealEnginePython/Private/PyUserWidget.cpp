@@ -1,5 +1,6 @@
 
 #include "PyUserWidget.h"
+#include "UEPyModuleRegistry.h"
 #include "PyNativeWidgetHost.h"
 
 #include "PythonDelegate.h"
@@ -35,21 +36,12 @@ void UPyUserWidget::NativeConstruct()
 		return;
 	}
 
-	PyObject *py_user_widget_module = PyImport_ImportModule(TCHAR_TO_UTF8(*PythonModule));
+	PyObject *py_user_widget_module = FPythonModuleRegistry::Get().Import(PythonModule);
 	if (!py_user_widget_module) {
 		unreal_engine_py_log_error();
 		return;
 	}
 
-#if WITH_EDITOR
-	// todo implement autoreload with a dictionary of module timestamps
-	py_user_widget_module = PyImport_ReloadModule(py_user_widget_module);
-	if (!py_user_widget_module) {
-		unreal_engine_py_log_error();
-		return;
-	}
-#endif
-
 	if (PythonClass.IsEmpty())
 		return;
 
@@ -68,6 +60,7 @@ void UPyUserWidget::NativeConstruct()
 	}
 
 	py_uobject->py_proxy = py_user_widget_instance;
+	FPythonModuleRegistry::Get().TrackInstance(PythonModule, this);
 
 	PyObject_SetAttrString(py_user_widget_instance, (char*)"uobject", (PyObject *)py_uobject);
 
@@ -1,6 +1,7 @@
 
 #include "PythonComponent.h"
 #include "UEPyModule.h"
+#include "UEPyModuleRegistry.h"
 
 UPythonComponent::UPythonComponent()
 {
@@ -34,23 +35,13 @@ void UPythonComponent::InitializePythonComponent()
 		return;
 	}
 
-	PyObject *py_component_module = PyImport_ImportModule(TCHAR_TO_UTF8(*PythonModule));
+	PyObject *py_component_module = FPythonModuleRegistry::Get().Import(PythonModule);
 	if (!py_component_module)
 	{
 		unreal_engine_py_log_error();
 		return;
 	}
 
-#if WITH_EDITOR
-	// todo implement autoreload with a dictionary of module timestamps
-	py_component_module = PyImport_ReloadModule(py_component_module);
-	if (!py_component_module)
-	{
-		unreal_engine_py_log_error();
-		return;
-	}
-#endif
-
 	if (PythonClass.IsEmpty())
 		return;
 
@@ -71,6 +62,7 @@ void UPythonComponent::InitializePythonComponent()
 	}
 
 	py_uobject->py_proxy = py_component_instance;
+	FPythonModuleRegistry::Get().TrackInstance(PythonModule, this);
 
 	PyObject_SetAttrString(py_component_instance, (char *)"uobject", (PyObject *)py_uobject);
 
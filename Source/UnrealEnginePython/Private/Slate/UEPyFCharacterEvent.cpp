@@ -101,6 +101,7 @@ void ue_python_init_fcharacter_event(PyObject *ue_module)
 
 PyObject *py_ue_new_fcharacter_event(FCharacterEvent key_event)
 {
+	ue_python_ensure_submodule(EPythonSubmodule::Slate);
 	ue_PyFCharacterEvent *ret = (ue_PyFCharacterEvent *)PyObject_New(ue_PyFCharacterEvent, &ue_PyFCharacterEventType);
 	new(&ret->character_event) FCharacterEvent(key_event);
 	new(&ret->f_input.input) FInputEvent(key_event);
@@ -90,6 +90,7 @@ ue_PyFGeometry *py_ue_is_fgeometry(PyObject *obj)
 
 PyObject *py_ue_new_fgeometry(FGeometry geometry)
 {
+	ue_python_ensure_submodule(EPythonSubmodule::Slate);
 	ue_PyFGeometry *ret = (ue_PyFGeometry *)PyObject_New(ue_PyFGeometry, &ue_PyFGeometryType);
 	ret->geometry = geometry;
 	return (PyObject *)ret;
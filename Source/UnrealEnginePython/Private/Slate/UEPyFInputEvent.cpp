@@ -90,6 +90,7 @@ void ue_python_init_finput_event(PyObject *ue_module)
 
 PyObject *py_ue_new_finput_event(FInputEvent input)
 {
+	ue_python_ensure_submodule(EPythonSubmodule::Slate);
 	ue_PyFInputEvent *ret = (ue_PyFInputEvent *)PyObject_New(ue_PyFInputEvent, &ue_PyFInputEventType);
 	new(&ret->input) FInputEvent(input);
 	return (PyObject *)ret;
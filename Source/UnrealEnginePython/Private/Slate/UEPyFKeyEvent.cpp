@@ -93,6 +93,7 @@ void ue_python_init_fkey_event(PyObject *ue_module)
 
 PyObject *py_ue_new_fkey_event(FKeyEvent key_event)
 {
+	ue_python_ensure_submodule(EPythonSubmodule::Slate);
 	ue_PyFKeyEvent *ret = (ue_PyFKeyEvent *)PyObject_New(ue_PyFKeyEvent, &ue_PyFKeyEventType);
 	new(&ret->key_event) FKeyEvent(key_event);
 	new(&ret->f_input.input) FInputEvent(key_event);
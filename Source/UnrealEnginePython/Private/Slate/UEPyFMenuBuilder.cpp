@@ -245,6 +245,7 @@ void ue_python_init_fmenu_builder(PyObject* ue_module)
 
 PyObject* py_ue_new_fmenu_builder(FMenuBuilder menu_builder)
 {
+	ue_python_ensure_submodule(EPythonSubmodule::Slate);
 	ue_PyFMenuBuilder* ret = (ue_PyFMenuBuilder*)PyObject_New(ue_PyFMenuBuilder, &ue_PyFMenuBuilderType);
 	new(&ret->menu_builder) FMenuBuilder(menu_builder);
 	return (PyObject*)ret;
@@ -1,4 +1,5 @@
 #include "UEPyFModifierKeysState.h"
+#include "UEPyModule.h"
 
 static PyObject *py_ue_fmodifier_keys_state_are_caps_locked(ue_PyFModifierKeysState *self, PyObject * args)
 {
@@ -126,6 +127,7 @@ void ue_python_init_fmodifier_keys_state(PyObject *ue_module)
 
 PyObject *py_ue_new_fmodifier_keys_state(FModifierKeysState modifier)
 {
+	ue_python_ensure_submodule(EPythonSubmodule::Slate);
 	ue_PyFModifierKeysState *ret = (ue_PyFModifierKeysState *)PyObject_New(ue_PyFModifierKeysState, &ue_PyFModifierKeysStateType);
 	new(&ret->modifier) FModifierKeysState(modifier);
 	return (PyObject *)ret;
@@ -19,6 +19,192 @@ _Pragma("clang diagnostic ignored \"-Wshadow\"")
 
 static FSlateBrush global_simple_brush;
 
+bool ue_py_fpaint_context_get_points(PyObject *py_points, TArray<FVector2D> &points)
+{
+	// fast path: packed float32/float64 buffer (array.array('f'), numpy...)
+	if (PyObject_CheckBuffer(py_points))
+	{
+		Py_buffer py_buf;
+		if (PyObject_GetBuffer(py_points, &py_buf, PyBUF_FORMAT) < 0)
+			return false;
+
+		// skip the native byte order/alignment prefixes
+		const char *format = py_buf.format;
+		if (format && (format[0] == '@' || format[0] == '=' || format[0] == '<'))
+			format++;
+
+		bool is_double = false;
+		if (format && !strcmp(format, "d"))
+		{
+			is_double = true;
+		}
+		else if (!format || strcmp(format, "f"))
+		{
+			PyBuffer_Release(&py_buf);
+			PyErr_SetString(PyExc_Exception, "buffer format must be 'f' (float32) or 'd' (float64)");
+			return false;
+		}
+
+		const Py_ssize_t pair_size = (is_double ? sizeof(double) : sizeof(float)) * 2;
+		if (py_buf.len % pair_size != 0)
+		{
+			PyBuffer_Release(&py_buf);
+			PyErr_SetString(PyExc_Exception, "buffer size must be a multiple of an x, y pair");
+			return false;
+		}
+
+		int32 num = (int32)(py_buf.len / pair_size);
+		points.Reserve(points.Num() + num);
+		if (is_double)
+		{
+			const double *data = (const double *)py_buf.buf;
+			for (int32 i = 0; i < num; i++)
+			{
+				points.Add(FVector2D(data[i * 2], data[i * 2 + 1]));
+			}
+		}
+		else
+		{
+			const float *data = (const float *)py_buf.buf;
+			for (int32 i = 0; i < num; i++)
+			{
+				points.Add(FVector2D(data[i * 2], data[i * 2 + 1]));
+			}
+		}
+		PyBuffer_Release(&py_buf);
+		return true;
+	}
+
+	PyObject *py_iter = PyObject_GetIter(py_points);
+	if (!py_iter)
+	{
+		PyErr_SetString(PyExc_Exception, "argument is not an iterable of tuples");
+		return false;
+	}
+
+	while (PyObject *py_item = PyIter_Next(py_iter))
+	{
+		if (!PyTuple_Check(py_item))
+		{
+			Py_DECREF(py_item);
+			Py_DECREF(py_iter);
+			PyErr_SetString(PyExc_Exception, "iterable item is not a tuple");
+			return false;
+		}
+
+		float x, y;
+		if (!PyArg_ParseTuple(py_item, "ff", &x, &y))
+		{
+			Py_DECREF(py_item);
+			Py_DECREF(py_iter);
+			return false;
+		}
+		Py_DECREF(py_item);
+		points.Add(FVector2D(x, y));
+	}
+	Py_DECREF(py_iter);
+
+	return !PyErr_Occurred();
+}
+
+void FPythonSlateDrawBuffer::Reset()
+{
+	Commands.Reset();
+	Points.Reset();
+	Polylines.Reset();
+	Brushes.Reset();
+	Texts.Reset();
+}
+
+void FPythonSlateDrawBuffer::AddLines(TArray<FVector2D> &InPoints, const FLinearColor &Color, bool bAntialias, float Thickness, bool bSegments)
+{
+	FCommand Command;
+	Command.Type = bSegments ? ECommandType::Segments : ECommandType::Lines;
+	Command.First = Polylines.Num();
+	Command.Num = bSegments ? InPoints.Num() / 2 : 1;
+	Command.Color = Color;
+	Command.Thickness = Thickness;
+	Command.bAntialias = bAntialias;
+	Command.ResourceIndex = INDEX_NONE;
+	if (bSegments)
+	{
+		for (int32 i = 0; i < Command.Num; i++)
+		{
+			Polylines.Emplace(InPoints.GetData() + i * 2, 2);
+		}
+	}
+	else
+	{
+		Polylines.Add(InPoints);
+	}
+	Commands.Add(Command);
+}
+
+void FPythonSlateDrawBuffer::AddBoxes(TArray<FVector2D> &InRects, const FLinearColor &Color, const FSlateBrush *Brush)
+{
+	FCommand Command;
+	Command.Type = ECommandType::Boxes;
+	Command.First = Points.Num();
+	Command.Num = InRects.Num() & ~1;
+	Command.Color = Color;
+	Command.Thickness = 0;
+	Command.bAntialias = false;
+	Command.ResourceIndex = Brushes.Add(Brush ? *Brush : global_simple_brush);
+	Points.Append(InRects.GetData(), Command.Num);
+	Commands.Add(Command);
+}
+
+void FPythonSlateDrawBuffer::AddText(const FVector2D &Position, const FText &Text, const FSlateFontInfo &Font, const FLinearColor &Color)
+{
+	FCommand Command;
+	Command.Type = ECommandType::Text;
+	Command.First = Points.Add(Position);
+	Command.Num = 1;
+	Command.Color = Color;
+	Command.Thickness = 0;
+	Command.bAntialias = false;
+	Command.ResourceIndex = Texts.Add(TPair<FText, FSlateFontInfo>(Text, Font));
+	Commands.Add(Command);
+}
+
+int32 FPythonSlateDrawBuffer::Replay(const FGeometry &AllottedGeometry, FSlateWindowElementList &OutDrawElements, int32 LayerId) const
+{
+	int32 Elements = 0;
+	const FPaintGeometry PaintGeometry = AllottedGeometry.ToPaintGeometry();
+
+	for (const FCommand &Command : Commands)
+	{
+		const FVector2D *CommandPoints = Points.GetData() + Command.First;
+		switch (Command.Type)
+		{
+		case ECommandType::Lines:
+		case ECommandType::Segments:
+			for (int32 i = 0; i < Command.Num; i++)
+			{
+				FSlateDrawElement::MakeLines(OutDrawElements, LayerId, PaintGeometry,
+					Polylines[Command.First + i], ESlateDrawEffect::None, Command.Color, Command.bAntialias, Command.Thickness);
+				Elements++;
+			}
+			break;
+		case ECommandType::Boxes:
+			for (int32 i = 0; i < Command.Num; i += 2)
+			{
+				FSlateDrawElement::MakeBox(OutDrawElements, LayerId, AllottedGeometry.ToPaintGeometry(CommandPoints[i], CommandPoints[i + 1]),
+					&Brushes[Command.ResourceIndex], ESlateDrawEffect::None, Command.Color);
+				Elements++;
+			}
+			break;
+		case ECommandType::Text:
+			FSlateDrawElement::MakeText(OutDrawElements, LayerId, AllottedGeometry.ToOffsetPaintGeometry(CommandPoints[0]),
+				Texts[Command.ResourceIndex].Key, Texts[Command.ResourceIndex].Value, ESlateDrawEffect::None, Command.Color);
+			Elements++;
+			break;
+		}
+	}
+
+	return Elements;
+}
+
 static PyObject *py_ue_fpaint_context_draw_line(ue_PyFPaintContext *self, PyObject * args)
 {
 	float x1, y1, x2, y2;
@@ -209,28 +395,8 @@ static PyObject *py_ue_fpaint_context_draw_lines(ue_PyFPaintContext *self, PyObj
 		return nullptr;
 
 	TArray<FVector2D> points;
-
-	PyObject *py_iter = PyObject_GetIter(py_points);
-	if (!py_iter)
-		return PyErr_Format(PyExc_Exception, "argument is not an iterable of tuples");
-
-	while (PyObject *py_item = PyIter_Next(py_iter))
-	{
-		if (!PyTuple_Check(py_item))
-		{
-			return PyErr_Format(PyExc_Exception, "iterable item is not a tuple");
-			Py_DECREF(py_iter);
-		}
-
-		float x, y;
-		if (!PyArg_ParseTuple(py_item, "ff", &x, &y))
-		{
-			Py_DECREF(py_iter);
-			return nullptr;
-		}
-		points.Add(FVector2D(x, y));
-	}
-	Py_DECREF(py_iter);
+	if (!ue_py_fpaint_context_get_points(py_points, points))
+		return nullptr;
 
 	FLinearColor tint = FLinearColor::White;
 
@@ -322,6 +488,7 @@ void ue_python_init_fpaint_context(PyObject *ue_module)
 
 PyObject *py_ue_new_fpaint_context(FPaintContext paint_context)
 {
+	ue_python_ensure_submodule(EPythonSubmodule::Slate);
 	ue_PyFPaintContext *ret = (ue_PyFPaintContext *)PyObject_New(ue_PyFPaintContext, &ue_PyFPaintContextType);
 	ret->paint_context = paint_context;
 	return (PyObject *)ret;
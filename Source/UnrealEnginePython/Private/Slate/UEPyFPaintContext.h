@@ -14,3 +14,52 @@ typedef struct
 void ue_python_init_fpaint_context(PyObject *);
 
 PyObject *py_ue_new_fpaint_context(FPaintContext);
+
+// get 2d points from a packed float32/float64 buffer (x, y, x, y...) or from an iterable of (x, y) tuples
+bool ue_py_fpaint_context_get_points(PyObject *, TArray<FVector2D> &);
+
+// retained list of draw commands, filled by python and replayed natively at every paint
+struct FPythonSlateDrawBuffer
+{
+	enum class ECommandType : uint8
+	{
+		Lines,
+		Segments,
+		Boxes,
+		Text,
+	};
+
+	struct FCommand
+	{
+		ECommandType Type;
+		// range in Polylines for lines and segments, in Points for boxes (each rect is a position/size pair) and text
+		int32 First;
+		int32 Num;
+		FLinearColor Color;
+		float Thickness;
+		bool bAntialias;
+		// index in Brushes or Texts
+		int32 ResourceIndex;
+	};
+
+	TArray<FCommand> Commands;
+	TArray<FVector2D> Points;
+	// point arrays passed as they are to MakeLines(), one per Lines command and one per segment
+	TArray<TArray<FVector2D>> Polylines;
+	TArray<FSlateBrush> Brushes;
+	TArray<TPair<FText, FSlateFontInfo>> Texts;
+
+	void Reset();
+
+	void AddLines(TArray<FVector2D> &InPoints, const FLinearColor &Color, bool bAntialias, float Thickness, bool bSegments);
+	void AddBoxes(TArray<FVector2D> &InRects, const FLinearColor &Color, const FSlateBrush *Brush);
+	void AddText(const FVector2D &Position, const FText &Text, const FSlateFontInfo &Font, const FLinearColor &Color);
+
+	int32 Num() const
+	{
+		return Commands.Num();
+	}
+
+	// returns the number of generated draw elements
+	int32 Replay(const FGeometry &AllottedGeometry, FSlateWindowElementList &OutDrawElements, int32 LayerId) const;
+};
@@ -144,6 +144,7 @@ void ue_python_init_fpointer_event(PyObject *ue_module)
 
 PyObject *py_ue_new_fpointer_event(FPointerEvent pointer)
 {
+	ue_python_ensure_submodule(EPythonSubmodule::Slate);
 	ue_PyFPointerEvent *ret = (ue_PyFPointerEvent *)PyObject_New(ue_PyFPointerEvent, &ue_PyFPointerEventType);
 	new(&ret->pointer) FPointerEvent(pointer);
 	new(&ret->f_input.input) FInputEvent(pointer);
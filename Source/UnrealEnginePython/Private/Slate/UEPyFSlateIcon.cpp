@@ -88,6 +88,7 @@ void ue_python_init_fslate_icon(PyObject *ue_module)
 
 ue_PyFSlateIcon *py_ue_new_fslate_icon(const FSlateIcon slate_icon)
 {
+	ue_python_ensure_submodule(EPythonSubmodule::Slate);
 	ue_PyFSlateIcon *ret = (ue_PyFSlateIcon *)PyObject_New(ue_PyFSlateIcon, &ue_PyFSlateIconType);
 	ret->icon = slate_icon;
 	return ret;
@@ -263,6 +263,7 @@ static int ue_py_fslate_style_set_init(ue_PyFSlateStyleSet *self, PyObject *args
 
 ue_PyFSlateStyleSet* py_ue_new_fslate_style_set(FSlateStyleSet* styleSet)
 {
+	ue_python_ensure_submodule(EPythonSubmodule::Slate);
 	ue_PyFSlateStyleSet *ret = (ue_PyFSlateStyleSet *)PyObject_New(ue_PyFSlateStyleSet, &ue_PyFSlateStyleSetType);
 	ret->style_set = styleSet;
 	return ret;
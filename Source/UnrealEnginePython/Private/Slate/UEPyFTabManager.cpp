@@ -57,6 +57,7 @@ void ue_python_init_ftab_manager(PyObject *ue_module)
 
 PyObject *py_ue_new_ftab_manager(TSharedRef<FTabManager> tab_manager)
 {
+	ue_python_ensure_submodule(EPythonSubmodule::Slate);
 	ue_PyFTabManager *ret = (ue_PyFTabManager *)PyObject_New(ue_PyFTabManager, &ue_PyFTabManagerType);
 	new(&ret->tab_manager) TSharedRef<FTabManager>(tab_manager);
 	return (PyObject *)ret;
@@ -1,5 +1,6 @@
 
 #include "UEPyFTabSpawnerEntry.h"
+#include "UEPyModule.h"
 
 static PyObject *py_ue_ftab_spawner_entry_set_display_name(ue_PyFTabSpawnerEntry *self, PyObject * args)
 {
@@ -85,6 +86,7 @@ void ue_python_init_ftab_spawner_entry(PyObject *ue_module)
 
 PyObject *py_ue_new_ftab_spawner_entry(FTabSpawnerEntry *spawner_entry)
 {
+	ue_python_ensure_submodule(EPythonSubmodule::Slate);
 	ue_PyFTabSpawnerEntry *ret = (ue_PyFTabSpawnerEntry *)PyObject_New(ue_PyFTabSpawnerEntry, &ue_PyFTabSpawnerEntryType);
 	ret->spawner_entry = spawner_entry;
 	return (PyObject *)ret;
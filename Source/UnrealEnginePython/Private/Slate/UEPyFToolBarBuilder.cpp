@@ -178,6 +178,7 @@ void ue_python_init_ftool_bar_builder(PyObject *ue_module)
 
 PyObject *py_ue_new_ftool_bar_builder(FToolBarBuilder tool_bar_builder)
 {
+	ue_python_ensure_submodule(EPythonSubmodule::Slate);
 	ue_PyFToolBarBuilder *ret = (ue_PyFToolBarBuilder *)PyObject_New(ue_PyFToolBarBuilder, &ue_PyFToolBarBuilderType);
 	new(&ret->tool_bar_builder) FToolBarBuilder(tool_bar_builder);
 	return (PyObject *)ret;
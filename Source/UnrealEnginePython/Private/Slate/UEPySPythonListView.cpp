@@ -19,7 +19,7 @@ static PyObject *py_ue_spython_list_view_get_selected_items(ue_PySPythonListView
 
 	for (auto item : items)
 	{
-		PyList_Append(py_list, item->py_object);
+		PyList_Append(py_list, item->Materialize());
 	}
 
 	return py_list;
@@ -39,6 +39,24 @@ static PyObject *py_ue_spython_list_view_get_num_items_selected(ue_PySPythonList
 	return PyLong_FromLong(py_SPythonListView->GetNumItemsSelected());
 }
 
+static PyObject *py_ue_spython_list_view_set_item_selection(ue_PySPythonListView *self, PyObject * args)
+{
+	ue_py_slate_cast(SPythonListView);
+	int index;
+	PyObject *py_selected = nullptr;
+	if (!PyArg_ParseTuple(args, "i|O:set_item_selection", &index, &py_selected))
+	{
+		return nullptr;
+	}
+
+	if (index < 0 || index >= self->item_source_list.Num())
+		return PyErr_Format(PyExc_IndexError, "item index out of range");
+
+	py_SPythonListView->SetItemSelection(self->item_source_list[index], !py_selected || PyObject_IsTrue(py_selected), ESelectInfo::Direct);
+
+	Py_RETURN_SLATE_SELF;
+}
+
 static PyObject *py_ue_spython_list_view_set_header_row(ue_PySPythonListView *self, PyObject * args)
 {
 	ue_py_slate_cast(SPythonListView);
@@ -59,37 +77,429 @@ static PyObject *py_ue_spython_list_view_set_header_row(ue_PySPythonListView *se
 	Py_RETURN_SLATE_SELF;
 }
 
+void ue_py_spython_item_release(TSharedPtr<struct FPythonItem>& item)
+{
+	Py_XDECREF(item->py_object);
+	Py_XDECREF(item->py_key);
+	item->py_object = nullptr;
+	item->py_key = nullptr;
+	// slate can still hold the item (selection, live rows) after the view dropped the source callable
+	item->py_virtual_source = nullptr;
+	item->virtual_index = INDEX_NONE;
+}
+
+// returns a new reference, identity is used when no key callable is available
+static PyObject *ue_py_spython_item_key(PyObject *py_item, PyObject *py_key_func)
+{
+	if (!py_key_func)
+		return PyLong_FromVoidPtr(py_item);
+	return PyObject_CallFunctionObjArgs(py_key_func, py_item, nullptr);
+}
+
+bool ue_py_spython_items_keyed_update(SListView<TSharedPtr<struct FPythonItem>>& ListView, TArray<TSharedPtr<struct FPythonItem>>& Items, PyObject *values, PyObject *py_key_func, TFunction<void(TSharedPtr<struct FPythonItem>, TSharedPtr<struct FPythonItem>)> OnItemReplaced)
+{
+	PyObject *py_iter = PyObject_GetIter(values);
+	if (!py_iter)
+	{
+		PyErr_SetString(PyExc_Exception, "argument is not an iterable");
+		return false;
+	}
+
+	// key -> index in the old items array
+	PyObject *py_old_keys = PyDict_New();
+	for (int32 i = 0; i < Items.Num(); i++)
+	{
+		TSharedPtr<FPythonItem>& item = Items[i];
+		if (!item->py_key)
+		{
+			if (!item->py_object)
+				continue;
+			item->py_key = ue_py_spython_item_key(item->py_object, py_key_func);
+			if (!item->py_key)
+			{
+				Py_DECREF(py_old_keys);
+				Py_DECREF(py_iter);
+				return false;
+			}
+		}
+		PyObject *py_index = PyLong_FromLong(i);
+		int ret = PyDict_SetItem(py_old_keys, item->py_key, py_index);
+		Py_DECREF(py_index);
+		if (ret < 0)
+		{
+			Py_DECREF(py_old_keys);
+			Py_DECREF(py_iter);
+			return false;
+		}
+	}
+
+	TArray<bool> reused;
+	reused.AddZeroed(Items.Num());
+
+	TArray<TSharedPtr<FPythonItem>> new_items;
+	// old item -> new item
+	TArray<TPair<TSharedPtr<FPythonItem>, TSharedPtr<FPythonItem>>> replaced_items;
+
+	while (PyObject *py_item = PyIter_Next(py_iter))
+	{
+		PyObject *py_key = ue_py_spython_item_key(py_item, py_key_func);
+		if (!py_key)
+		{
+			Py_DECREF(py_item);
+			for (TSharedPtr<FPythonItem>& item : new_items)
+			{
+				if (!Items.Contains(item))
+					ue_py_spython_item_release(item);
+			}
+			Py_DECREF(py_old_keys);
+			Py_DECREF(py_iter);
+			return false;
+		}
+
+		PyObject *py_index = PyDict_GetItem(py_old_keys, py_key);
+		int32 old_index = py_index ? PyLong_AsLong(py_index) : INDEX_NONE;
+		TSharedPtr<FPythonItem> old_item;
+		if (old_index != INDEX_NONE && !reused[old_index])
+		{
+			old_item = Items[old_index];
+			reused[old_index] = true;
+			// same python object, keep the item (and its generated row) untouched
+			if (old_item->py_object == py_item)
+			{
+				Py_DECREF(py_item);
+				Py_DECREF(py_key);
+				new_items.Add(old_item);
+				continue;
+			}
+		}
+
+		TSharedPtr<FPythonItem> item = TSharedPtr<FPythonItem>(new FPythonItem(py_item));
+		item->py_key = py_key;
+		new_items.Add(item);
+		// the value changed, the new item forces the row regeneration
+		if (old_item.IsValid())
+		{
+			replaced_items.Add(TPair<TSharedPtr<FPythonItem>, TSharedPtr<FPythonItem>>(old_item, item));
+		}
+	}
+	Py_DECREF(py_iter);
+	Py_DECREF(py_old_keys);
+
+	if (PyErr_Occurred())
+	{
+		return false;
+	}
+
+	// transfer the view state (selection, expansion...) to the replacing items
+	for (TPair<TSharedPtr<FPythonItem>, TSharedPtr<FPythonItem>>& pair : replaced_items)
+	{
+		if (ListView.IsItemSelected(pair.Key))
+		{
+			ListView.SetItemSelection(pair.Value, true, ESelectInfo::Direct);
+		}
+		if (OnItemReplaced)
+		{
+			OnItemReplaced(pair.Key, pair.Value);
+		}
+		ue_py_spython_item_release(pair.Key);
+	}
+
+	for (int32 i = 0; i < Items.Num(); i++)
+	{
+		if (!reused[i])
+		{
+			ue_py_spython_item_release(Items[i]);
+		}
+	}
+
+	Items = MoveTemp(new_items);
+
+	ListView.RequestListRefresh();
+	return true;
+}
+
 static PyObject *py_spython_list_view_update_item_source_list(ue_PySPythonListView *self, PyObject * args)
 {
+	ue_py_slate_cast(SPythonListView);
 	PyObject *values;
-	if (!PyArg_ParseTuple(args, "O:update_item_source_list", &values))
+	PyObject *py_key_func = nullptr;
+	if (!PyArg_ParseTuple(args, "O|O:update_item_source_list", &values, &py_key_func))
 	{
 		return NULL;
 	}
 
-	values = PyObject_GetIter(values);
-	if (!values)
+	if (!py_key_func || py_key_func == Py_None)
 	{
-		return PyErr_Format(PyExc_Exception, "argument is not an iterable");
+		py_key_func = self->py_item_key;
 	}
 
-	//NOTE: ikrimae: Increment first so we don't decrement and destroy python objects that 
-	//we're passing in e.g. if you pass the same item source array into update_items(). 
-	//Might not be necessary but I'm not too familiar with python's GC
-	TArray<TSharedPtr<FPythonItem>> tempNewArray;
-	while (PyObject *item = PyIter_Next(values))
+	if (py_key_func && !PyCallable_Check(py_key_func))
 	{
-		Py_INCREF(item);
-		tempNewArray.Add(TSharedPtr<FPythonItem>(new FPythonItem(item)));
+		return PyErr_Format(PyExc_Exception, "key is not a callable");
 	}
 
+	// switching from virtual mode to a real item source
+	if (self->py_virtual_source)
+	{
+		for (TSharedPtr<struct FPythonItem>& item : self->item_source_list)
+		{
+			ue_py_spython_item_release(item);
+		}
+		self->item_source_list.Empty();
+		Py_DECREF(self->py_virtual_source);
+		self->py_virtual_source = nullptr;
+	}
+
+	if (!ue_py_spython_items_keyed_update(py_SPythonListView.Get(), self->item_source_list, values, py_key_func))
+	{
+		return nullptr;
+	}
+
+	Py_RETURN_NONE;
+}
+
+static PyObject *py_spython_list_view_set_item_key(ue_PySPythonListView *self, PyObject * args)
+{
+	PyObject *py_key_func;
+	if (!PyArg_ParseTuple(args, "O:set_item_key", &py_key_func))
+	{
+		return NULL;
+	}
+
+	if (py_key_func != Py_None && !PyCallable_Check(py_key_func))
+	{
+		return PyErr_Format(PyExc_Exception, "argument is not a callable");
+	}
+
+	Py_XDECREF(self->py_item_key);
+	self->py_item_key = nullptr;
+	if (py_key_func != Py_None)
+	{
+		Py_INCREF(py_key_func);
+		self->py_item_key = py_key_func;
+	}
+
+	// cached keys have been computed with the old callable
 	for (TSharedPtr<struct FPythonItem>& item : self->item_source_list)
 	{
-		Py_XDECREF(item->py_object);
+		Py_XDECREF(item->py_key);
+		item->py_key = nullptr;
 	}
-	self->item_source_list.Empty();
 
-	Move<TArray<TSharedPtr<FPythonItem>>>(self->item_source_list, tempNewArray);
+	Py_RETURN_SLATE_SELF;
+}
+
+static int32 ue_py_spython_list_view_find_key(ue_PySPythonListView *self, PyObject *py_key)
+{
+	for (int32 i = 0; i < self->item_source_list.Num(); i++)
+	{
+		TSharedPtr<FPythonItem>& item = self->item_source_list[i];
+		if (!item->py_key && item->py_object)
+		{
+			item->py_key = ue_py_spython_item_key(item->py_object, self->py_item_key);
+			if (!item->py_key)
+				return -2;
+		}
+		if (!item->py_key)
+			continue;
+		int ret = PyObject_RichCompareBool(item->py_key, py_key, Py_EQ);
+		if (ret < 0)
+			return -2;
+		if (ret)
+			return i;
+	}
+	return INDEX_NONE;
+}
+
+static PyObject *py_spython_list_view_insert_item(ue_PySPythonListView *self, PyObject * args)
+{
+	ue_py_slate_cast(SPythonListView);
+	int index;
+	PyObject *py_item;
+	if (!PyArg_ParseTuple(args, "iO:insert_item", &index, &py_item))
+	{
+		return NULL;
+	}
+
+	if (self->py_virtual_source)
+		return PyErr_Format(PyExc_Exception, "SPythonListView is in virtual mode");
+
+	PyObject *py_key = ue_py_spython_item_key(py_item, self->py_item_key);
+	if (!py_key)
+		return nullptr;
+
+	Py_INCREF(py_item);
+	TSharedPtr<FPythonItem> item = TSharedPtr<FPythonItem>(new FPythonItem(py_item));
+	item->py_key = py_key;
+
+	index = FMath::Clamp(index < 0 ? self->item_source_list.Num() + index + 1 : index, 0, self->item_source_list.Num());
+	self->item_source_list.Insert(item, index);
+	py_SPythonListView->RequestListRefresh();
+
+	Py_RETURN_NONE;
+}
+
+static PyObject *py_spython_list_view_remove_item(ue_PySPythonListView *self, PyObject * args)
+{
+	ue_py_slate_cast(SPythonListView);
+	PyObject *py_key;
+	if (!PyArg_ParseTuple(args, "O:remove_item", &py_key))
+	{
+		return NULL;
+	}
+
+	if (self->py_virtual_source)
+		return PyErr_Format(PyExc_Exception, "SPythonListView is in virtual mode");
+
+	int32 index = ue_py_spython_list_view_find_key(self, py_key);
+	if (index == -2)
+		return nullptr;
+	if (index == INDEX_NONE)
+		Py_RETURN_FALSE;
+
+	ue_py_spython_item_release(self->item_source_list[index]);
+	self->item_source_list.RemoveAt(index);
+	py_SPythonListView->RequestListRefresh();
+
+	Py_RETURN_TRUE;
+}
+
+static PyObject *py_spython_list_view_move_item(ue_PySPythonListView *self, PyObject * args)
+{
+	ue_py_slate_cast(SPythonListView);
+	PyObject *py_key;
+	int new_index;
+	if (!PyArg_ParseTuple(args, "Oi:move_item", &py_key, &new_index))
+	{
+		return NULL;
+	}
+
+	if (self->py_virtual_source)
+		return PyErr_Format(PyExc_Exception, "SPythonListView is in virtual mode");
+
+	int32 index = ue_py_spython_list_view_find_key(self, py_key);
+	if (index == -2)
+		return nullptr;
+	if (index == INDEX_NONE)
+		Py_RETURN_FALSE;
+
+	TSharedPtr<FPythonItem> item = self->item_source_list[index];
+	self->item_source_list.RemoveAt(index);
+	new_index = FMath::Clamp(new_index < 0 ? self->item_source_list.Num() + new_index + 1 : new_index, 0, self->item_source_list.Num());
+	self->item_source_list.Insert(item, new_index);
+	py_SPythonListView->RequestListRefresh();
+
+	Py_RETURN_TRUE;
+}
+
+static PyObject *py_spython_list_view_replace_item(ue_PySPythonListView *self, PyObject * args)
+{
+	ue_py_slate_cast(SPythonListView);
+	PyObject *py_key;
+	PyObject *py_item;
+	if (!PyArg_ParseTuple(args, "OO:replace_item", &py_key, &py_item))
+	{
+		return NULL;
+	}
+
+	if (self->py_virtual_source)
+		return PyErr_Format(PyExc_Exception, "SPythonListView is in virtual mode");
+
+	int32 index = ue_py_spython_list_view_find_key(self, py_key);
+	if (index == -2)
+		return nullptr;
+	if (index == INDEX_NONE)
+		Py_RETURN_FALSE;
+
+	TSharedPtr<FPythonItem> old_item = self->item_source_list[index];
+	bool selected = py_SPythonListView->IsItemSelected(old_item);
+
+	Py_INCREF(py_item);
+	TSharedPtr<FPythonItem> item = TSharedPtr<FPythonItem>(new FPythonItem(py_item));
+	item->py_key = old_item->py_key;
+	old_item->py_key = nullptr;
+	ue_py_spython_item_release(old_item);
+
+	self->item_source_list[index] = item;
+	if (selected)
+	{
+		py_SPythonListView->SetItemSelection(item, true, ESelectInfo::Direct);
+	}
+	py_SPythonListView->RequestListRefresh();
+
+	Py_RETURN_TRUE;
+}
+
+static PyObject *py_spython_list_view_get_item_source_list(ue_PySPythonListView *self, PyObject * args)
+{
+	PyObject *py_list = PyList_New(0);
+	for (TSharedPtr<struct FPythonItem>& item : self->item_source_list)
+	{
+		PyList_Append(py_list, item->Materialize());
+	}
+	return py_list;
+}
+
+static PyObject *py_spython_list_view_set_virtual_item_count(ue_PySPythonListView *self, PyObject * args)
+{
+	ue_py_slate_cast(SPythonListView);
+	int count;
+	if (!PyArg_ParseTuple(args, "i:set_virtual_item_count", &count))
+	{
+		return NULL;
+	}
+
+	if (!self->py_virtual_source)
+		return PyErr_Format(PyExc_Exception, "SPythonListView is not in virtual mode");
+
+	if (count < 0)
+		count = 0;
+
+	int32 old_count = self->item_source_list.Num();
+	for (int32 i = count; i < old_count; i++)
+	{
+		ue_py_spython_item_release(self->item_source_list[i]);
+	}
+	self->item_source_list.SetNum(count);
+	for (int32 i = old_count; i < count; i++)
+	{
+		self->item_source_list[i] = TSharedPtr<FPythonItem>(new FPythonItem(self->py_virtual_source, i));
+	}
+
+	py_SPythonListView->RequestListRefresh();
+	Py_RETURN_NONE;
+}
+
+static PyObject *py_spython_list_view_invalidate_virtual_items(ue_PySPythonListView *self, PyObject * args)
+{
+	ue_py_slate_cast(SPythonListView);
+	int first = 0;
+	int count = -1;
+	if (!PyArg_ParseTuple(args, "|ii:invalidate_virtual_items", &first, &count))
+	{
+		return NULL;
+	}
+
+	if (!self->py_virtual_source)
+		return PyErr_Format(PyExc_Exception, "SPythonListView is not in virtual mode");
+
+	int32 last = count < 0 ? self->item_source_list.Num() : FMath::Min(first + count, self->item_source_list.Num());
+	for (int32 i = FMath::Max(first, 0); i < last; i++)
+	{
+		TSharedPtr<FPythonItem>& old_item = self->item_source_list[i];
+		if (!old_item->py_object)
+			continue;
+		// materialized rows need to be generated again
+		TSharedPtr<FPythonItem> item = TSharedPtr<FPythonItem>(new FPythonItem(self->py_virtual_source, i));
+		if (py_SPythonListView->IsItemSelected(old_item))
+		{
+			py_SPythonListView->SetItemSelection(item, true, ESelectInfo::Direct);
+		}
+		ue_py_spython_item_release(old_item);
+		old_item = item;
+	}
+
+	py_SPythonListView->RequestListRefresh();
 	Py_RETURN_NONE;
 }
 
@@ -97,8 +507,17 @@ static PyMethodDef ue_PySPythonListView_methods[] = {
 	{ "get_selected_items", (PyCFunction)py_ue_spython_list_view_get_selected_items, METH_VARARGS, "" },
 	{ "get_num_items_selected", (PyCFunction)py_ue_spython_list_view_get_num_items_selected, METH_VARARGS, "" },
 	{ "clear_selection", (PyCFunction)py_ue_spython_list_view_clear_selection, METH_VARARGS, "" },
+	{ "set_item_selection", (PyCFunction)py_ue_spython_list_view_set_item_selection, METH_VARARGS, "" },
 	{ "set_header_row", (PyCFunction)py_ue_spython_list_view_set_header_row, METH_VARARGS, "" },
 	{ "update_item_source_list", (PyCFunction)py_spython_list_view_update_item_source_list, METH_VARARGS, "" },
+	{ "get_item_source_list", (PyCFunction)py_spython_list_view_get_item_source_list, METH_VARARGS, "" },
+	{ "set_item_key", (PyCFunction)py_spython_list_view_set_item_key, METH_VARARGS, "" },
+	{ "insert_item", (PyCFunction)py_spython_list_view_insert_item, METH_VARARGS, "" },
+	{ "remove_item", (PyCFunction)py_spython_list_view_remove_item, METH_VARARGS, "" },
+	{ "move_item", (PyCFunction)py_spython_list_view_move_item, METH_VARARGS, "" },
+	{ "replace_item", (PyCFunction)py_spython_list_view_replace_item, METH_VARARGS, "" },
+	{ "set_virtual_item_count", (PyCFunction)py_spython_list_view_set_virtual_item_count, METH_VARARGS, "" },
+	{ "invalidate_virtual_items", (PyCFunction)py_spython_list_view_invalidate_virtual_items, METH_VARARGS, "" },
 	{ NULL }  /* Sentinel */
 };
 
@@ -110,10 +529,13 @@ static void ue_PySPythonListView_dealloc(ue_PySPythonListView *self)
 
 	for (TSharedPtr<struct FPythonItem>& item : self->item_source_list)
 	{
-		Py_XDECREF(item->py_object);
+		ue_py_spython_item_release(item);
 	}
 	self->item_source_list.Empty();
 
+	Py_XDECREF(self->py_item_key);
+	Py_XDECREF(self->py_virtual_source);
+
 	Py_TYPE(self)->tp_free((PyObject *)self);
 }
 
@@ -153,26 +575,65 @@ static int ue_py_spython_list_view_init(ue_PySPythonListView *self, PyObject *ar
 
 	ue_py_slate_setup_farguments(SPythonListView);
 
-	// first of all check for values
-	PyObject *values = ue_py_dict_get_item(kwargs, "list_items_source");
-	if (!values)
+	new(&self->item_source_list) TArray<TSharedPtr<FPythonItem>>();
+
+	PyObject *py_key_func = ue_py_dict_get_item(kwargs, "item_key");
+	if (py_key_func && py_key_func != Py_None)
 	{
-		PyErr_SetString(PyExc_Exception, "you must specify list items");
-		return -1;
+		if (!PyCallable_Check(py_key_func))
+		{
+			PyErr_SetString(PyExc_Exception, "item_key is not a callable");
+			return -1;
+		}
+		Py_INCREF(py_key_func);
+		self->py_item_key = py_key_func;
 	}
 
-	values = PyObject_GetIter(values);
-	if (!values)
+	// virtual mode, rows are materialized by on_get_item(index) only when they are needed
+	PyObject *py_virtual_source = ue_py_dict_get_item(kwargs, "on_get_item");
+	if (py_virtual_source)
 	{
-		Py_DECREF(values);
-		return -1;
+		if (!PyCallable_Check(py_virtual_source))
+		{
+			PyErr_SetString(PyExc_Exception, "on_get_item is not a callable");
+			return -1;
+		}
+		PyObject *py_count = ue_py_dict_get_item(kwargs, "virtual_item_count");
+		int32 count = py_count ? PyLong_AsLong(py_count) : 0;
+		if (count < 0)
+		{
+			PyErr_Clear();
+			count = 0;
+		}
+		Py_INCREF(py_virtual_source);
+		self->py_virtual_source = py_virtual_source;
+		self->item_source_list.Reserve(count);
+		for (int32 i = 0; i < count; i++)
+		{
+			self->item_source_list.Add(TSharedPtr<FPythonItem>(new FPythonItem(py_virtual_source, i)));
+		}
 	}
-
-	new(&self->item_source_list) TArray<TSharedPtr<FPythonItem>>();
-	while (PyObject *item = PyIter_Next(values))
+	else
 	{
-		Py_INCREF(item);
-		self->item_source_list.Add(TSharedPtr<FPythonItem>(new FPythonItem(item)));
+		// first of all check for values
+		PyObject *values = ue_py_dict_get_item(kwargs, "list_items_source");
+		if (!values)
+		{
+			PyErr_SetString(PyExc_Exception, "you must specify list items");
+			return -1;
+		}
+
+		values = PyObject_GetIter(values);
+		if (!values)
+		{
+			return -1;
+		}
+
+		while (PyObject *item = PyIter_Next(values))
+		{
+			self->item_source_list.Add(TSharedPtr<FPythonItem>(new FPythonItem(item)));
+		}
+		Py_DECREF(values);
 	}
 	arguments.ListItemsSource(&self->item_source_list);
 
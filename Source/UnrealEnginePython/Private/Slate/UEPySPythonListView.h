@@ -20,6 +20,17 @@ typedef struct
 	ue_PySListView s_list_view;
 	/* Type-specific fields go here. */
 	TArray<TSharedPtr<struct FPythonItem>> item_source_list;
+	// callable returning the key of an item (used by incremental updates)
+	PyObject *py_item_key;
+	// callable returning the item at a given index (virtual mode)
+	PyObject *py_virtual_source;
 } ue_PySPythonListView;
 
 void ue_python_init_spython_list_view(PyObject *);
+
+// release the python references held by a python item
+void ue_py_spython_item_release(TSharedPtr<struct FPythonItem>&);
+
+// incrementally update a list of python items, items with the same key (or the same python object when key is null)
+// are preserved, so selection, expansion and generated rows survive the update
+bool ue_py_spython_items_keyed_update(SListView<TSharedPtr<struct FPythonItem>>&, TArray<TSharedPtr<struct FPythonItem>>&, PyObject *, PyObject *, TFunction<void(TSharedPtr<struct FPythonItem>, TSharedPtr<struct FPythonItem>)> OnItemReplaced = nullptr);
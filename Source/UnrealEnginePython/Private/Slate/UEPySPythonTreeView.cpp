@@ -1,5 +1,6 @@
 
 #include "UEPySPythonTreeView.h"
+#include "UEPySPythonListView.h"
 
 #include "Runtime/Slate/Public/Widgets/Views/STreeView.h"
 
@@ -29,8 +30,58 @@ void SPythonTreeView::SetPythonItemExpansion(PyObject *item, bool InShouldExpand
 	}
 }
 
+static PyObject *py_ue_spython_tree_view_update_item_source_list(ue_PySPythonTreeView *self, PyObject * args)
+{
+	ue_py_slate_cast(SPythonTreeView);
+	PyObject *values;
+	PyObject *py_key_func = nullptr;
+	if (!PyArg_ParseTuple(args, "O|O:update_item_source_list", &values, &py_key_func))
+	{
+		return nullptr;
+	}
+
+	if (py_key_func == Py_None)
+	{
+		py_key_func = nullptr;
+	}
+
+	if (py_key_func && !PyCallable_Check(py_key_func))
+	{
+		return PyErr_Format(PyExc_Exception, "key is not a callable");
+	}
+
+	TArray<TSharedPtr<FPythonItem>> *items = py_SPythonTreeView->GetPythonTreeItemsSource();
+	if (!items)
+	{
+		return PyErr_Format(PyExc_Exception, "SPythonTreeView has no items source");
+	}
+
+	// the key is not cached on the items, as the key function (or its absence) could change between calls
+	for (TSharedPtr<FPythonItem>& item : *items)
+	{
+		Py_XDECREF(item->py_key);
+		item->py_key = nullptr;
+	}
+
+	SPythonTreeView *tree_view = &py_SPythonTreeView.Get();
+	if (!ue_py_spython_items_keyed_update(*tree_view, *items, values, py_key_func,
+		[tree_view](TSharedPtr<FPythonItem> OldItem, TSharedPtr<FPythonItem> NewItem)
+	{
+		if (tree_view->IsItemExpanded(OldItem))
+		{
+			tree_view->SetItemExpansion(NewItem, true);
+		}
+	}))
+	{
+		return nullptr;
+	}
+
+	Py_RETURN_NONE;
+}
+
 static PyMethodDef ue_PySPythonTreeView_methods[] = {
 	{ "set_item_expansion", (PyCFunction)py_ue_spython_tree_view_set_item_expansion, METH_VARARGS, "" },
+	{ "update_item_source_list", (PyCFunction)py_ue_spython_tree_view_update_item_source_list, METH_VARARGS, "" },
 	{ NULL }  /* Sentinel */
 };
 
@@ -88,7 +139,6 @@ static int ue_py_spython_tree_view_init(ue_PySPythonTreeView *self, PyObject *ar
 	TArray<TSharedPtr<FPythonItem>> *items = new TArray<TSharedPtr<FPythonItem>>();
 	while (PyObject *item = PyIter_Next(values))
 	{
-		Py_INCREF(item);
 		items->Add(TSharedPtr<FPythonItem>(new FPythonItem(item)));
 	}
 	Py_DECREF(values);
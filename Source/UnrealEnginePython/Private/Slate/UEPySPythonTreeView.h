@@ -15,6 +15,11 @@ public:
 	}
 
 	void SetPythonItemExpansion(PyObject *item, bool InShouldExpandItem);
+
+	TArray<TSharedPtr<struct FPythonItem>> *GetPythonTreeItemsSource()
+	{
+		return const_cast<TArray<TSharedPtr<struct FPythonItem>> *>(TreeItemsSource);
+	}
 };
 
 typedef struct
@@ -55,10 +55,198 @@ static PyObject *py_ue_spython_widget_clear_content(ue_PySPythonWidget *self, Py
 	Py_RETURN_NONE;
 }
 
+static PyObject *py_ue_spython_widget_set_retained_paint(ue_PySPythonWidget *self, PyObject *args)
+{
+	ue_py_slate_cast(SPythonWidget);
+	PyObject *py_bool = nullptr;
+	if (!PyArg_ParseTuple(args, "|O:set_retained_paint", &py_bool))
+	{
+		return nullptr;
+	}
+
+	py_SPythonWidget->SetRetainedPaint(!py_bool || PyObject_IsTrue(py_bool));
+	Py_RETURN_SLATE_SELF;
+}
+
+static PyObject *py_ue_spython_widget_invalidate_paint(ue_PySPythonWidget *self, PyObject *args)
+{
+	ue_py_slate_cast(SPythonWidget);
+	py_SPythonWidget->InvalidatePaint();
+	Py_RETURN_NONE;
+}
+
+static PyObject *py_ue_spython_widget_draw_buffer_clear(ue_PySPythonWidget *self, PyObject *args)
+{
+	ue_py_slate_cast(SPythonWidget);
+	py_SPythonWidget->GetDrawBuffer().Reset();
+	py_SPythonWidget->OnDrawBufferChanged();
+	Py_RETURN_NONE;
+}
+
+static PyObject *py_ue_spython_widget_draw_buffer_num(ue_PySPythonWidget *self, PyObject *args)
+{
+	ue_py_slate_cast(SPythonWidget);
+	return PyLong_FromLong(py_SPythonWidget->GetDrawBuffer().Num());
+}
+
+static PyObject *py_ue_spython_widget_draw_buffer_add_lines(ue_PySPythonWidget *self, PyObject *args, PyObject *kwargs)
+{
+	ue_py_slate_cast(SPythonWidget);
+	PyObject *py_points;
+	PyObject *py_linear_color = nullptr;
+	PyObject *py_antialias = nullptr;
+	float thickness = 1.0;
+	PyObject *py_segments = nullptr;
+
+	static char *kw_names[] = { (char *)"points", (char *)"color", (char *)"antialias", (char *)"thickness", (char *)"segments", nullptr };
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O|OOfO:draw_buffer_add_lines", kw_names, &py_points, &py_linear_color, &py_antialias, &thickness, &py_segments))
+	{
+		return nullptr;
+	}
+
+	FLinearColor tint = FLinearColor::White;
+	if (py_linear_color && py_linear_color != Py_None)
+	{
+		if (!py_ue_get_flinearcolor(py_linear_color, tint))
+		{
+			return PyErr_Format(PyExc_Exception, "argument is not a FLinearColor or FColor.");
+		}
+	}
+
+	TArray<FVector2D> points;
+	if (!ue_py_fpaint_context_get_points(py_points, points))
+		return nullptr;
+
+	py_SPythonWidget->GetDrawBuffer().AddLines(points, tint, !py_antialias || PyObject_IsTrue(py_antialias), thickness, py_segments && PyObject_IsTrue(py_segments));
+	py_SPythonWidget->OnDrawBufferChanged();
+
+	Py_RETURN_NONE;
+}
+
+static PyObject *py_ue_spython_widget_draw_buffer_add_boxes(ue_PySPythonWidget *self, PyObject *args, PyObject *kwargs)
+{
+	ue_py_slate_cast(SPythonWidget);
+	PyObject *py_rects;
+	PyObject *py_linear_color = nullptr;
+	PyObject *py_brush = nullptr;
+
+	static char *kw_names[] = { (char *)"rects", (char *)"color", (char *)"brush", nullptr };
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O|OO:draw_buffer_add_boxes", kw_names, &py_rects, &py_linear_color, &py_brush))
+	{
+		return nullptr;
+	}
+
+	FLinearColor tint = FLinearColor::White;
+	if (py_linear_color && py_linear_color != Py_None)
+	{
+		if (!py_ue_get_flinearcolor(py_linear_color, tint))
+		{
+			return PyErr_Format(PyExc_Exception, "argument is not a FLinearColor or FColor.");
+		}
+	}
+
+	FSlateBrush *brush = nullptr;
+	if (py_brush && py_brush != Py_None)
+	{
+		brush = ue_py_check_struct<FSlateBrush>(py_brush);
+		if (!brush)
+			return PyErr_Format(PyExc_Exception, "argument is not a FSlateBrush");
+	}
+
+	// rects are (x, y, w, h) so they are parsed as position/size pairs
+	TArray<FVector2D> rects;
+	if (PyObject_CheckBuffer(py_rects))
+	{
+		if (!ue_py_fpaint_context_get_points(py_rects, rects))
+			return nullptr;
+	}
+	else
+	{
+		PyObject *py_iter = PyObject_GetIter(py_rects);
+		if (!py_iter)
+			return PyErr_Format(PyExc_Exception, "argument is not an iterable of tuples");
+
+		while (PyObject *py_item = PyIter_Next(py_iter))
+		{
+			float x, y, w, h;
+			if (!PyTuple_Check(py_item) || !PyArg_ParseTuple(py_item, "ffff", &x, &y, &w, &h))
+			{
+				Py_DECREF(py_item);
+				Py_DECREF(py_iter);
+				if (!PyErr_Occurred())
+					PyErr_SetString(PyExc_Exception, "iterable item is not a tuple");
+				return nullptr;
+			}
+			Py_DECREF(py_item);
+			rects.Add(FVector2D(x, y));
+			rects.Add(FVector2D(w, h));
+		}
+		Py_DECREF(py_iter);
+		if (PyErr_Occurred())
+			return nullptr;
+	}
+
+	py_SPythonWidget->GetDrawBuffer().AddBoxes(rects, tint, brush);
+	py_SPythonWidget->OnDrawBufferChanged();
+
+	Py_RETURN_NONE;
+}
+
+static PyObject *py_ue_spython_widget_draw_buffer_add_text(ue_PySPythonWidget *self, PyObject *args)
+{
+	ue_py_slate_cast(SPythonWidget);
+	float x, y;
+	char *text;
+	float size = 0;
+	PyObject *py_linear_color = nullptr;
+	PyObject *py_font = nullptr;
+
+	if (!PyArg_ParseTuple(args, "(ff)s|fOO:draw_buffer_add_text", &x, &y, &text, &size, &py_linear_color, &py_font))
+		return nullptr;
+
+	FLinearColor tint = FLinearColor::White;
+	FSlateFontInfo font = FCoreStyle::Get().GetWidgetStyle<FTextBlockStyle>("NormalText").Font;
+
+	if (py_linear_color && py_linear_color != Py_None)
+	{
+		if (!py_ue_get_flinearcolor(py_linear_color, tint))
+		{
+			return PyErr_Format(PyExc_Exception, "argument is not a FLinearColor or FColor.");
+		}
+	}
+
+	if (py_font)
+	{
+		FSlateFontInfo *font_struct = ue_py_check_struct<FSlateFontInfo>(py_font);
+		if (!font_struct)
+			return PyErr_Format(PyExc_Exception, "argument is not a SlateFontInfo USTRUCT");
+		font = *font_struct;
+	}
+
+	if (size > 0)
+		font.Size = size;
+
+	py_SPythonWidget->GetDrawBuffer().AddText(FVector2D(x, y), FText::FromString(UTF8_TO_TCHAR(text)), font, tint);
+	py_SPythonWidget->OnDrawBufferChanged();
+
+	Py_RETURN_NONE;
+}
+
+#ifdef _MSC_VER
+#pragma warning(disable: 4191)
+#endif
+
 static PyMethodDef ue_PySPythonWidget_methods[] = {
 	{ "set_active",    (PyCFunction)py_ue_spython_widget_set_active, METH_VARARGS | METH_KEYWORDS, "" },
 	{ "set_content",   (PyCFunction)py_ue_spython_widget_set_content, METH_VARARGS, "" },
 	{ "clear_content", (PyCFunction)py_ue_spython_widget_clear_content, METH_VARARGS, "" },
+	{ "set_retained_paint", (PyCFunction)py_ue_spython_widget_set_retained_paint, METH_VARARGS, "" },
+	{ "invalidate_paint", (PyCFunction)py_ue_spython_widget_invalidate_paint, METH_VARARGS, "" },
+	{ "draw_buffer_clear", (PyCFunction)py_ue_spython_widget_draw_buffer_clear, METH_VARARGS, "" },
+	{ "draw_buffer_num", (PyCFunction)py_ue_spython_widget_draw_buffer_num, METH_VARARGS, "" },
+	{ "draw_buffer_add_lines", (PyCFunction)py_ue_spython_widget_draw_buffer_add_lines, METH_VARARGS | METH_KEYWORDS, "" },
+	{ "draw_buffer_add_boxes", (PyCFunction)py_ue_spython_widget_draw_buffer_add_boxes, METH_VARARGS | METH_KEYWORDS, "" },
+	{ "draw_buffer_add_text", (PyCFunction)py_ue_spython_widget_draw_buffer_add_text, METH_VARARGS, "" },
 	{ NULL }  /* Sentinel */
 };
 
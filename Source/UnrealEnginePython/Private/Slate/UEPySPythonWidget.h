@@ -1,6 +1,7 @@
 #pragma once
 
 #include "UEPySCompoundWidget.h"
+#include "UEPyFPaintContext.h"
 
 #include "Runtime/UMG/Public/Blueprint/UserWidget.h"
 
@@ -216,6 +217,43 @@ public:
 	{
 		int32 MaxLayer = SCompoundWidget::OnPaint(Args, AllottedGeometry, MyClippingRect, OutDrawElements, LayerId, InWidgetStyle, bParentEnabled);
 
+		if (bRetainedPaint)
+		{
+			// python is called only when the content changed (or the widget has been resized)
+			if (AllottedGeometry.GetLocalSize() != RetainedPaintSize)
+			{
+				RetainedPaintSize = AllottedGeometry.GetLocalSize();
+				bRetainedPaintDirty = true;
+			}
+
+			if (bRetainedPaintDirty)
+			{
+				bRetainedPaintDirty = false;
+				FScopePythonGIL gil;
+				if (PyObject_HasAttrString(self, (char *)"build_draw_buffer"))
+				{
+					DrawBuffer.Reset();
+					bBuildingDrawBuffer = true;
+					PyObject *ret = PyObject_CallMethod(self, (char *)"build_draw_buffer", (char *)"N", py_ue_new_fgeometry(AllottedGeometry));
+					bBuildingDrawBuffer = false;
+					if (!ret)
+					{
+						unreal_engine_py_log_error();
+					}
+					Py_XDECREF(ret);
+				}
+			}
+		}
+
+		// retained commands are replayed without touching python
+		if (DrawBuffer.Num() > 0)
+		{
+			DrawBuffer.Replay(AllottedGeometry, OutDrawElements, ++MaxLayer);
+		}
+
+		if (bRetainedPaint)
+			return MaxLayer;
+
 		FScopePythonGIL gil;
 
 		if (!PyObject_HasAttrString(self, (char *)"paint"))
@@ -301,9 +339,43 @@ public:
 		ChildSlot.DetachWidget();
 	}
 
+	void SetRetainedPaint(bool bEnabled)
+	{
+		bRetainedPaint = bEnabled;
+		InvalidatePaint();
+	}
+
+	void InvalidatePaint()
+	{
+		bRetainedPaintDirty = true;
+		Invalidate(EInvalidateWidgetReason::Paint);
+	}
+
+	// the draw buffer is accessed only from the game thread
+	FPythonSlateDrawBuffer &GetDrawBuffer() const
+	{
+		return DrawBuffer;
+	}
+
+	void OnDrawBufferChanged()
+	{
+		// no need to invalidate while build_draw_buffer is running from OnPaint
+		if (!bBuildingDrawBuffer)
+		{
+			Invalidate(EInvalidateWidgetReason::Paint);
+		}
+	}
+
 protected:
 	PyObject * self;
 
+	// when enabled, the draw commands are retained and build_draw_buffer is called only when dirty
+	bool bRetainedPaint = false;
+	mutable bool bRetainedPaintDirty = true;
+	mutable FVector2D RetainedPaintSize = FVector2D::ZeroVector;
+	mutable FPythonSlateDrawBuffer DrawBuffer;
+	mutable bool bBuildingDrawBuffer = false;
+
 	TWeakPtr<FActiveTimerHandle> ActiveTimerHandle;
 
 	EActiveTimerReturnType EnsureTick(double InCurrentTime, float InDeltaTime)
@@ -343,6 +343,7 @@ ue_PySWindow *py_ue_is_swindow(PyObject *obj)
 
 ue_PySWindow *py_ue_new_swindow(TSharedRef<SWindow> s_window)
 {
+	ue_python_ensure_submodule(EPythonSubmodule::Slate);
 	ue_PySWindow *ret = (ue_PySWindow *)PyObject_New(ue_PySWindow, &ue_PySWindowType);
 
 	new(&ret->s_compound_widget.s_widget.Widget) TSharedRef<SWindow>(s_window);
@@ -447,7 +447,7 @@ TSharedRef<SWidget> FPythonSlateDelegate::OnGenerateWidget(TSharedPtr<FPythonIte
 {
 	FScopePythonGIL gil;
 
-	PyObject *ret = PyObject_CallFunction(py_callable, (char *)"O", py_item.Get()->py_object);
+	PyObject *ret = PyObject_CallFunction(py_callable, (char *)"O", py_item.Get()->Materialize());
 	if (!ret)
 	{
 		unreal_engine_py_log_error();
@@ -500,7 +500,7 @@ void FPythonSlateDelegate::OnSelectionChanged(TSharedPtr<FPythonItem> py_item, E
 
 	FScopePythonGIL gil;
 
-	PyObject *ret = PyObject_CallFunction(py_callable, (char *)"Oi", py_item.Get()->py_object, (int)select_type);
+	PyObject *ret = PyObject_CallFunction(py_callable, (char *)"Oi", py_item.Get()->Materialize(), (int)select_type);
 	if (!ret)
 	{
 		unreal_engine_py_log_error();
@@ -790,7 +790,7 @@ TSharedRef<ITableRow> FPythonSlateDelegate::GenerateRow(TSharedPtr<FPythonItem>
 {
 	FScopePythonGIL gil;
 
-	PyObject *ret = PyObject_CallFunction(py_callable, (char*)"O", InItem.Get()->py_object);
+	PyObject *ret = PyObject_CallFunction(py_callable, (char*)"O", InItem.Get()->Materialize());
 	if (!ret)
 	{
 		unreal_engine_py_log_error();
@@ -818,7 +818,7 @@ TSharedRef<ITableRow> FPythonSlateDelegate::GenerateRow(TSharedPtr<FPythonItem>
 
 void FPythonSlateDelegate::GetChildren(TSharedPtr<FPythonItem> InItem, TArray<TSharedPtr<FPythonItem>>& OutChildren)
 {
-	PyObject *ret = PyObject_CallFunction(py_callable, (char*)"O", InItem.Get()->py_object);
+	PyObject *ret = PyObject_CallFunction(py_callable, (char*)"O", InItem.Get()->Materialize());
 	if (!ret)
 	{
 		unreal_engine_py_log_error();
@@ -1223,6 +1223,7 @@ PyObject *py_unreal_engine_create_structure_detail_view(PyObject *self, PyObject
 	}
 
 	extern PyTypeObject ue_PyIStructureDetailsViewType;
+	ue_python_ensure_submodule(EPythonSubmodule::Slate);
 	ue_PyIStructureDetailsView *ret = (ue_PyIStructureDetailsView *)PyObject_New(ue_PyIStructureDetailsView, &ue_PyIStructureDetailsViewType);
 	new(&ret->istructure_details_view) TSharedPtr<IStructureDetailsView>(nullptr);
 	ret->ue_py_struct = nullptr;
@@ -76,6 +76,7 @@ PyObject *ue_py_dict_get_item(PyObject *, const char *);
 
 template<typename T> ue_PySWidget *py_ue_new_swidget(TSharedRef<SWidget> s_widget, PyTypeObject *py_type)
 {
+	ue_python_ensure_submodule(EPythonSubmodule::Slate);
 	ue_PySWidget *ret = (ue_PySWidget *)PyObject_New(T, py_type);
 
 	new(&ret->Widget) TSharedRef<SWidget>(s_widget);
@@ -6,8 +6,39 @@ struct FPythonItem
 {
 	PyObject *py_object = nullptr;
 
+	// optional key used by the incremental updates of SPythonListView/SPythonTreeView
+	PyObject *py_key = nullptr;
+
+	// virtual items get their py_object from py_virtual_source(virtual_index) only when needed
+	// (the source callable is owned by the view)
+	PyObject *py_virtual_source = nullptr;
+	int32 virtual_index = INDEX_NONE;
+
 	FPythonItem(PyObject *item)
 	{
 		py_object = item;
 	}
-};
\ No newline at end of file
+
+	FPythonItem(PyObject *source, int32 index)
+	{
+		py_virtual_source = source;
+		virtual_index = index;
+	}
+
+	// must be called with the GIL held, returns a borrowed reference
+	// (released items have no source anymore and always return None)
+	PyObject *Materialize()
+	{
+		if (!py_object && py_virtual_source)
+		{
+			py_object = PyObject_CallFunction(py_virtual_source, (char *)"i", virtual_index);
+			if (!py_object)
+			{
+				unreal_engine_py_log_error();
+				Py_INCREF(Py_None);
+				py_object = Py_None;
+			}
+		}
+		return py_object ? py_object : Py_None;
+	}
+};
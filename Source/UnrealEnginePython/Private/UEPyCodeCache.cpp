@@ -0,0 +1,334 @@
+#include "UEPyCodeCache.h"
+
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Hash/CityHash.h"
+
+// RunString() is used for console commands too, so the number of cached strings is bounded
+#define UEPY_CODE_CACHE_MAX_STRINGS 512
+
+FPythonCodeCache &FPythonCodeCache::Get()
+{
+	static FPythonCodeCache Singleton;
+	return Singleton;
+}
+
+FPythonCodeCache::FPythonCodeCache()
+{
+	bEnabled = true;
+	bBytecodeCache = false;
+	FileHits = 0;
+	FileMisses = 0;
+	StringHits = 0;
+	StringMisses = 0;
+	BytecodeHits = 0;
+	ResolveHits = 0;
+	ResolveMisses = 0;
+	Compilations = 0;
+	CompileTime = 0;
+}
+
+bool FPythonCodeCache::ResolveScript(const FString &Filename, const TArray<FString> &ScriptsPaths, FString &OutPath)
+{
+	if (ResolvedScriptsPaths != ScriptsPaths)
+	{
+		ResolvedScripts.Empty();
+		ResolvedScriptsPaths = ScriptsPaths;
+	}
+
+	if (bEnabled)
+	{
+		if (FString *Resolved = ResolvedScripts.Find(Filename))
+		{
+			ResolveHits++;
+			OutPath = *Resolved;
+			return true;
+		}
+	}
+	ResolveMisses++;
+
+	OutPath = Filename;
+	bool bFound = FPaths::FileExists(Filename);
+	if (!bFound)
+	{
+		for (const FString &ScriptsPath : ScriptsPaths)
+		{
+			OutPath = FPaths::Combine(*ScriptsPath, Filename);
+
+#if PLATFORM_IOS
+			OutPath = IFileManager::Get().ConvertToAbsolutePathForExternalAppForRead(*OutPath);
+#endif
+
+			if (FPaths::FileExists(OutPath))
+			{
+				bFound = true;
+				break;
+			}
+		}
+	}
+
+	if (bFound && bEnabled)
+	{
+		ResolvedScripts.Add(Filename, OutPath);
+	}
+	return bFound;
+}
+
+void FPythonCodeCache::ForgetScript(const FString &Filename)
+{
+	ResolvedScripts.Remove(Filename);
+}
+
+PyObject *FPythonCodeCache::Compile(const char *Source, const char *Filename)
+{
+	const double StartTime = FPlatformTime::Seconds();
+	PyObject *Code = Py_CompileString(Source, Filename, Py_file_input);
+	CompileTime += FPlatformTime::Seconds() - StartTime;
+	Compilations++;
+	return Code;
+}
+
+PyObject *FPythonCodeCache::GetFileCode(const FString &Path, bool &bMissing)
+{
+	bMissing = false;
+
+	FFileStatData StatData = IFileManager::Get().GetStatData(*Path);
+	if (!StatData.bIsValid || StatData.bIsDirectory)
+	{
+		bMissing = true;
+		return PyErr_Format(PyExc_Exception, "unable to open file %s", TCHAR_TO_UTF8(*Path));
+	}
+
+	if (bEnabled)
+	{
+		FFileEntry *Entry = Files.Find(Path);
+		if (Entry && Entry->ModificationTime == StatData.ModificationTime && Entry->Size == StatData.FileSize)
+		{
+			FileHits++;
+			Py_INCREF(Entry->Code);
+			return Entry->Code;
+		}
+		FileMisses++;
+	}
+
+	TArray<uint8> Source;
+	if (!FFileHelper::LoadFileToArray(Source, *Path, FILEREAD_Silent))
+	{
+		bMissing = true;
+		return PyErr_Format(PyExc_Exception, "unable to open file %s", TCHAR_TO_UTF8(*Path));
+	}
+	Source.Add(0);
+
+	PyObject *Code = nullptr;
+	uint64 SourceHash = 0;
+	const bool bUseBytecode = bEnabled && bBytecodeCache;
+	if (bUseBytecode)
+	{
+		SourceHash = CityHash64((const char *)Source.GetData(), Source.Num() - 1);
+		Code = LoadBytecode(Path, SourceHash);
+	}
+
+	if (!Code)
+	{
+		Code = Compile((const char *)Source.GetData(), TCHAR_TO_UTF8(*Path));
+		if (!Code)
+			return nullptr;
+		if (bUseBytecode)
+		{
+			SaveBytecode(Path, SourceHash, Code);
+		}
+	}
+
+	if (bEnabled)
+	{
+		FFileEntry &Entry = Files.FindOrAdd(Path);
+		Py_XDECREF(Entry.Code);
+		Py_INCREF(Code);
+		Entry.Code = Code;
+		Entry.ModificationTime = StatData.ModificationTime;
+		Entry.Size = StatData.FileSize;
+	}
+
+	return Code;
+}
+
+PyObject *FPythonCodeCache::GetStringCode(const char *Source)
+{
+	if (!bEnabled)
+	{
+		return Compile(Source, "<string>");
+	}
+
+	const int32 Len = FCStringAnsi::Strlen(Source);
+	const uint64 Hash = CityHash64(Source, Len);
+
+	// the whole text is compared, hash collisions are just misses
+	FStringEntry *Entry = Strings.Find(Hash);
+	if (Entry && Entry->Source.Num() == Len + 1 && !FMemory::Memcmp(Entry->Source.GetData(), Source, Len))
+	{
+		StringHits++;
+		Py_INCREF(Entry->Code);
+		return Entry->Code;
+	}
+	StringMisses++;
+
+	PyObject *Code = Compile(Source, "<string>");
+	if (!Code)
+		return nullptr;
+
+	if (!Entry && Strings.Num() >= UEPY_CODE_CACHE_MAX_STRINGS)
+	{
+		for (TPair<uint64, FStringEntry> &Pair : Strings)
+		{
+			Py_DECREF(Pair.Value.Code);
+		}
+		Strings.Empty();
+	}
+
+	FStringEntry &NewEntry = Strings.FindOrAdd(Hash);
+	Py_XDECREF(NewEntry.Code);
+	Py_INCREF(Code);
+	NewEntry.Code = Code;
+	NewEntry.Source = TArray<ANSICHAR>(Source, Len + 1);
+
+	return Code;
+}
+
+FString FPythonCodeCache::GetBytecodePath(const FString &Path) const
+{
+	FString FullPath = FPaths::ConvertRelativePathToFull(Path);
+	FTCHARToUTF8 Utf8Path(*FullPath);
+	return FPaths::Combine(BytecodeCacheDir, FString::Printf(TEXT("%016llx.uepyc"), CityHash64(Utf8Path.Get(), Utf8Path.Length())));
+}
+
+// the .uepyc header is the python magic number followed by the hash of the source, then the marshalled code object
+PyObject *FPythonCodeCache::LoadBytecode(const FString &Path, uint64 SourceHash)
+{
+	TArray<uint8> Data;
+	if (!FFileHelper::LoadFileToArray(Data, *GetBytecodePath(Path), FILEREAD_Silent))
+		return nullptr;
+
+	uint64 Header[2];
+	if (Data.Num() <= (int32)sizeof(Header))
+		return nullptr;
+	FMemory::Memcpy(Header, Data.GetData(), sizeof(Header));
+	if (Header[0] != (uint64)PyImport_GetMagicNumber() || Header[1] != SourceHash)
+		return nullptr;
+
+	PyObject *py_marshal = PyImport_ImportModule("marshal");
+	if (!py_marshal)
+	{
+		PyErr_Clear();
+		return nullptr;
+	}
+
+	PyObject *py_bytes = PyBytes_FromStringAndSize((const char *)Data.GetData() + sizeof(Header), Data.Num() - sizeof(Header));
+	PyObject *Code = PyObject_CallMethod(py_marshal, (char *)"loads", (char *)"O", py_bytes);
+	Py_DECREF(py_bytes);
+	Py_DECREF(py_marshal);
+
+	// a corrupted file is just recompiled
+	if (!Code || !PyCode_Check(Code))
+	{
+		PyErr_Clear();
+		Py_XDECREF(Code);
+		return nullptr;
+	}
+
+	BytecodeHits++;
+	return Code;
+}
+
+void FPythonCodeCache::SaveBytecode(const FString &Path, uint64 SourceHash, PyObject *Code)
+{
+	PyObject *py_marshal = PyImport_ImportModule("marshal");
+	if (!py_marshal)
+	{
+		PyErr_Clear();
+		return;
+	}
+
+	PyObject *py_bytes = PyObject_CallMethod(py_marshal, (char *)"dumps", (char *)"O", Code);
+	Py_DECREF(py_marshal);
+	if (!py_bytes || !PyBytes_Check(py_bytes))
+	{
+		PyErr_Clear();
+		Py_XDECREF(py_bytes);
+		return;
+	}
+
+	const uint64 Header[2] = { (uint64)PyImport_GetMagicNumber(), SourceHash };
+	TArray<uint8> Data;
+	Data.Append((const uint8 *)Header, sizeof(Header));
+	Data.Append((const uint8 *)PyBytes_AsString(py_bytes), PyBytes_Size(py_bytes));
+	Py_DECREF(py_bytes);
+
+	if (!FFileHelper::SaveArrayToFile(Data, *GetBytecodePath(Path)))
+	{
+		UE_LOG(LogPython, Warning, TEXT("unable to write python bytecode cache for %s"), *Path);
+	}
+}
+
+void FPythonCodeCache::Clear()
+{
+	for (TPair<FString, FFileEntry> &Pair : Files)
+	{
+		Py_DECREF(Pair.Value.Code);
+	}
+	Files.Empty();
+
+	for (TPair<uint64, FStringEntry> &Pair : Strings)
+	{
+		Py_DECREF(Pair.Value.Code);
+	}
+	Strings.Empty();
+
+	ResolvedScripts.Empty();
+
+	FileHits = 0;
+	FileMisses = 0;
+	StringHits = 0;
+	StringMisses = 0;
+	BytecodeHits = 0;
+	ResolveHits = 0;
+	ResolveMisses = 0;
+	Compilations = 0;
+	CompileTime = 0;
+}
+
+static void ue_py_code_cache_stat(PyObject *py_dict, const char *key, PyObject *py_value)
+{
+	PyDict_SetItemString(py_dict, key, py_value);
+	Py_DECREF(py_value);
+}
+
+PyObject *FPythonCodeCache::GetStats()
+{
+	PyObject *py_dict = PyDict_New();
+	ue_py_code_cache_stat(py_dict, "enabled", PyBool_FromLong(bEnabled));
+	ue_py_code_cache_stat(py_dict, "bytecode_cache", PyBool_FromLong(bBytecodeCache));
+	ue_py_code_cache_stat(py_dict, "files", PyLong_FromLong(Files.Num()));
+	ue_py_code_cache_stat(py_dict, "strings", PyLong_FromLong(Strings.Num()));
+	ue_py_code_cache_stat(py_dict, "file_hits", PyLong_FromUnsignedLongLong(FileHits));
+	ue_py_code_cache_stat(py_dict, "file_misses", PyLong_FromUnsignedLongLong(FileMisses));
+	ue_py_code_cache_stat(py_dict, "string_hits", PyLong_FromUnsignedLongLong(StringHits));
+	ue_py_code_cache_stat(py_dict, "string_misses", PyLong_FromUnsignedLongLong(StringMisses));
+	ue_py_code_cache_stat(py_dict, "bytecode_hits", PyLong_FromUnsignedLongLong(BytecodeHits));
+	ue_py_code_cache_stat(py_dict, "resolve_hits", PyLong_FromUnsignedLongLong(ResolveHits));
+	ue_py_code_cache_stat(py_dict, "resolve_misses", PyLong_FromUnsignedLongLong(ResolveMisses));
+	ue_py_code_cache_stat(py_dict, "compilations", PyLong_FromUnsignedLongLong(Compilations));
+	ue_py_code_cache_stat(py_dict, "compile_time", PyFloat_FromDouble(CompileTime));
+	return py_dict;
+}
+
+PyObject *py_unreal_engine_code_cache_stats(PyObject *self, PyObject * args)
+{
+	return FPythonCodeCache::Get().GetStats();
+}
+
+PyObject *py_unreal_engine_code_cache_clear(PyObject *self, PyObject * args)
+{
+	FPythonCodeCache::Get().Clear();
+	Py_RETURN_NONE;
+}
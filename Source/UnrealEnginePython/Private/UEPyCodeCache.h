@@ -0,0 +1,80 @@
+#pragma once
+
+
+
+#include "UEPyModule.h"
+
+/*
+
+Compiled code objects for RunFile/RunString (and everything built over them: ue.exec, py.exec, py.cmd,
+ExecutePythonScript, ExecutePythonString, UPythonScript).
+
+File entries are validated with the source modification time and size, string entries with their full text.
+Optionally code objects are marshalled to disk (validated with the python magic number and a hash of the source),
+so packaged builds do not need to compile the same scripts at every run.
+
+All of the methods must be called with the GIL held.
+
+*/
+class FPythonCodeCache
+{
+public:
+	static FPythonCodeCache &Get();
+
+	// set from the [Python] CodeCache, BytecodeCache and (Relative)BytecodeCachePath settings
+	bool bEnabled;
+	bool bBytecodeCache;
+	FString BytecodeCacheDir;
+
+	// search a script in the current directory and then in the ScriptsPaths, results are cached
+	bool ResolveScript(const FString &Filename, const TArray<FString> &ScriptsPaths, FString &OutPath);
+	void ForgetScript(const FString &Filename);
+
+	// new reference to the code object, nullptr with the python error set on failure
+	// bMissing is set when the file does not exist anymore
+	PyObject *GetFileCode(const FString &Path, bool &bMissing);
+	PyObject *GetStringCode(const char *Source);
+
+	void Clear();
+	PyObject *GetStats();
+
+private:
+	FPythonCodeCache();
+
+	struct FFileEntry
+	{
+		PyObject *Code = nullptr;
+		FDateTime ModificationTime;
+		int64 Size = 0;
+	};
+
+	struct FStringEntry
+	{
+		PyObject *Code = nullptr;
+		TArray<ANSICHAR> Source;
+	};
+
+	PyObject *Compile(const char *Source, const char *Filename);
+	PyObject *LoadBytecode(const FString &Path, uint64 SourceHash);
+	void SaveBytecode(const FString &Path, uint64 SourceHash, PyObject *Code);
+	FString GetBytecodePath(const FString &Path) const;
+
+	TMap<FString, FFileEntry> Files;
+	TMap<uint64, FStringEntry> Strings;
+	TMap<FString, FString> ResolvedScripts;
+	// the resolved scripts are dropped whenever the search paths change
+	TArray<FString> ResolvedScriptsPaths;
+
+	uint64 FileHits;
+	uint64 FileMisses;
+	uint64 StringHits;
+	uint64 StringMisses;
+	uint64 BytecodeHits;
+	uint64 ResolveHits;
+	uint64 ResolveMisses;
+	uint64 Compilations;
+	double CompileTime;
+};
+
+PyObject *py_unreal_engine_code_cache_stats(PyObject *, PyObject *);
+PyObject *py_unreal_engine_code_cache_clear(PyObject *, PyObject *);
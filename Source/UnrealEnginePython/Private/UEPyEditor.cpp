@@ -44,6 +44,11 @@
 
 #include "UEPyIPlugin.h"
 
+#include "AssetImportTask.h"
+#include "FileHelpers.h"
+#include "Async/ParallelFor.h"
+#include "Misc/SecureHash.h"
+
 
 PyObject *py_unreal_engine_redraw_all_viewports(PyObject * self, PyObject * args)
 {
@@ -348,32 +353,11 @@ PyObject *py_unreal_engine_editor_select_actor(PyObject * self, PyObject * args)
 	Py_RETURN_NONE;
 }
 
-PyObject *py_unreal_engine_import_asset(PyObject * self, PyObject * args)
+// resolve the factory argument of the import functions (None, a UFactory, a UClass or a class name)
+static bool ue_py_get_import_factory(PyObject *obj, UFactory *& factory)
 {
-
-	if (!GEditor)
-		return PyErr_Format(PyExc_Exception, "no GEditor found");
-
-	//char *filename;
-	PyObject * assetsObject = nullptr;
-	char *destination;
-	PyObject *obj = nullptr;
-	PyObject *py_sync = nullptr;
-	if (!PyArg_ParseTuple(args, "Os|OO:import_asset", &assetsObject, &destination, &obj, &py_sync))
-	{
-		return nullptr;
-	}
-
-	FString Result;
-	// avoid crash on wrong path
-	if (!FPackageName::TryConvertLongPackageNameToFilename(UTF8_TO_TCHAR(destination), Result, ""))
-	{
-		return PyErr_Format(PyExc_Exception, "invalid asset root path");
-	}
-
 	UClass *factory_class = nullptr;
-	UFactory *factory = nullptr;
-	bool sync_to_browser = false;
+	factory = nullptr;
 
 	if (!obj || obj == Py_None)
 	{
@@ -392,7 +376,8 @@ PyObject *py_unreal_engine_import_asset(PyObject * self, PyObject * args)
 		}
 		else
 		{
-			return PyErr_Format(PyExc_Exception, "uobject is not a Class");
+			PyErr_Format(PyExc_Exception, "uobject is not a Class");
+			return false;
 		}
 	}
 	else if (PyUnicodeOrString_Check(obj))
@@ -404,14 +389,16 @@ PyObject *py_unreal_engine_import_asset(PyObject * self, PyObject * args)
 			ue_PyUObject *py_obj = ue_get_python_uobject(u_class);
 			if (!py_obj)
 			{
-				return PyErr_Format(PyExc_Exception, "invalid uobject");
+				PyErr_Format(PyExc_Exception, "invalid uobject");
+				return false;
 			}
 			factory_class = (UClass *)py_obj->ue_object;
 		}
 	}
 	else
 	{
-		return PyErr_Format(PyExc_Exception, "invalid uobject");
+		PyErr_Format(PyExc_Exception, "invalid uobject");
+		return false;
 	}
 
 	if (factory_class)
@@ -419,10 +406,45 @@ PyObject *py_unreal_engine_import_asset(PyObject * self, PyObject * args)
 		factory = NewObject<UFactory>(GetTransientPackage(), factory_class);
 		if (!factory)
 		{
-			return PyErr_Format(PyExc_Exception, "unable to create factory");
+			PyErr_Format(PyExc_Exception, "unable to create factory");
+			return false;
 		}
 	}
 
+	return true;
+}
+
+PyObject *py_unreal_engine_import_asset(PyObject * self, PyObject * args)
+{
+
+	if (!GEditor)
+		return PyErr_Format(PyExc_Exception, "no GEditor found");
+
+	//char *filename;
+	PyObject * assetsObject = nullptr;
+	char *destination;
+	PyObject *obj = nullptr;
+	PyObject *py_sync = nullptr;
+	if (!PyArg_ParseTuple(args, "Os|OO:import_asset", &assetsObject, &destination, &obj, &py_sync))
+	{
+		return nullptr;
+	}
+
+	FString Result;
+	// avoid crash on wrong path
+	if (!FPackageName::TryConvertLongPackageNameToFilename(UTF8_TO_TCHAR(destination), Result, ""))
+	{
+		return PyErr_Format(PyExc_Exception, "invalid asset root path");
+	}
+
+	UFactory *factory = nullptr;
+	bool sync_to_browser = false;
+
+	if (!ue_py_get_import_factory(obj, factory))
+	{
+		return nullptr;
+	}
+
 
 	TArray<FString> files;
 
@@ -503,6 +525,404 @@ PyObject *py_unreal_engine_import_asset(PyObject * self, PyObject * args)
 	Py_RETURN_NONE;
 }
 
+// source file prefetched (and hashed) on a worker thread before being handed to the factory
+struct FPythonBatchImportItem
+{
+	FString Filename;
+	FString Hash;
+	double ReadTime = 0;
+	// negative when the factory did not broadcast the import events
+	double ImportTime = -1;
+	bool bReadable = false;
+	bool bSkipped = false;
+	TArray<UObject *> Objects;
+};
+
+// the factory, the tasks and the imported objects must survive the python callbacks
+// (and the other python threads running while the GIL is released) of the whole batch
+struct FPythonBatchImportRoots
+{
+	TArray<UObject *> Objects;
+
+	void Add(UObject *u_object)
+	{
+		if (u_object && !u_object->IsRooted())
+		{
+			u_object->AddToRoot();
+			Objects.Add(u_object);
+		}
+	}
+
+	~FPythonBatchImportRoots()
+	{
+		for (UObject *u_object : Objects)
+		{
+			u_object->RemoveFromRoot();
+		}
+	}
+};
+
+// times every file of an ImportAssetTasks() call between the pre and post import events of its factory
+// (nested imports, like the textures of an fbx, are accounted to the outer file)
+struct FPythonBatchImportTimer
+{
+	TMap<FString, double> Times;
+	FString Filename;
+	double Start = 0;
+	int32 Depth = 0;
+
+	FPythonBatchImportTimer()
+	{
+#if ENGINE_MAJOR_VERSION == 5 || (ENGINE_MAJOR_VERSION == 4 && ENGINE_MINOR_VERSION > 21)
+		UImportSubsystem *ImportSubsystem = GEditor->GetEditorSubsystem<UImportSubsystem>();
+		ImportSubsystem->OnAssetPreImport.AddRaw(this, &FPythonBatchImportTimer::OnPreImport);
+		ImportSubsystem->OnAssetPostImport.AddRaw(this, &FPythonBatchImportTimer::OnPostImport);
+#else
+		FEditorDelegates::OnAssetPreImport.AddRaw(this, &FPythonBatchImportTimer::OnPreImport);
+		FEditorDelegates::OnAssetPostImport.AddRaw(this, &FPythonBatchImportTimer::OnPostImport);
+#endif
+	}
+
+	~FPythonBatchImportTimer()
+	{
+#if ENGINE_MAJOR_VERSION == 5 || (ENGINE_MAJOR_VERSION == 4 && ENGINE_MINOR_VERSION > 21)
+		if (GEditor)
+		{
+			UImportSubsystem *ImportSubsystem = GEditor->GetEditorSubsystem<UImportSubsystem>();
+			ImportSubsystem->OnAssetPreImport.RemoveAll(this);
+			ImportSubsystem->OnAssetPostImport.RemoveAll(this);
+		}
+#else
+		FEditorDelegates::OnAssetPreImport.RemoveAll(this);
+		FEditorDelegates::OnAssetPostImport.RemoveAll(this);
+#endif
+	}
+
+	static FString GetKey(const FString& InFilename)
+	{
+		FString Key = FPaths::ConvertRelativePathToFull(InFilename);
+		FPaths::NormalizeFilename(Key);
+		return Key;
+	}
+
+	// negative when the file has not been timed
+	double GetTime(const FString& InFilename) const
+	{
+		const double *Time = Times.Find(GetKey(InFilename));
+		return Time ? *Time : -1;
+	}
+
+	void OnPreImport(UFactory *Factory, UClass *Class, UObject *Parent, const FName& Name, const TCHAR *Type)
+	{
+		if (Depth++ == 0)
+		{
+			Filename = GetKey(UFactory::GetCurrentFilename());
+			Start = FPlatformTime::Seconds();
+		}
+	}
+
+	void OnPostImport(UFactory *Factory, UObject *Object)
+	{
+		if (Depth <= 0)
+			return;
+		if (--Depth == 0)
+		{
+			Times.FindOrAdd(Filename) += FPlatformTime::Seconds() - Start;
+		}
+	}
+};
+
+static void ue_py_load_import_hash_cache(const FString& CacheFilename, TMap<FString, FString>& Cache)
+{
+	TArray<FString> Lines;
+	if (!FFileHelper::LoadFileToStringArray(Lines, *CacheFilename))
+		return;
+	for (const FString& Line : Lines)
+	{
+		FString Key;
+		FString Hash;
+		// format is <hash>\t<destination>|<source file>
+		if (Line.Split(TEXT("\t"), &Hash, &Key))
+		{
+			Cache.Add(Key, Hash);
+		}
+	}
+}
+
+static void ue_py_save_import_hash_cache(const FString& CacheFilename, TMap<FString, FString>& Cache)
+{
+	TArray<FString> Lines;
+	Lines.Reserve(Cache.Num());
+	for (TPair<FString, FString>& Pair : Cache)
+	{
+		Lines.Add(Pair.Value + TEXT("\t") + Pair.Key);
+	}
+	FFileHelper::SaveStringArrayToFile(Lines, *CacheFilename);
+}
+
+PyObject *py_unreal_engine_import_assets_batch(PyObject * self, PyObject * args, PyObject *kwargs)
+{
+
+	if (!GEditor)
+		return PyErr_Format(PyExc_Exception, "no GEditor found");
+
+	PyObject *py_files;
+	char *destination;
+	PyObject *obj = nullptr;
+	int batch_size = 32;
+	char *hash_cache = nullptr;
+	PyObject *py_save = nullptr;
+	PyObject *py_on_progress = nullptr;
+
+	static char *kw_names[] = { (char *)"files", (char *)"destination", (char *)"factory", (char *)"batch_size", (char *)"hash_cache", (char *)"save", (char *)"on_progress", NULL };
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "Os|OizOO:import_assets_batch", kw_names, &py_files, &destination, &obj, &batch_size, &hash_cache, &py_save, &py_on_progress))
+	{
+		return nullptr;
+	}
+
+	FString Result;
+	// avoid crash on wrong path
+	if (!FPackageName::TryConvertLongPackageNameToFilename(UTF8_TO_TCHAR(destination), Result, ""))
+	{
+		return PyErr_Format(PyExc_Exception, "invalid asset root path");
+	}
+
+	if (py_on_progress == Py_None)
+		py_on_progress = nullptr;
+
+	if (py_on_progress && !PyCallable_Check(py_on_progress))
+		return PyErr_Format(PyExc_Exception, "on_progress is not a callable");
+
+	if (batch_size < 1)
+		batch_size = 1;
+
+	bool save = !py_save || PyObject_IsTrue(py_save);
+
+	UFactory *factory = nullptr;
+	if (!ue_py_get_import_factory(obj, factory))
+	{
+		return nullptr;
+	}
+
+	TArray<FPythonBatchImportItem> items;
+
+	if (PyUnicodeOrString_Check(py_files))
+	{
+		FPythonBatchImportItem item;
+		item.Filename = UTF8_TO_TCHAR(UEPyUnicode_AsUTF8(py_files));
+		items.Add(item);
+	}
+	else
+	{
+		PyObject *py_iter = PyObject_GetIter(py_files);
+		if (!py_iter)
+			return PyErr_Format(PyExc_Exception, "Not a string nor valid iterable of strings");
+
+		while (PyObject *py_item = PyIter_Next(py_iter))
+		{
+			if (!PyUnicodeOrString_Check(py_item))
+			{
+				Py_DECREF(py_item);
+				Py_DECREF(py_iter);
+				return PyErr_Format(PyExc_Exception, "Not a string nor valid iterable of strings");
+			}
+			FPythonBatchImportItem item;
+			item.Filename = UTF8_TO_TCHAR(UEPyUnicode_AsUTF8(py_item));
+			items.Add(item);
+			Py_DECREF(py_item);
+		}
+		Py_DECREF(py_iter);
+	}
+
+	FString Destination = UTF8_TO_TCHAR(destination);
+	FString CacheFilename = hash_cache ? FString(UTF8_TO_TCHAR(hash_cache)) : FString();
+	TMap<FString, FString> Cache;
+	if (!CacheFilename.IsEmpty())
+	{
+		ue_py_load_import_hash_cache(CacheFilename, Cache);
+	}
+
+	FAssetRegistryModule& AssetRegistryModule = FModuleManager::GetModuleChecked<FAssetRegistryModule>("AssetRegistry");
+	FAssetToolsModule& AssetToolsModule = FModuleManager::LoadModuleChecked<FAssetToolsModule>("AssetTools");
+
+	FPythonBatchImportRoots roots;
+	roots.Add(factory);
+
+	TSet<UPackage *> packages_to_save;
+	double save_time = 0;
+
+	// an exception raised by on_progress stops the import after the current batch
+	PyObject *py_exc_type = nullptr;
+	PyObject *py_exc_value = nullptr;
+	PyObject *py_exc_traceback = nullptr;
+
+	for (int32 batch_start = 0; batch_start < items.Num(); batch_start += batch_size)
+	{
+		int32 batch_num = FMath::Min(batch_size, items.Num() - batch_start);
+
+		// read and hash the sources of the whole batch on the task graph,
+		// this also warms the os file cache for the factories
+		Py_BEGIN_ALLOW_THREADS;
+		ParallelFor(batch_num, [&items, batch_start](int32 Index)
+		{
+			FPythonBatchImportItem& item = items[batch_start + Index];
+			double start = FPlatformTime::Seconds();
+			TArray<uint8> Data;
+			if (FFileHelper::LoadFileToArray(Data, *item.Filename, FILEREAD_Silent))
+			{
+				item.bReadable = true;
+				item.Hash = FMD5::HashBytes(Data.GetData(), Data.Num());
+			}
+			item.ReadTime = FPlatformTime::Seconds() - start;
+		});
+		Py_END_ALLOW_THREADS;
+
+		// objects can only be created on the game thread
+		TArray<UAssetImportTask *> tasks;
+		TArray<int32> task_items;
+		for (int32 i = batch_start; i < batch_start + batch_num; i++)
+		{
+			FPythonBatchImportItem& item = items[i];
+			if (!item.bReadable)
+				continue;
+
+			FString Key = Destination + TEXT("|") + item.Filename;
+			FString *CachedHash = Cache.Find(Key);
+			if (CachedHash && *CachedHash == item.Hash)
+			{
+				FString PackageName = Destination / ObjectTools::SanitizeObjectName(FPaths::GetBaseFilename(item.Filename));
+				TArray<FAssetData> existing_assets;
+				AssetRegistryModule.Get().GetAssetsByPackageName(FName(*PackageName), existing_assets);
+				if (existing_assets.Num() > 0)
+				{
+					item.bSkipped = true;
+					continue;
+				}
+			}
+
+			UAssetImportTask *task = NewObject<UAssetImportTask>();
+			task->Filename = item.Filename;
+			task->DestinationPath = Destination;
+			task->Factory = factory;
+			task->bAutomated = true;
+			task->bReplaceExisting = true;
+			task->bSave = false;
+			roots.Add(task);
+			tasks.Add(task);
+			task_items.Add(i);
+		}
+
+		// a single ImportAssetTasks() call per batch, so the asset tools notifications
+		// (and the content browser sync) happen once
+		FPythonBatchImportTimer timer;
+		if (tasks.Num() > 0)
+		{
+			Py_BEGIN_ALLOW_THREADS;
+			AssetToolsModule.Get().ImportAssetTasks(tasks);
+			Py_END_ALLOW_THREADS;
+		}
+
+		for (int32 t = 0; t < tasks.Num(); t++)
+		{
+			FPythonBatchImportItem& item = items[task_items[t]];
+			item.ImportTime = timer.GetTime(item.Filename);
+
+			for (const FString& ObjectPath : tasks[t]->ImportedObjectPaths)
+			{
+				UObject *u_object = FindObject<UObject>(nullptr, *ObjectPath);
+				if (!u_object)
+					continue;
+				roots.Add(u_object);
+				item.Objects.Add(u_object);
+				packages_to_save.Add(u_object->GetOutermost());
+			}
+
+			if (item.Objects.Num() > 0)
+			{
+				Cache.Add(Destination + TEXT("|") + item.Filename, item.Hash);
+			}
+		}
+
+		if (py_on_progress)
+		{
+			PyObject *ret = PyObject_CallFunction(py_on_progress, (char *)"ii", batch_start + batch_num, items.Num());
+			if (!ret)
+			{
+				// the already imported packages are still saved and hashed
+				PyErr_Fetch(&py_exc_type, &py_exc_value, &py_exc_traceback);
+				break;
+			}
+			Py_DECREF(ret);
+		}
+	}
+
+	// a single save phase for all of the imported packages
+	if (save && packages_to_save.Num() > 0)
+	{
+		double start = FPlatformTime::Seconds();
+		Py_BEGIN_ALLOW_THREADS;
+		UEditorLoadingAndSavingUtils::SavePackages(packages_to_save.Array(), true);
+		Py_END_ALLOW_THREADS;
+		save_time = FPlatformTime::Seconds() - start;
+	}
+
+	if (!CacheFilename.IsEmpty())
+	{
+		ue_py_save_import_hash_cache(CacheFilename, Cache);
+	}
+
+	if (py_exc_type)
+	{
+		PyErr_Restore(py_exc_type, py_exc_value, py_exc_traceback);
+		return nullptr;
+	}
+
+	PyObject *py_results = PyList_New(0);
+	for (FPythonBatchImportItem& item : items)
+	{
+		PyObject *py_objects = PyList_New(0);
+		for (UObject *u_object : item.Objects)
+		{
+			ue_PyUObject *py_obj = ue_get_python_uobject(u_object);
+			if (py_obj)
+			{
+				PyList_Append(py_objects, (PyObject *)py_obj);
+			}
+		}
+
+		PyObject *py_result = PyDict_New();
+		PyObject *py_value = PyUnicode_FromString(TCHAR_TO_UTF8(*item.Filename));
+		PyDict_SetItemString(py_result, "filename", py_value);
+		Py_DECREF(py_value);
+		py_value = PyUnicode_FromString(TCHAR_TO_UTF8(*item.Hash));
+		PyDict_SetItemString(py_result, "hash", py_value);
+		Py_DECREF(py_value);
+		PyDict_SetItemString(py_result, "objects", py_objects);
+		Py_DECREF(py_objects);
+		PyDict_SetItemString(py_result, "readable", item.bReadable ? Py_True : Py_False);
+		PyDict_SetItemString(py_result, "skipped", item.bSkipped ? Py_True : Py_False);
+		py_value = PyFloat_FromDouble(item.ReadTime);
+		PyDict_SetItemString(py_result, "read_time", py_value);
+		Py_DECREF(py_value);
+		if (item.ImportTime >= 0)
+		{
+			py_value = PyFloat_FromDouble(item.ImportTime);
+			PyDict_SetItemString(py_result, "import_time", py_value);
+			Py_DECREF(py_value);
+		}
+		else
+		{
+			PyDict_SetItemString(py_result, "import_time", Py_None);
+		}
+
+		PyList_Append(py_results, py_result);
+		Py_DECREF(py_result);
+	}
+
+	return Py_BuildValue((char *)"(Nf)", py_results, save_time);
+}
+
 PyObject *py_unreal_engine_editor_tick(PyObject * self, PyObject * args)
 {
 	float delta_seconds = FApp::GetDeltaTime();
@@ -967,12 +1387,41 @@ PyObject *py_unreal_engine_delete_object(PyObject * self, PyObject * args)
 }
 
 
+// build the list returned by the get_assets* family, FAssetData wrappers never trigger a package load
+static PyObject *ue_py_assets_to_list(TArray<FAssetData>& assets, bool return_asset_data)
+{
+	PyObject *assets_list = PyList_New(0);
+
+	for (const FAssetData& asset : assets)
+	{
+		if (!asset.IsValid())
+			continue;
+		if (return_asset_data)
+		{
+			PyObject *ret = py_ue_new_fassetdata(asset);
+			PyList_Append(assets_list, ret);
+			Py_DECREF(ret);
+		}
+		else
+		{
+			ue_PyUObject *ret = ue_get_python_uobject(asset.GetAsset());
+			if (ret)
+			{
+				PyList_Append(assets_list, (PyObject *)ret);
+			}
+		}
+	}
+
+	return assets_list;
+}
+
 PyObject *py_unreal_engine_get_assets(PyObject * self, PyObject * args)
 {
 	char *path;
 	PyObject *py_recursive = nullptr;
+	PyObject *py_return_asset_data = nullptr;
 
-	if (!PyArg_ParseTuple(args, "s|O:get_assets", &path, &py_recursive))
+	if (!PyArg_ParseTuple(args, "s|OO:get_assets", &path, &py_recursive, &py_return_asset_data))
 	{
 		return NULL;
 	}
@@ -984,25 +1433,16 @@ PyObject *py_unreal_engine_get_assets(PyObject * self, PyObject * args)
 	if (py_recursive && PyObject_IsTrue(py_recursive))
 		recursive = true;
 
+	bool return_asset_data = false;
+	if (py_return_asset_data && PyObject_IsTrue(py_return_asset_data))
+		return_asset_data = true;
+
 	TArray<FAssetData> assets;
 
 	FAssetRegistryModule& AssetRegistryModule = FModuleManager::GetModuleChecked<FAssetRegistryModule>("AssetRegistry");
 	AssetRegistryModule.Get().GetAssetsByPath(UTF8_TO_TCHAR(path), assets, recursive);
 
-	PyObject *assets_list = PyList_New(0);
-
-	for (FAssetData asset : assets)
-	{
-		if (!asset.IsValid())
-			continue;
-		ue_PyUObject *ret = ue_get_python_uobject(asset.GetAsset());
-		if (ret)
-		{
-			PyList_Append(assets_list, (PyObject *)ret);
-		}
-	}
-
-	return assets_list;
+	return ue_py_assets_to_list(assets, return_asset_data);
 }
 
 PyObject *py_unreal_engine_get_assets_by_filter(PyObject * self, PyObject * args, PyObject *kwargs)
@@ -1039,28 +1479,140 @@ PyObject *py_unreal_engine_get_assets_by_filter(PyObject * self, PyObject * args
 	bool return_asset_data = false;
 	if (py_return_asset_data && PyObject_IsTrue(py_return_asset_data))
 		return_asset_data = true;
-	PyObject *assets_list = PyList_New(0);
-	for (FAssetData asset : assets)
+
+	return ue_py_assets_to_list(assets, return_asset_data);
+}
+
+PyObject *py_unreal_engine_get_assets_columns(PyObject * self, PyObject * args, PyObject *kwargs)
+{
+	PyObject *py_source;
+	PyObject *py_recursive = nullptr;
+	PyObject *py_tags = nullptr;
+
+	static char *kw_names[] = { (char *)"path_or_filter", (char *)"recursive", (char *)"tags", NULL };
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O|OO:get_assets_columns", kw_names, &py_source, &py_recursive, &py_tags))
 	{
-		if (!asset.IsValid())
-			continue;
-		PyObject *ret = nullptr;
-		if (return_asset_data)
+		return nullptr;
+	}
+
+	if (!GEditor)
+		return PyErr_Format(PyExc_Exception, "no GEditor found");
+
+	TArray<FName> tags;
+	if (py_tags && py_tags != Py_None)
+	{
+		PyObject *py_iter = PyObject_GetIter(py_tags);
+		if (!py_iter)
+			return PyErr_Format(PyExc_Exception, "tags must be an iterable of strings");
+		while (PyObject *py_item = PyIter_Next(py_iter))
 		{
-			ret = py_ue_new_fassetdata(asset);
+			if (!PyUnicodeOrString_Check(py_item))
+			{
+				Py_DECREF(py_item);
+				Py_DECREF(py_iter);
+				return PyErr_Format(PyExc_Exception, "tags must be an iterable of strings");
+			}
+			tags.Add(FName(UTF8_TO_TCHAR(UEPyUnicode_AsUTF8(py_item))));
+			Py_DECREF(py_item);
 		}
-		else
+		Py_DECREF(py_iter);
+	}
+
+	TArray<FAssetData> assets;
+	FAssetRegistryModule& AssetRegistryModule = FModuleManager::GetModuleChecked<FAssetRegistryModule>("AssetRegistry");
+
+	if (PyUnicodeOrString_Check(py_source))
+	{
+		bool recursive = py_recursive && PyObject_IsTrue(py_recursive);
+		FName path = FName(UTF8_TO_TCHAR(UEPyUnicode_AsUTF8(py_source)));
+		Py_BEGIN_ALLOW_THREADS;
+		AssetRegistryModule.Get().GetAssetsByPath(path, assets, recursive);
+		Py_END_ALLOW_THREADS;
+	}
+	else
+	{
+		ue_PyFARFilter *py_filter = py_ue_is_farfilter(py_source);
+		if (!py_filter)
+			return PyErr_Format(PyExc_Exception, "argument is not a path or a FARFilter");
+		py_ue_sync_farfilter((PyObject *)py_filter);
+		FARFilter& Filter = py_filter->filter;
+		Py_BEGIN_ALLOW_THREADS;
+		AssetRegistryModule.Get().GetAssets(Filter, assets);
+		Py_END_ALLOW_THREADS;
+	}
+
+	assets.RemoveAll([](const FAssetData& asset) { return !asset.IsValid(); });
+
+	Py_ssize_t count = assets.Num();
+	PyObject *py_object_path = PyList_New(count);
+	PyObject *py_package_name = PyList_New(count);
+	PyObject *py_asset_name = PyList_New(count);
+	PyObject *py_asset_class = PyList_New(count);
+	PyObject *py_package_flags = PyList_New(count);
+	PyObject *py_disk_size = PyList_New(count);
+
+	TArray<PyObject *> py_tag_columns;
+	for (int32 t = 0; t < tags.Num(); t++)
+	{
+		py_tag_columns.Add(PyList_New(count));
+	}
+
+	for (int32 i = 0; i < assets.Num(); i++)
+	{
+		const FAssetData& asset = assets[i];
+		PyList_SET_ITEM(py_object_path, i, PyUnicode_FromString(TCHAR_TO_UTF8(*asset.ObjectPath.ToString())));
+		PyList_SET_ITEM(py_package_name, i, PyUnicode_FromString(TCHAR_TO_UTF8(*asset.PackageName.ToString())));
+		PyList_SET_ITEM(py_asset_name, i, PyUnicode_FromString(TCHAR_TO_UTF8(*asset.AssetName.ToString())));
+		PyList_SET_ITEM(py_asset_class, i, PyUnicode_FromString(TCHAR_TO_UTF8(*asset.AssetClass.ToString())));
+		PyList_SET_ITEM(py_package_flags, i, PyLong_FromUnsignedLong(asset.PackageFlags));
+
+		int64 disk_size = -1;
+		ue_py_fassetdata_disk_size(asset, disk_size);
+		PyList_SET_ITEM(py_disk_size, i, PyLong_FromLongLong(disk_size));
+
+		for (int32 t = 0; t < tags.Num(); t++)
 		{
-			ret = (PyObject *)ue_get_python_uobject(asset.GetAsset());
+			FString value;
+			if (asset.GetTagValue(tags[t], value))
+			{
+				PyList_SET_ITEM(py_tag_columns[t], i, PyUnicode_FromString(TCHAR_TO_UTF8(*value)));
+			}
+			else
+			{
+				Py_INCREF(Py_None);
+				PyList_SET_ITEM(py_tag_columns[t], i, Py_None);
+			}
 		}
+	}
 
-		if (ret)
+	PyObject *py_columns = PyDict_New();
+	PyDict_SetItemString(py_columns, "object_path", py_object_path);
+	PyDict_SetItemString(py_columns, "package_name", py_package_name);
+	PyDict_SetItemString(py_columns, "asset_name", py_asset_name);
+	PyDict_SetItemString(py_columns, "asset_class", py_asset_class);
+	PyDict_SetItemString(py_columns, "package_flags", py_package_flags);
+	PyDict_SetItemString(py_columns, "disk_size", py_disk_size);
+	Py_DECREF(py_object_path);
+	Py_DECREF(py_package_name);
+	Py_DECREF(py_asset_name);
+	Py_DECREF(py_asset_class);
+	Py_DECREF(py_package_flags);
+	Py_DECREF(py_disk_size);
+
+	for (int32 t = 0; t < tags.Num(); t++)
+	{
+		// tags named like a base column (or like each other) must not overwrite it
+		FString key = tags[t].ToString();
+		if (PyDict_GetItemString(py_columns, TCHAR_TO_UTF8(*key)))
 		{
-			PyList_Append(assets_list, ret);
+			key = FString("tag:") + key;
 		}
+		PyDict_SetItemString(py_columns, TCHAR_TO_UTF8(*key), py_tag_columns[t]);
+		Py_DECREF(py_tag_columns[t]);
 	}
 
-	return assets_list;
+	return py_columns;
 }
 
 PyObject *py_unreal_engine_get_discovered_plugins(PyObject * self, PyObject * args)
@@ -1127,8 +1679,9 @@ PyObject *py_unreal_engine_get_assets_by_class(PyObject * self, PyObject * args)
 {
 	char *path;
 	PyObject *py_recursive = nullptr;
+	PyObject *py_return_asset_data = nullptr;
 
-	if (!PyArg_ParseTuple(args, "s|O:get_assets_by_class", &path, &py_recursive))
+	if (!PyArg_ParseTuple(args, "s|OO:get_assets_by_class", &path, &py_recursive, &py_return_asset_data))
 	{
 		return NULL;
 	}
@@ -1140,25 +1693,16 @@ PyObject *py_unreal_engine_get_assets_by_class(PyObject * self, PyObject * args)
 	if (py_recursive && PyObject_IsTrue(py_recursive))
 		recursive = true;
 
+	bool return_asset_data = false;
+	if (py_return_asset_data && PyObject_IsTrue(py_return_asset_data))
+		return_asset_data = true;
+
 	TArray<FAssetData> assets;
 
 	FAssetRegistryModule& AssetRegistryModule = FModuleManager::GetModuleChecked<FAssetRegistryModule>("AssetRegistry");
 	AssetRegistryModule.Get().GetAssetsByClass(FTopLevelAssetPath(UTF8_TO_TCHAR(path)), assets, recursive);
 
-	PyObject *assets_list = PyList_New(0);
-
-	for (FAssetData asset : assets)
-	{
-		if (!asset.IsValid())
-			continue;
-		ue_PyUObject *ret = ue_get_python_uobject(asset.GetAsset());
-		if (ret)
-		{
-			PyList_Append(assets_list, (PyObject *)ret);
-		}
-	}
-
-	return assets_list;
+	return ue_py_assets_to_list(assets, return_asset_data);
 }
 
 PyObject *py_unreal_engine_get_selected_assets(PyObject * self, PyObject * args)
@@ -2511,17 +3055,23 @@ PyObject *py_unreal_engine_heightmap_expand(PyObject * self, PyObject * args)
 	if (!PyArg_ParseTuple(args, "y*iiii:heightmap_expand", &buf, &width, &height, &new_width, &new_height))
 		return nullptr;
 
-	uint16 *original_data_buf = (uint16 *)buf.buf;
-
-	TArray<uint16> original_data;
-	original_data.AddZeroed(buf.len / 2);
+	if (width <= 0 || height <= 0 || new_width <= 0 || new_height <= 0)
+	{
+		PyBuffer_Release(&buf);
+		return PyErr_Format(PyExc_Exception, "invalid heightmap size");
+	}
 
-	FMemory::Memcpy(original_data.GetData(), original_data_buf, buf.len);
+	if (buf.len < (Py_ssize_t)width * height * (Py_ssize_t)sizeof(uint16))
+	{
+		PyBuffer_Release(&buf);
+		return PyErr_Format(PyExc_Exception, "not enough heightmap data, expecting %lld bytes", (long long)width * height * sizeof(uint16));
+	}
 
 	int offset_x = (new_width - width) / 2;
 	int offset_y = (new_height - height) / 2;
 
 #if ENGINE_MAJOR_VERSION == 5
+	// same logic of LandscapeEditorUtils::ExpandData (not exported anymore), rows are independent
 	auto ExpandData = [](uint16* OutData, const uint16* InData,
 		int32 OldMinX, int32 OldMinY, int32 OldMaxX, int32 OldMaxY,
 		int32 NewMinX, int32 NewMinY, int32 NewMaxX, int32 NewMaxY)
@@ -2533,7 +3083,7 @@ PyObject *py_unreal_engine_heightmap_expand(PyObject * self, PyObject * args)
 		const int32 OffsetX = NewMinX - OldMinX;
 		const int32 OffsetY = NewMinY - OldMinY;
 
-		for (int32 Y = 0; Y < NewHeight; ++Y)
+		ParallelFor(NewHeight, [&](int32 Y)
 		{
 			const int32 OldY = FMath::Clamp<int32>(Y + OffsetY, 0, OldHeight - 1);
 
@@ -2556,18 +3106,199 @@ PyObject *py_unreal_engine_heightmap_expand(PyObject * self, PyObject * args)
 			{
 				OutData[Y * NewWidth + X] = PadRight;
 			}
-		}
+		});
 	};
-	
-	TArray<uint16> data;
 
-	ExpandData(data.GetData(), original_data.GetData(), 0, 0, width - 1, height - 1, -offset_x, -offset_y, new_width - offset_x - 1, new_height - offset_y - 1);
+	PyObject *py_data = PyByteArray_FromStringAndSize(nullptr, (Py_ssize_t)new_width * new_height * sizeof(uint16));
+	uint16 *data = (uint16 *)PyByteArray_AsString(py_data);
+
+	Py_BEGIN_ALLOW_THREADS;
+	ExpandData(data, (const uint16 *)buf.buf, 0, 0, width - 1, height - 1, -offset_x, -offset_y, new_width - offset_x - 1, new_height - offset_y - 1);
+	Py_END_ALLOW_THREADS;
+
+	PyBuffer_Release(&buf);
+
+	return py_data;
 #else
+	TArray<uint16> original_data((const uint16 *)buf.buf, width * height);
+	PyBuffer_Release(&buf);
+
 	TArray<uint16> data = LandscapeEditorUtils::ExpandData<uint16>(original_data, 0, 0, width - 1, height - 1, -offset_x, -offset_y, new_width - offset_x - 1, new_height - offset_y - 1);
-#endif
 
 	return PyByteArray_FromStringAndSize((char *)data.GetData(), data.Num() * sizeof(uint16));
+#endif
+}
+
+PyObject *py_unreal_engine_heightmap_resample(PyObject * self, PyObject * args)
+{
+	Py_buffer buf;
+	int width;
+	int height;
+	int new_width;
+	int new_height;
+	if (!PyArg_ParseTuple(args, "y*iiii:heightmap_resample", &buf, &width, &height, &new_width, &new_height))
+		return nullptr;
+
+	if (width <= 0 || height <= 0 || new_width <= 0 || new_height <= 0)
+	{
+		PyBuffer_Release(&buf);
+		return PyErr_Format(PyExc_Exception, "invalid heightmap size");
+	}
+
+	if (buf.len < (Py_ssize_t)width * height * (Py_ssize_t)sizeof(uint16))
+	{
+		PyBuffer_Release(&buf);
+		return PyErr_Format(PyExc_Exception, "not enough heightmap data, expecting %lld bytes", (long long)width * height * sizeof(uint16));
+	}
+
+	PyObject *py_data = PyByteArray_FromStringAndSize(nullptr, (Py_ssize_t)new_width * new_height * sizeof(uint16));
+	uint16 *data = (uint16 *)PyByteArray_AsString(py_data);
+	const uint16 *original_data = (const uint16 *)buf.buf;
+
+	// heightmaps are vertex based: the corners of the old and new grids match
+	const float scale_x = new_width > 1 ? (float)(width - 1) / (new_width - 1) : 0;
+	const float scale_y = new_height > 1 ? (float)(height - 1) / (new_height - 1) : 0;
+
+	Py_BEGIN_ALLOW_THREADS;
+	// the horizontal source positions are the same for every row
+	TArray<int32> x0s;
+	TArray<float> fxs;
+	x0s.SetNumUninitialized(new_width);
+	fxs.SetNumUninitialized(new_width);
+	for (int32 x = 0; x < new_width; x++)
+	{
+		const float sx = x * scale_x;
+		x0s[x] = FMath::Min((int32)sx, width - 1);
+		fxs[x] = sx - x0s[x];
+	}
+
+	ParallelFor(new_height, [&](int32 y)
+	{
+		const float sy = y * scale_y;
+		const int32 y0 = FMath::Min((int32)sy, height - 1);
+		const int32 y1 = FMath::Min(y0 + 1, height - 1);
+		const float fy = sy - y0;
+		const uint16 *row0 = original_data + y0 * width;
+		const uint16 *row1 = original_data + y1 * width;
+		uint16 *out = data + y * new_width;
+		for (int32 x = 0; x < new_width; x++)
+		{
+			const int32 x0 = x0s[x];
+			const int32 x1 = FMath::Min(x0 + 1, width - 1);
+			const float fx = fxs[x];
+			const float top = row0[x0] + (row0[x1] - row0[x0]) * fx;
+			const float bottom = row1[x0] + (row1[x1] - row1[x0]) * fx;
+			out[x] = (uint16)FMath::Clamp(FMath::RoundToInt(top + (bottom - top) * fy), 0, 65535);
+		}
+	});
+	Py_END_ALLOW_THREADS;
+
+	PyBuffer_Release(&buf);
+
+	return py_data;
+}
+
+PyObject *py_unreal_engine_heightmap_blur(PyObject * self, PyObject * args)
+{
+	Py_buffer buf;
+	int width;
+	int height;
+	int radius;
+	int passes = 1;
+	if (!PyArg_ParseTuple(args, "y*iii|i:heightmap_blur", &buf, &width, &height, &radius, &passes))
+		return nullptr;
+
+	if (width <= 0 || height <= 0 || radius < 0 || passes < 0)
+	{
+		PyBuffer_Release(&buf);
+		return PyErr_Format(PyExc_Exception, "invalid heightmap blur arguments");
+	}
+
+	if (buf.len < (Py_ssize_t)width * height * (Py_ssize_t)sizeof(uint16))
+	{
+		PyBuffer_Release(&buf);
+		return PyErr_Format(PyExc_Exception, "not enough heightmap data, expecting %lld bytes", (long long)width * height * sizeof(uint16));
+	}
+
+	PyObject *py_data = PyByteArray_FromStringAndSize(nullptr, (Py_ssize_t)width * height * sizeof(uint16));
+	uint16 *data = (uint16 *)PyByteArray_AsString(py_data);
+	const uint16 *original_data = (const uint16 *)buf.buf;
+
+	Py_BEGIN_ALLOW_THREADS;
+	TArray<float> values;
+	TArray<float> temp;
+	values.SetNumUninitialized(width * height);
+	temp.SetNumUninitialized(width * height);
+	for (int32 i = 0; i < width * height; i++)
+	{
+		values[i] = original_data[i];
+	}
+
+	// separable box blur with running sums (O(1) per sample whatever the radius),
+	// three passes are a good approximation of a gaussian
+	const float inv = 1.0f / (2 * radius + 1);
+	for (int32 pass = 0; pass < passes && radius > 0; pass++)
+	{
+		float *in = values.GetData();
+		float *out = temp.GetData();
+		ParallelFor(height, [&](int32 y)
+		{
+			const float *row = in + y * width;
+			float *out_row = out + y * width;
+			float sum = 0;
+			for (int32 k = -radius; k <= radius; k++)
+			{
+				sum += row[FMath::Clamp(k, 0, width - 1)];
+			}
+			for (int32 x = 0; x < width; x++)
+			{
+				out_row[x] = sum * inv;
+				sum += row[FMath::Min(x + radius + 1, width - 1)] - row[FMath::Max(x - radius, 0)];
+			}
+		});
+
+		// columns are processed in blocks, so every step reads contiguous memory
+		const int32 block = 64;
+		ParallelFor((width + block - 1) / block, [&](int32 b)
+		{
+			const int32 x_start = b * block;
+			const int32 x_end = FMath::Min(x_start + block, width);
+			float sums[block];
+			for (int32 x = x_start; x < x_end; x++)
+			{
+				sums[x - x_start] = 0;
+			}
+			for (int32 k = -radius; k <= radius; k++)
+			{
+				const float *row = out + FMath::Clamp(k, 0, height - 1) * width;
+				for (int32 x = x_start; x < x_end; x++)
+				{
+					sums[x - x_start] += row[x];
+				}
+			}
+			for (int32 y = 0; y < height; y++)
+			{
+				const float *add_row = out + FMath::Min(y + radius + 1, height - 1) * width;
+				const float *sub_row = out + FMath::Max(y - radius, 0) * width;
+				float *out_row = in + y * width;
+				for (int32 x = x_start; x < x_end; x++)
+				{
+					out_row[x] = sums[x - x_start] * inv;
+					sums[x - x_start] += add_row[x] - sub_row[x];
+				}
+			}
+		});
+	}
+
+	for (int32 i = 0; i < width * height; i++)
+	{
+		data[i] = (uint16)FMath::Clamp(FMath::RoundToInt(values[i]), 0, 65535);
+	}
+	Py_END_ALLOW_THREADS;
+
+	PyBuffer_Release(&buf);
 
+	return py_data;
 }
 
 PyObject *py_unreal_engine_heightmap_import(PyObject * self, PyObject * args)
@@ -12,6 +12,7 @@ PyObject *py_unreal_engine_editor_get_selected_actors(PyObject *, PyObject *);
 PyObject *py_unreal_engine_editor_deselect_actors(PyObject *, PyObject *);
 PyObject *py_unreal_engine_editor_select_actor(PyObject *, PyObject *);
 PyObject *py_unreal_engine_import_asset(PyObject *, PyObject *);
+PyObject *py_unreal_engine_import_assets_batch(PyObject *, PyObject *, PyObject *);
 PyObject *py_unreal_engine_get_asset(PyObject *, PyObject *);
 PyObject *py_unreal_engine_is_loading_assets(PyObject *, PyObject *);
 PyObject *py_unreal_engine_wait_for_assets(PyObject *, PyObject *);
@@ -22,6 +23,7 @@ PyObject *py_unreal_engine_get_assets(PyObject *, PyObject *);
 PyObject *py_unreal_engine_get_selected_assets(PyObject *, PyObject *);
 PyObject *py_unreal_engine_get_assets_by_class(PyObject *, PyObject *);
 PyObject *py_unreal_engine_get_assets_by_filter(PyObject *, PyObject *, PyObject *);
+PyObject *py_unreal_engine_get_assets_columns(PyObject *, PyObject *, PyObject *);
 PyObject *py_unreal_engine_set_fbx_import_option(PyObject *, PyObject *);
 
 PyObject *py_unreal_engine_redraw_all_viewports(PyObject *, PyObject *);
@@ -123,6 +125,8 @@ PyObject *py_unreal_engine_all_viewport_clients(PyObject *, PyObject *);
 PyObject *py_unreal_engine_editor_sync_browser_to_assets(PyObject *, PyObject *);
 
 PyObject *py_unreal_engine_heightmap_expand(PyObject *, PyObject *);
+PyObject *py_unreal_engine_heightmap_resample(PyObject *, PyObject *);
+PyObject *py_unreal_engine_heightmap_blur(PyObject *, PyObject *);
 PyObject *py_unreal_engine_heightmap_import(PyObject *, PyObject *);
 
 PyObject *py_unreal_engine_play_preview_sound(PyObject *, PyObject *);
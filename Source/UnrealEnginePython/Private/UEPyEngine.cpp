@@ -910,6 +910,135 @@ PyObject *py_unreal_engine_get_viewport_screenshot(PyObject *self, PyObject * ar
 	return bitmap_tuple;
 }
 
+bool FPythonViewportPixels::ParseFormat(const char *name, EPythonViewportPixelFormat &format)
+{
+	if (!FCStringAnsi::Stricmp(name, "rgba8"))
+		format = EPythonViewportPixelFormat::RGBA8;
+	else if (!FCStringAnsi::Stricmp(name, "bgra8"))
+		format = EPythonViewportPixelFormat::BGRA8;
+	else if (!FCStringAnsi::Stricmp(name, "rgba32f"))
+		format = EPythonViewportPixelFormat::RGBA32F;
+	else
+		return false;
+	return true;
+}
+
+int32 FPythonViewportPixels::GetPixelSize(EPythonViewportPixelFormat format)
+{
+	return format == EPythonViewportPixelFormat::RGBA32F ? sizeof(float) * 4 : sizeof(uint8) * 4;
+}
+
+bool FPythonViewportPixels::Read(FViewport *viewport, EPythonViewportPixelFormat format)
+{
+	Format = format;
+	Size = viewport->GetSizeXY();
+	Colors.Reset();
+	LinearColors.Reset();
+
+	if (Size.X <= 0 || Size.Y <= 0)
+		return false;
+
+	if (format == EPythonViewportPixelFormat::RGBA32F)
+	{
+		if (!viewport->ReadLinearColorPixels(LinearColors))
+			return false;
+		return LinearColors.Num() == Size.X * Size.Y;
+	}
+
+	if (!GetViewportScreenShot(viewport, Colors))
+		return false;
+	return Colors.Num() == Size.X * Size.Y;
+}
+
+void FPythonViewportPixels::CopyTo(uint8 *dst) const
+{
+	switch (Format)
+	{
+	case EPythonViewportPixelFormat::RGBA32F:
+		// FLinearColor is already four packed floats in RGBA order
+		FMemory::Memcpy(dst, LinearColors.GetData(), LinearColors.Num() * sizeof(FLinearColor));
+		break;
+	case EPythonViewportPixelFormat::BGRA8:
+		FMemory::Memcpy(dst, Colors.GetData(), Colors.Num() * sizeof(FColor));
+		break;
+	default:
+		for (const FColor &color : Colors)
+		{
+			*dst++ = color.R;
+			*dst++ = color.G;
+			*dst++ = color.B;
+			*dst++ = color.A;
+		}
+		break;
+	}
+}
+
+static PyObject *ue_py_viewport_screenshot_buffer(FViewport *viewport, const char *format_name, PyObject *py_buffer)
+{
+	EPythonViewportPixelFormat format;
+	if (!FPythonViewportPixels::ParseFormat(format_name, format))
+		return PyErr_Format(PyExc_Exception, "unsupported pixel format %s (expected rgba8, bgra8 or rgba32f)", format_name);
+
+	if (py_buffer == Py_None)
+		py_buffer = nullptr;
+
+	if (py_buffer && !PyObject_CheckBuffer(py_buffer))
+		return PyErr_Format(PyExc_Exception, "argument does not support the buffer protocol");
+
+	if (!viewport)
+		Py_RETURN_NONE;
+
+	FPythonViewportPixels pixels;
+	if (!pixels.Read(viewport, format))
+		Py_RETURN_NONE;
+
+	const int64 num_bytes = pixels.GetNumBytes();
+
+	if (py_buffer)
+	{
+		Py_buffer view;
+		if (PyObject_GetBuffer(py_buffer, &view, PyBUF_SIMPLE | PyBUF_WRITABLE) == -1)
+			return nullptr;
+
+		if (view.len < num_bytes)
+		{
+			PyBuffer_Release(&view);
+			return PyErr_Format(PyExc_Exception, "buffer is too small: %lld bytes required for a %dx%d frame", num_bytes, pixels.Size.X, pixels.Size.Y);
+		}
+
+		Py_BEGIN_ALLOW_THREADS;
+		pixels.CopyTo((uint8 *)view.buf);
+		Py_END_ALLOW_THREADS;
+
+		PyBuffer_Release(&view);
+		Py_INCREF(py_buffer);
+	}
+	else
+	{
+		py_buffer = PyByteArray_FromStringAndSize(nullptr, num_bytes);
+		if (!py_buffer)
+			return nullptr;
+		pixels.CopyTo((uint8 *)PyByteArray_AsString(py_buffer));
+	}
+
+	return Py_BuildValue("(iiN)", pixels.Size.X, pixels.Size.Y, py_buffer);
+}
+
+PyObject *py_unreal_engine_get_viewport_screenshot_buffer(PyObject *self, PyObject * args, PyObject *kwargs)
+{
+	char *format_name = (char *)"rgba8";
+	PyObject *py_buffer = nullptr;
+
+	static char *kw_names[] = { (char *)"format", (char *)"buffer", nullptr };
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "|sO:get_viewport_screenshot_buffer", kw_names, &format_name, &py_buffer))
+	{
+		return nullptr;
+	}
+
+	FViewport *viewport = GEngine->GameViewport ? GEngine->GameViewport->Viewport : nullptr;
+	return ue_py_viewport_screenshot_buffer(viewport, format_name, py_buffer);
+}
+
 PyObject *py_unreal_engine_get_viewport_size(PyObject *self, PyObject * args)
 {
 
@@ -1055,6 +1184,34 @@ PyObject *py_unreal_engine_editor_get_pie_viewport_screenshot(PyObject *self, Py
 	return bitmap_tuple;
 }
 
+PyObject *py_unreal_engine_editor_get_active_viewport_screenshot_buffer(PyObject *self, PyObject * args, PyObject *kwargs)
+{
+	char *format_name = (char *)"rgba8";
+	PyObject *py_buffer = nullptr;
+
+	static char *kw_names[] = { (char *)"format", (char *)"buffer", nullptr };
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "|sO:editor_get_active_viewport_screenshot_buffer", kw_names, &format_name, &py_buffer))
+	{
+		return nullptr;
+	}
+
+	return ue_py_viewport_screenshot_buffer(GEditor->GetActiveViewport(), format_name, py_buffer);
+}
+
+PyObject *py_unreal_engine_editor_get_pie_viewport_screenshot_buffer(PyObject *self, PyObject * args, PyObject *kwargs)
+{
+	char *format_name = (char *)"rgba8";
+	PyObject *py_buffer = nullptr;
+
+	static char *kw_names[] = { (char *)"format", (char *)"buffer", nullptr };
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "|sO:editor_get_pie_viewport_screenshot_buffer", kw_names, &format_name, &py_buffer))
+	{
+		return nullptr;
+	}
+
+	return ue_py_viewport_screenshot_buffer(GEditor->GetPIEViewport(), format_name, py_buffer);
+}
+
 PyObject *py_unreal_engine_editor_get_pie_viewport_size(PyObject *self, PyObject * args)
 {
 
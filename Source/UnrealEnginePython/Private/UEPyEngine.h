@@ -4,6 +4,29 @@
 
 #include "UEPyModule.h"
 
+enum class EPythonViewportPixelFormat
+{
+	RGBA8,
+	BGRA8,
+	RGBA32F,
+};
+
+// a single viewport readback, converted to a packed pixel format on demand
+struct FPythonViewportPixels
+{
+	FIntPoint Size = FIntPoint::ZeroValue;
+	EPythonViewportPixelFormat Format = EPythonViewportPixelFormat::RGBA8;
+	TArray<FColor> Colors;
+	TArray<FLinearColor> LinearColors;
+
+	static bool ParseFormat(const char *name, EPythonViewportPixelFormat &format);
+	static int32 GetPixelSize(EPythonViewportPixelFormat format);
+
+	bool Read(FViewport *viewport, EPythonViewportPixelFormat format);
+	int64 GetNumBytes() const { return (int64)Size.X * Size.Y * GetPixelSize(Format); }
+	void CopyTo(uint8 *dst) const;
+};
+
 PyObject *py_unreal_engine_log(PyObject *, PyObject *);
 PyObject *py_unreal_engine_log_warning(PyObject *, PyObject *);
 PyObject *py_unreal_engine_log_error(PyObject *, PyObject *);
@@ -70,6 +93,7 @@ PyObject *py_unreal_engine_create_and_dispatch_when_ready(PyObject *, PyObject *
 PyObject *py_unreal_engine_convert_relative_path_to_full(PyObject *, PyObject *);
 
 PyObject *py_unreal_engine_get_viewport_screenshot(PyObject *, PyObject *);
+PyObject *py_unreal_engine_get_viewport_screenshot_buffer(PyObject *, PyObject *, PyObject *);
 PyObject *py_unreal_engine_get_viewport_size(PyObject *, PyObject *);
 
 PyObject *py_unreal_engine_create_world(PyObject *, PyObject *);
@@ -91,6 +115,8 @@ PyObject *py_unreal_engine_copy_properties_for_unrelated_objects(PyObject *, PyO
 #if WITH_EDITOR
 PyObject *py_unreal_engine_editor_get_active_viewport_screenshot(PyObject *, PyObject *);
 PyObject *py_unreal_engine_editor_get_pie_viewport_screenshot(PyObject *, PyObject *);
+PyObject *py_unreal_engine_editor_get_active_viewport_screenshot_buffer(PyObject *, PyObject *, PyObject *);
+PyObject *py_unreal_engine_editor_get_pie_viewport_screenshot_buffer(PyObject *, PyObject *, PyObject *);
 
 PyObject *py_unreal_engine_editor_get_active_viewport_size(PyObject *, PyObject *);
 PyObject *py_unreal_engine_editor_get_pie_viewport_size(PyObject *, PyObject *);
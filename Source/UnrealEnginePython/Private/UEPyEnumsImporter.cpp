@@ -1,28 +1,38 @@
 #include "UEPyEnumsImporter.h"
 
+#include "UEPyImporterCache.h"
+
 static PyObject *ue_PyEnumsImporter_getattro(ue_PyEnumsImporter *self, PyObject *attr_name)
 {
-	PyObject *py_attr = PyObject_GenericGetAttr((PyObject *)self, attr_name);
-	if (!py_attr)
+	return FPythonImporterCache::Get().GetAttr(EPythonImporter::Enums, (PyObject *)self, attr_name);
+}
+
+static PyObject *ue_PyEnumsImporter_prefetch(ue_PyEnumsImporter *self, PyObject * args)
+{
+	PyObject *py_names;
+	if (!PyArg_ParseTuple(args, "O:prefetch", &py_names))
 	{
-		if (PyUnicodeOrString_Check(attr_name))
-		{
-			const char *attr = UEPyUnicode_AsUTF8(attr_name);
-			if (attr[0] != '_')
-			{
-				UEnum *u_enum = FindObject<UEnum>(ANY_PACKAGE, UTF8_TO_TCHAR(attr));
-				if (u_enum)
-				{
-					// swallow old exception
-					PyErr_Clear();
-					Py_RETURN_UOBJECT(u_enum);
-				}
-			}
-		}
+		return nullptr;
 	}
-	return py_attr;
+
+	int32 found = FPythonImporterCache::Get().Prefetch(EPythonImporter::Enums, py_names);
+	if (found < 0)
+		return nullptr;
+
+	return PyLong_FromLong(found);
 }
 
+static PyObject *ue_PyEnumsImporter_dir(ue_PyEnumsImporter *self, PyObject * args)
+{
+	return FPythonImporterCache::Get().Dir(EPythonImporter::Enums, (PyObject *)self);
+}
+
+static PyMethodDef ue_PyEnumsImporter_methods[] = {
+	{ "prefetch", (PyCFunction)ue_PyEnumsImporter_prefetch, METH_VARARGS, "" },
+	{ "__dir__", (PyCFunction)ue_PyEnumsImporter_dir, METH_VARARGS, "" },
+	{ NULL }  /* Sentinel */
+};
+
 static PyTypeObject ue_PyEnumsImporterType = {
 	PyVarObject_HEAD_INIT(NULL, 0)
 	"unreal_engine.EnumsImporter", /* tp_name */
@@ -51,7 +61,7 @@ static PyTypeObject ue_PyEnumsImporterType = {
 	0,                         /* tp_weaklistoffset */
 	0,                         /* tp_iter */
 	0,                         /* tp_iternext */
-	0,             /* tp_methods */
+	ue_PyEnumsImporter_methods,             /* tp_methods */
 	0,
 	0,
 };
@@ -59,6 +69,7 @@ static PyTypeObject ue_PyEnumsImporterType = {
 void ue_python_init_enumsimporter(PyObject *ue_module)
 {
 	ue_PyEnumsImporterType.tp_new = PyType_GenericNew;
+	ue_PyEnumsImporterType.tp_dictoffset = offsetof(ue_PyEnumsImporter, py_dict);
 
 	if (PyType_Ready(&ue_PyEnumsImporterType) < 0)
 		return;
@@ -70,5 +81,7 @@ void ue_python_init_enumsimporter(PyObject *ue_module)
 PyObject *py_ue_new_enumsimporter()
 {
 	ue_PyEnumsImporter *ret = (ue_PyEnumsImporter *)PyObject_New(ue_PyEnumsImporter, &ue_PyEnumsImporterType);
+	ret->py_dict = PyDict_New();
+	FPythonImporterCache::Get().Register(EPythonImporter::Enums, ret->py_dict);
 	return (PyObject *)ret;
 }
@@ -0,0 +1,360 @@
+#include "UEPyImporterCache.h"
+
+static const char *ue_py_importer_names[(int32)EPythonImporter::Max] = { "classes", "structs", "enums" };
+
+FPythonImporterCache &FPythonImporterCache::Get()
+{
+	static FPythonImporterCache Singleton;
+	return Singleton;
+}
+
+FPythonImporterCache::FPythonImporterCache()
+{
+	for (int32 i = 0; i < (int32)EPythonImporter::Max; i++)
+	{
+		Dicts[i] = nullptr;
+	}
+	Invalidations = 0;
+
+#if ENGINE_MAJOR_VERSION == 5 || (ENGINE_MAJOR_VERSION == 4 && ENGINE_MINOR_VERSION >= 18)
+	FCoreUObjectDelegates::GetPostGarbageCollect().AddRaw(this, &FPythonImporterCache::OnPostGarbageCollect);
+#else
+	FCoreUObjectDelegates::PostGarbageCollect.AddRaw(this, &FPythonImporterCache::OnPostGarbageCollect);
+#endif
+#if ENGINE_MAJOR_VERSION == 5
+	FCoreUObjectDelegates::ReloadCompleteDelegate.AddRaw(this, &FPythonImporterCache::OnReloadComplete);
+#endif
+}
+
+void FPythonImporterCache::Register(EPythonImporter Importer, PyObject *py_dict)
+{
+	Py_XDECREF(Dicts[(int32)Importer]);
+	Py_INCREF(py_dict);
+	Dicts[(int32)Importer] = py_dict;
+}
+
+UObject *FPythonImporterCache::Find(EPythonImporter Importer, const char *Name)
+{
+	FImporterStats &ImporterStats = Stats[(int32)Importer];
+
+	const double StartTime = FPlatformTime::Seconds();
+
+	UObject *u_object = nullptr;
+	switch (Importer)
+	{
+	case EPythonImporter::Classes:
+		u_object = FindObject<UClass>(ANY_PACKAGE, UTF8_TO_TCHAR(Name));
+		break;
+	case EPythonImporter::Structs:
+		u_object = FindObject<UScriptStruct>(ANY_PACKAGE, UTF8_TO_TCHAR(Name));
+		break;
+	case EPythonImporter::Enums:
+		u_object = FindObject<UEnum>(ANY_PACKAGE, UTF8_TO_TCHAR(Name));
+		break;
+	default:
+		break;
+	}
+
+	ImporterStats.LookupTime += FPlatformTime::Seconds() - StartTime;
+	ImporterStats.Lookups++;
+	if (!u_object)
+	{
+		ImporterStats.NotFound++;
+	}
+
+	return u_object;
+}
+
+bool FPythonImporterCache::IsValid(PyObject *py_cached) const
+{
+	ue_PyUObject *py_object = ue_is_pyuobject(py_cached);
+	// attributes assigned from python are left alone
+	if (!py_object)
+		return true;
+
+	if (!FUnrealEnginePythonHouseKeeper::Get()->IsValidPyUObject(py_object))
+		return false;
+
+	// recompiled blueprints and user defined structs/enums, hot reloaded classes
+	if (py_object->ue_object->HasAnyFlags(RF_NewerVersionExists))
+		return false;
+
+	UClass *u_class = Cast<UClass>(py_object->ue_object);
+	if (u_class && u_class->HasAnyClassFlags(CLASS_NewerVersionExists))
+		return false;
+
+	return true;
+}
+
+PyObject *FPythonImporterCache::GetAttr(EPythonImporter Importer, PyObject *self, PyObject *attr_name)
+{
+	FImporterStats &ImporterStats = Stats[(int32)Importer];
+	PyObject *py_dict = Dicts[(int32)Importer];
+
+	if (py_dict)
+	{
+		PyObject *py_cached = PyDict_GetItem(py_dict, attr_name);
+		if (py_cached)
+		{
+			if (IsValid(py_cached))
+			{
+				ImporterStats.Hits++;
+				Py_INCREF(py_cached);
+				return py_cached;
+			}
+			ImporterStats.Stale++;
+			PyDict_DelItem(py_dict, attr_name);
+		}
+	}
+
+	PyObject *py_attr = PyObject_GenericGetAttr(self, attr_name);
+	if (py_attr || !PyUnicodeOrString_Check(attr_name))
+		return py_attr;
+
+	const char *attr = UEPyUnicode_AsUTF8(attr_name);
+	if (attr[0] == '_')
+		return nullptr;
+
+	UObject *u_object = Find(Importer, attr);
+	if (!u_object)
+		return nullptr;
+
+	// swallow old exception
+	PyErr_Clear();
+	ue_PyUObject *ret = ue_get_python_uobject_inc(u_object);
+	if (!ret)
+		return PyErr_Format(PyExc_Exception, "uobject is in invalid state");
+
+	if (py_dict)
+	{
+		PyDict_SetItem(py_dict, attr_name, (PyObject *)ret);
+	}
+	return (PyObject *)ret;
+}
+
+int32 FPythonImporterCache::Prefetch(EPythonImporter Importer, PyObject *py_names)
+{
+	PyObject *py_dict = Dicts[(int32)Importer];
+	if (!py_dict)
+	{
+		PyErr_Format(PyExc_Exception, "importer is not initialized");
+		return -1;
+	}
+
+	PyObject *py_iter = PyObject_GetIter(py_names);
+	if (!py_iter)
+		return -1;
+
+	int32 Found = 0;
+	while (PyObject *py_name = PyIter_Next(py_iter))
+	{
+		if (!PyUnicodeOrString_Check(py_name))
+		{
+			Py_DECREF(py_name);
+			Py_DECREF(py_iter);
+			PyErr_Format(PyExc_Exception, "argument is not an iterable of strings");
+			return -1;
+		}
+
+		PyObject *py_cached = PyDict_GetItem(py_dict, py_name);
+		if (py_cached && IsValid(py_cached))
+		{
+			Found++;
+			Py_DECREF(py_name);
+			continue;
+		}
+
+		UObject *u_object = Find(Importer, UEPyUnicode_AsUTF8(py_name));
+		if (u_object)
+		{
+			ue_PyUObject *py_object = ue_get_python_uobject(u_object);
+			if (py_object)
+			{
+				PyDict_SetItem(py_dict, py_name, (PyObject *)py_object);
+				Stats[(int32)Importer].Prefetched++;
+				Found++;
+			}
+		}
+		Py_DECREF(py_name);
+	}
+	Py_DECREF(py_iter);
+
+	if (PyErr_Occurred())
+		return -1;
+
+	return Found;
+}
+
+PyObject *FPythonImporterCache::Dir(EPythonImporter Importer, PyObject *self)
+{
+	// methods and cached attributes
+#if PY_MAJOR_VERSION >= 3
+	PyObject *py_base_dir = PyObject_CallMethod((PyObject *)&PyBaseObject_Type, (char *)"__dir__", (char *)"O", self);
+	if (!py_base_dir)
+		return nullptr;
+
+	PyObject *py_names = PySet_New(py_base_dir);
+	Py_DECREF(py_base_dir);
+	if (!py_names)
+		return nullptr;
+#else
+	// object.__dir__ does not exist in python 2, only the keys of the type and instance dicts are used
+	PyObject *py_names = PySet_New(Py_TYPE(self)->tp_dict);
+	if (!py_names)
+		return nullptr;
+
+	PyObject *py_instance_dict = PyObject_GetAttrString(self, (char *)"__dict__");
+	if (py_instance_dict)
+	{
+		PyObject *py_key = nullptr;
+		PyObject *py_value = nullptr;
+		Py_ssize_t pos = 0;
+		while (PyDict_Check(py_instance_dict) && PyDict_Next(py_instance_dict, &pos, &py_key, &py_value))
+		{
+			PySet_Add(py_names, py_key);
+		}
+		Py_DECREF(py_instance_dict);
+	}
+	else
+	{
+		PyErr_Clear();
+	}
+#endif
+
+	auto AddName = [py_names](UObject *u_object)
+	{
+		if (u_object->HasAnyFlags(RF_NewerVersionExists))
+			return;
+		FString Name = u_object->GetName();
+		// not reachable from getattr
+		if (Name.StartsWith(TEXT("_")))
+			return;
+		PyObject *py_name = PyUnicode_FromString(TCHAR_TO_UTF8(*Name));
+		PySet_Add(py_names, py_name);
+		Py_DECREF(py_name);
+	};
+
+	switch (Importer)
+	{
+	case EPythonImporter::Classes:
+		for (TObjectIterator<UClass> It; It; ++It)
+		{
+			if (!It->HasAnyClassFlags(CLASS_NewerVersionExists))
+				AddName(*It);
+		}
+		break;
+	case EPythonImporter::Structs:
+		for (TObjectIterator<UScriptStruct> It; It; ++It)
+		{
+			AddName(*It);
+		}
+		break;
+	case EPythonImporter::Enums:
+		for (TObjectIterator<UEnum> It; It; ++It)
+		{
+			AddName(*It);
+		}
+		break;
+	default:
+		break;
+	}
+
+	PyObject *ret = PySequence_List(py_names);
+	Py_DECREF(py_names);
+	if (ret)
+	{
+		PyList_Sort(ret);
+	}
+	return ret;
+}
+
+void FPythonImporterCache::Purge(bool bAll)
+{
+	for (int32 i = 0; i < (int32)EPythonImporter::Max; i++)
+	{
+		PyObject *py_dict = Dicts[i];
+		if (!py_dict)
+			continue;
+
+		PyObject *py_stale = PyList_New(0);
+		PyObject *py_key = nullptr;
+		PyObject *py_value = nullptr;
+		Py_ssize_t pos = 0;
+		while (PyDict_Next(py_dict, &pos, &py_key, &py_value))
+		{
+			if (bAll ? ue_is_pyuobject(py_value) != nullptr : !IsValid(py_value))
+			{
+				PyList_Append(py_stale, py_key);
+			}
+		}
+
+		for (Py_ssize_t j = 0; j < PyList_Size(py_stale); j++)
+		{
+			PyDict_DelItem(py_dict, PyList_GetItem(py_stale, j));
+		}
+		Stats[i].Stale += bAll ? 0 : PyList_Size(py_stale);
+		Py_DECREF(py_stale);
+	}
+}
+
+void FPythonImporterCache::Invalidate()
+{
+	Purge(true);
+	Invalidations++;
+}
+
+void FPythonImporterCache::OnPostGarbageCollect()
+{
+	if (!Py_IsInitialized())
+		return;
+
+	FScopePythonGIL gil;
+	Purge(false);
+}
+
+#if ENGINE_MAJOR_VERSION == 5
+void FPythonImporterCache::OnReloadComplete(EReloadCompleteReason Reason)
+{
+	if (!Py_IsInitialized())
+		return;
+
+	FScopePythonGIL gil;
+	Invalidate();
+}
+#endif
+
+static void ue_py_importer_cache_stat(PyObject *py_dict, const char *key, PyObject *py_value)
+{
+	PyDict_SetItemString(py_dict, key, py_value);
+	Py_DECREF(py_value);
+}
+
+PyObject *FPythonImporterCache::GetStats()
+{
+	PyObject *py_stats = PyDict_New();
+	for (int32 i = 0; i < (int32)EPythonImporter::Max; i++)
+	{
+		PyObject *py_dict = PyDict_New();
+		ue_py_importer_cache_stat(py_dict, "cached", PyLong_FromSsize_t(Dicts[i] ? PyDict_Size(Dicts[i]) : 0));
+		ue_py_importer_cache_stat(py_dict, "hits", PyLong_FromUnsignedLongLong(Stats[i].Hits));
+		ue_py_importer_cache_stat(py_dict, "lookups", PyLong_FromUnsignedLongLong(Stats[i].Lookups));
+		ue_py_importer_cache_stat(py_dict, "not_found", PyLong_FromUnsignedLongLong(Stats[i].NotFound));
+		ue_py_importer_cache_stat(py_dict, "stale", PyLong_FromUnsignedLongLong(Stats[i].Stale));
+		ue_py_importer_cache_stat(py_dict, "prefetched", PyLong_FromUnsignedLongLong(Stats[i].Prefetched));
+		ue_py_importer_cache_stat(py_dict, "lookup_time", PyFloat_FromDouble(Stats[i].LookupTime));
+		ue_py_importer_cache_stat(py_stats, ue_py_importer_names[i], py_dict);
+	}
+	ue_py_importer_cache_stat(py_stats, "invalidations", PyLong_FromUnsignedLongLong(Invalidations));
+	return py_stats;
+}
+
+PyObject *py_unreal_engine_importer_cache_stats(PyObject *self, PyObject * args)
+{
+	return FPythonImporterCache::Get().GetStats();
+}
+
+PyObject *py_unreal_engine_importer_cache_clear(PyObject *self, PyObject * args)
+{
+	FPythonImporterCache::Get().Invalidate();
+	Py_RETURN_NONE;
+}
@@ -0,0 +1,75 @@
+#pragma once
+
+
+
+#include "UEPyModule.h"
+
+enum class EPythonImporter : uint8
+{
+	Classes,
+	Structs,
+	Enums,
+	Max
+};
+
+/*
+
+Resolved objects of the unreal_engine.classes, unreal_engine.structs and unreal_engine.enums importers.
+
+Every object found by name is stored as a real attribute in the __dict__ of its importer, so the next access
+of the same name is a dictionary lookup instead of a FindObject() over all of the packages. Entries are validated
+on access (destroyed objects and objects replaced by a newer version, like recompiled blueprints, are looked up
+again), dropped after every garbage collection when their object is gone, and the whole cache is cleared after a
+hot reload. Missing names are never cached, so new classes are found as soon as they exist.
+
+All of the methods must be called with the GIL held.
+
+*/
+class FPythonImporterCache
+{
+public:
+	static FPythonImporterCache &Get();
+
+	void Register(EPythonImporter Importer, PyObject *py_dict);
+
+	// new reference to the attribute, nullptr with the python error set when not found
+	PyObject *GetAttr(EPythonImporter Importer, PyObject *self, PyObject *attr_name);
+
+	// resolves a list of names in a single pass, returns the number of objects found (-1 with the python error set)
+	int32 Prefetch(EPythonImporter Importer, PyObject *py_names);
+
+	// names of all of the loaded objects of the importer (plus its methods)
+	PyObject *Dir(EPythonImporter Importer, PyObject *self);
+
+	void Invalidate();
+	PyObject *GetStats();
+
+private:
+	FPythonImporterCache();
+
+	struct FImporterStats
+	{
+		uint64 Hits = 0;
+		uint64 Lookups = 0;
+		uint64 NotFound = 0;
+		uint64 Stale = 0;
+		uint64 Prefetched = 0;
+		double LookupTime = 0;
+	};
+
+	UObject *Find(EPythonImporter Importer, const char *Name);
+	bool IsValid(PyObject *py_cached) const;
+	// drops the entries of destroyed objects (or all of the objects when bAll is set)
+	void Purge(bool bAll);
+	void OnPostGarbageCollect();
+#if ENGINE_MAJOR_VERSION == 5
+	void OnReloadComplete(EReloadCompleteReason Reason);
+#endif
+
+	PyObject *Dicts[(int32)EPythonImporter::Max];
+	FImporterStats Stats[(int32)EPythonImporter::Max];
+	uint64 Invalidations;
+};
+
+PyObject *py_unreal_engine_importer_cache_stats(PyObject *, PyObject *);
+PyObject *py_unreal_engine_importer_cache_clear(PyObject *, PyObject *);
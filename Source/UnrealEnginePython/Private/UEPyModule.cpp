@@ -3,7 +3,15 @@
 #include "UEPyEngine.h"
 #include "UEPyTimer.h"
 #include "UEPyTicker.h"
+#include "UEPyStreamable.h"
 #include "UEPyVisualLogger.h"
+#include "UEPyViewportCapture.h"
+#include "UEPyCodeCache.h"
+#include "UEPyModuleRegistry.h"
+#include "UEPyStartupTrace.h"
+#include "UEPyShards.h"
+#include "UEPyTypedBindings.h"
+#include "UEPyImporterCache.h"
 
 #include "UObject/UEPyObject.h"
 #if ENGINE_MAJOR_VERSION == 5 || (ENGINE_MAJOR_VERSION == 4 && ENGINE_MINOR_VERSION >= 25)
@@ -50,6 +58,7 @@
 #if WITH_EDITOR
 #include "UEPyEditor.h"
 #include "Blueprint/UEPyEdGraph.h"
+#include "Blueprint/UEPyGraphBatch.h"
 #include "Fbx/UEPyFbx.h"
 #include "Editor/BlueprintGraph/Classes/EdGraphSchema_K2.h"
 #include "Editor/BlueprintGraph/Public/BlueprintActionDatabase.h"
@@ -62,6 +71,7 @@
 #include "Wrappers/UEPyFHitResult.h"
 #include "Wrappers/UEPyFRotator.h"
 #include "Wrappers/UEPyFTransform.h"
+#include "Wrappers/UEPyFMathArrays.h"
 #include "Wrappers/UEPyFColor.h"
 #include "Wrappers/UEPyFLinearColor.h"
 #include "Wrappers/UEPyFSocket.h"
@@ -238,6 +248,85 @@ static PyObject* py_unreal_engine_set_brutal_finalize(PyObject* self, PyObject*
 	Py_RETURN_NONE;
 }
 
+static void ue_python_init_http(PyObject* module)
+{
+	ue_python_init_ihttp_base(module);
+	ue_python_init_ihttp_request(module);
+	ue_python_init_ihttp_response(module);
+}
+
+struct FPythonSubmodule
+{
+	const char* Name;
+	void(*Init)(PyObject*);
+	bool bReady;
+};
+
+// indexed by EPythonSubmodule
+static FPythonSubmodule ue_python_submodules[] = {
+	{ "slate", ue_python_init_slate, false },
+#if WITH_EDITOR && (ENGINE_MAJOR_VERSION == 5 || (ENGINE_MAJOR_VERSION == 4 && ENGINE_MINOR_VERSION > 12))
+	{ "fbx", ue_python_init_fbx, false },
+#else
+	{ "fbx", nullptr, true },
+#endif
+	{ "http", ue_python_init_http, false },
+};
+
+static_assert(UE_ARRAY_COUNT(ue_python_submodules) == (int32)EPythonSubmodule::Max, "ue_python_submodules must match EPythonSubmodule");
+
+void ue_python_ensure_submodule(EPythonSubmodule Submodule)
+{
+	FPythonSubmodule& Entry = ue_python_submodules[(int32)Submodule];
+	if (Entry.bReady)
+		return;
+	Entry.bReady = true;
+
+	FPythonStartupTrace::FScope TraceScope(FString::Printf(TEXT("unreal_engine %s types"), UTF8_TO_TCHAR(Entry.Name)));
+	Entry.Init(PyImport_AddModule("unreal_engine"));
+}
+
+// module level __getattr__ (PEP 562), only called when the attribute is not in the module dict
+static PyObject* py_unreal_engine_module_getattr(PyObject* self, PyObject* args)
+{
+	char* name = nullptr;
+	if (!PyArg_ParseTuple(args, "s:__getattr__", &name))
+	{
+		return nullptr;
+	}
+
+	// dunder lookups (__path__, __file__, ...) are done by importlib and inspect, do not pay for them
+	if (!FCStringAnsi::Strncmp(name, "__", 2))
+	{
+		return PyErr_Format(PyExc_AttributeError, "module 'unreal_engine' has no attribute '%s'", name);
+	}
+
+	PyObject* unreal_engine_dict = PyModule_GetDict(PyImport_AddModule("unreal_engine"));
+	for (int32 i = 0; i < (int32)EPythonSubmodule::Max; i++)
+	{
+		if (ue_python_submodules[i].bReady)
+			continue;
+		ue_python_ensure_submodule((EPythonSubmodule)i);
+		PyObject* py_value = PyDict_GetItemString(unreal_engine_dict, name);
+		if (py_value)
+		{
+			Py_INCREF(py_value);
+			return py_value;
+		}
+	}
+
+	return PyErr_Format(PyExc_AttributeError, "module 'unreal_engine' has no attribute '%s'", name);
+}
+
+static PyObject* py_unreal_engine_module_dir(PyObject* self, PyObject* args)
+{
+	for (int32 i = 0; i < (int32)EPythonSubmodule::Max; i++)
+	{
+		ue_python_ensure_submodule((EPythonSubmodule)i);
+	}
+	return PyDict_Keys(PyModule_GetDict(PyImport_AddModule("unreal_engine")));
+}
+
 static PyMethodDef unreal_engine_methods[] = {
 	{ "log", py_unreal_engine_log, METH_VARARGS, "" },
 	{ "log_warning", py_unreal_engine_log_warning, METH_VARARGS, "" },
@@ -264,6 +353,11 @@ static PyMethodDef unreal_engine_methods[] = {
 	{ "load_object", py_unreal_engine_load_object, METH_VARARGS, "" },
 
 	{ "load_package", py_unreal_engine_load_package, METH_VARARGS, "" },
+	{ "load_package_async", py_unreal_engine_load_package_async, METH_VARARGS, "" },
+#ifdef _MSC_VER
+#pragma warning(disable: 4191)
+#endif
+	{ "request_async_load", (PyCFunction)py_unreal_engine_request_async_load, METH_VARARGS | METH_KEYWORDS, "" },
 #if WITH_EDITOR
 	{ "unload_package", py_unreal_engine_unload_package, METH_VARARGS, "" },
 	{ "get_package_filename", py_unreal_engine_get_package_filename, METH_VARARGS, "" },
@@ -347,6 +441,13 @@ static PyMethodDef unreal_engine_methods[] = {
 	{ "editor_select_actor", py_unreal_engine_editor_select_actor, METH_VARARGS, "" },
 	{ "editor_deselect_actors", py_unreal_engine_editor_deselect_actors, METH_VARARGS, "" },
 	{ "import_asset", py_unreal_engine_import_asset, METH_VARARGS, "" },
+#ifdef _MSC_VER
+#pragma warning(disable: 4191)
+#endif
+	{ "import_assets_batch", (PyCFunction)py_unreal_engine_import_assets_batch, METH_VARARGS | METH_KEYWORDS, "" },
+#if ENGINE_MAJOR_VERSION == 5
+	{ "sample_anim_sequences", (PyCFunction)py_unreal_engine_sample_anim_sequences, METH_VARARGS | METH_KEYWORDS, "" },
+#endif
 	{ "export_assets", py_unreal_engine_export_assets, METH_VARARGS, "" },
 	{ "get_asset", py_unreal_engine_get_asset, METH_VARARGS, "" },
 	{ "find_asset", py_unreal_engine_find_asset, METH_VARARGS, "" },
@@ -388,6 +489,8 @@ static PyMethodDef unreal_engine_methods[] = {
 	{ "guid_to_string", py_unreal_engine_guid_to_string, METH_VARARGS, "" },
 
 	{ "heightmap_expand", py_unreal_engine_heightmap_expand, METH_VARARGS, "" },
+	{ "heightmap_resample", py_unreal_engine_heightmap_resample, METH_VARARGS, "" },
+	{ "heightmap_blur", py_unreal_engine_heightmap_blur, METH_VARARGS, "" },
 	{ "heightmap_import", py_unreal_engine_heightmap_import, METH_VARARGS, "" },
 
 	{ "play_preview_sound", py_unreal_engine_play_preview_sound, METH_VARARGS, "" },
@@ -395,12 +498,19 @@ static PyMethodDef unreal_engine_methods[] = {
 #pragma warning(disable: 4191)
 #endif
 	{ "get_assets_by_filter", (PyCFunction)py_unreal_engine_get_assets_by_filter, METH_VARARGS | METH_KEYWORDS, "" },
+#ifdef _MSC_VER
+#pragma warning(disable: 4191)
+#endif
+	{ "get_assets_columns", (PyCFunction)py_unreal_engine_get_assets_columns, METH_VARARGS | METH_KEYWORDS, "" },
 	{ "create_blueprint", py_unreal_engine_create_blueprint, METH_VARARGS, "" },
 	{ "create_blueprint_from_actor", py_unreal_engine_create_blueprint_from_actor, METH_VARARGS, "" },
 	{ "replace_blueprint", py_unreal_engine_replace_blueprint, METH_VARARGS, "" },
 	{ "get_blueprint_hierarchy_from_class", py_unreal_engine_get_blueprint_hierarchy_from_class, METH_VARARGS, "" },
 	{ "reload_blueprint", py_unreal_engine_reload_blueprint, METH_VARARGS, "" },
 	{ "compile_blueprint", py_unreal_engine_compile_blueprint, METH_VARARGS, "" },
+	{ "compile_blueprints", py_unreal_engine_compile_blueprints, METH_VARARGS, "" },
+	{ "begin_graph_batch", py_unreal_engine_begin_graph_batch, METH_VARARGS, "" },
+	{ "end_graph_batch", (PyCFunction)py_unreal_engine_end_graph_batch, METH_VARARGS | METH_KEYWORDS, "" },
 	{ "blueprint_add_member_variable", py_unreal_engine_blueprint_add_member_variable, METH_VARARGS, "" },
 	{ "blueprint_add_event_dispatcher", py_unreal_engine_blueprint_add_event_dispatcher, METH_VARARGS, "" },
 	{ "blueprint_add_new_timeline", py_unreal_engine_blueprint_add_new_timeline, METH_VARARGS, "" },
@@ -463,6 +573,9 @@ static PyMethodDef unreal_engine_methods[] = {
 	{ "all_worlds", (PyCFunction)py_unreal_engine_all_worlds, METH_VARARGS, "" },
 	{ "tobject_iterator", (PyCFunction)py_unreal_engine_tobject_iterator, METH_VARARGS, "" },
 
+	{ "set_transforms", (PyCFunction)py_unreal_engine_set_transforms, METH_VARARGS | METH_KEYWORDS, "" },
+	{ "get_transforms", (PyCFunction)py_unreal_engine_get_transforms, METH_VARARGS | METH_KEYWORDS, "" },
+
 	{ "new_class", py_unreal_engine_new_class, METH_VARARGS, "" },
 
 
@@ -484,11 +597,35 @@ static PyMethodDef unreal_engine_methods[] = {
 	{ "exec_in_main_thread", py_unreal_engine_exec_in_main_thread, METH_VARARGS, "" },
 	{ "py_exec_in_main_thread", py_unreal_engine_exec_in_main_thread, METH_VARARGS, "" },
 #endif
+	{ "code_cache_stats", py_unreal_engine_code_cache_stats, METH_VARARGS, "" },
+	{ "code_cache_clear", py_unreal_engine_code_cache_clear, METH_VARARGS, "" },
+	{ "importer_cache_stats", py_unreal_engine_importer_cache_stats, METH_VARARGS, "" },
+	{ "importer_cache_clear", py_unreal_engine_importer_cache_clear, METH_VARARGS, "" },
+	{ "module_registry_stats", py_unreal_engine_module_registry_stats, METH_VARARGS, "" },
+	{ "startup_trace", py_unreal_engine_startup_trace, METH_VARARGS, "" },
+	{ "get_shard_items", py_unreal_engine_get_shard_items, METH_VARARGS, "" },
+	{ "shard_result", py_unreal_engine_shard_result, METH_VARARGS, "" },
+#if ENGINE_MAJOR_VERSION == 5 || (ENGINE_MAJOR_VERSION == 4 && ENGINE_MINOR_VERSION >= 25)
+	{ "generate_typed_bindings", py_unreal_engine_generate_typed_bindings, METH_VARARGS, "" },
+	{ "generate_typed_stubs", py_unreal_engine_generate_typed_stubs, METH_VARARGS, "" },
+	{ "typed_bindings_stats", py_unreal_engine_typed_bindings_stats, METH_VARARGS, "" },
+	{ "typed_class", py_unreal_engine_typed_class, METH_VARARGS, "" },
+#endif
+	{ "__getattr__", py_unreal_engine_module_getattr, METH_VARARGS, "" },
+	{ "__dir__", py_unreal_engine_module_dir, METH_VARARGS, "" },
 
 	{ "get_engine_defined_action_mappings", py_unreal_engine_get_engine_defined_action_mappings, METH_VARARGS, "" },
 
 	{ "get_viewport_screenshot", py_unreal_engine_get_viewport_screenshot, METH_VARARGS, "" },
 	{ "get_viewport_size", py_unreal_engine_get_viewport_size, METH_VARARGS, "" },
+#ifdef _MSC_VER
+#pragma warning(disable: 4191)
+#endif
+	{ "get_viewport_screenshot_buffer", (PyCFunction)py_unreal_engine_get_viewport_screenshot_buffer, METH_VARARGS | METH_KEYWORDS, "" },
+	{ "viewport_capture_start", (PyCFunction)py_unreal_engine_viewport_capture_start, METH_VARARGS | METH_KEYWORDS, "" },
+	{ "viewport_capture_pop", py_unreal_engine_viewport_capture_pop, METH_VARARGS, "" },
+	{ "viewport_capture_stats", py_unreal_engine_viewport_capture_stats, METH_VARARGS, "" },
+	{ "viewport_capture_stop", py_unreal_engine_viewport_capture_stop, METH_VARARGS, "" },
 	{ "get_resolution", py_unreal_engine_get_resolution, METH_VARARGS, "" },
 	{ "get_game_viewport_size", py_unreal_engine_get_game_viewport_size, METH_VARARGS, "" },
 
@@ -505,6 +642,8 @@ static PyMethodDef unreal_engine_methods[] = {
 	{ "get_editor_pie_game_viewport_client", py_unreal_engine_get_editor_pie_game_viewport_client, METH_VARARGS, "" },
 	{ "editor_get_active_viewport_screenshot", py_unreal_engine_editor_get_active_viewport_screenshot, METH_VARARGS, "" },
 	{ "editor_get_pie_viewport_screenshot", py_unreal_engine_editor_get_pie_viewport_screenshot, METH_VARARGS, "" },
+	{ "editor_get_active_viewport_screenshot_buffer", (PyCFunction)py_unreal_engine_editor_get_active_viewport_screenshot_buffer, METH_VARARGS | METH_KEYWORDS, "" },
+	{ "editor_get_pie_viewport_screenshot_buffer", (PyCFunction)py_unreal_engine_editor_get_pie_viewport_screenshot_buffer, METH_VARARGS | METH_KEYWORDS, "" },
 
 	{ "editor_set_view_mode", py_unreal_engine_editor_set_view_mode, METH_VARARGS, "" },
 	{ "editor_set_camera_speed", py_unreal_engine_editor_set_camera_speed, METH_VARARGS, "" },
@@ -788,6 +927,11 @@ static PyMethodDef ue_PyUObject_methods[] = {
 	{ "update_raw_track", (PyCFunction)py_ue_anim_sequence_update_raw_track, METH_VARARGS, "" },
 	{ "apply_raw_anim_changes", (PyCFunction)py_ue_anim_sequence_apply_raw_anim_changes, METH_VARARGS, "" },
 	{ "add_key_to_sequence", (PyCFunction)py_ue_anim_add_key_to_sequence, METH_VARARGS, "" },
+#endif
+#if ENGINE_MAJOR_VERSION == 5
+	{ "get_raw_animation_buffer", (PyCFunction)py_ue_anim_sequence_get_raw_animation_buffer, METH_VARARGS, "" },
+	{ "set_raw_animation_buffer", (PyCFunction)py_ue_anim_sequence_set_raw_animation_buffer, METH_VARARGS | METH_KEYWORDS, "" },
+	{ "sample_bone_transforms", (PyCFunction)py_ue_anim_sequence_sample_bone_transforms, METH_VARARGS | METH_KEYWORDS, "" },
 #endif
 	{ "add_anim_composite_section", (PyCFunction)py_ue_add_anim_composite_section, METH_VARARGS, "" },
 #endif
@@ -919,6 +1063,9 @@ static PyMethodDef ue_PyUObject_methods[] = {
 	{ "line_trace_multi_by_channel", (PyCFunction)py_ue_line_trace_multi_by_channel, METH_VARARGS, "" },
 	{ "get_hit_result_under_cursor", (PyCFunction)py_ue_get_hit_result_under_cursor, METH_VARARGS, "" },
 	{ "draw_debug_line", (PyCFunction)py_ue_draw_debug_line, METH_VARARGS, "" },
+	{ "line_trace_batch_by_channel", (PyCFunction)py_ue_line_trace_batch_by_channel, METH_VARARGS | METH_KEYWORDS, "" },
+	{ "sweep_batch_by_channel", (PyCFunction)py_ue_sweep_batch_by_channel, METH_VARARGS | METH_KEYWORDS, "" },
+	{ "overlap_batch_by_channel", (PyCFunction)py_ue_overlap_batch_by_channel, METH_VARARGS | METH_KEYWORDS, "" },
 
 	{ "destructible_apply_damage", (PyCFunction)py_ue_destructible_apply_damage, METH_VARARGS, "" },
 
@@ -998,6 +1145,10 @@ static PyMethodDef ue_PyUObject_methods[] = {
 	{ "get_available_audio_byte_count", (PyCFunction)py_ue_get_available_audio_byte_count, METH_VARARGS, "" },
 	{ "sound_get_data", (PyCFunction)py_ue_sound_get_data, METH_VARARGS, "" },
 	{ "sound_set_data", (PyCFunction)py_ue_sound_set_data, METH_VARARGS, "" },
+	{ "procedural_audio_start", (PyCFunction)py_ue_procedural_audio_start, METH_VARARGS | METH_KEYWORDS, "" },
+	{ "procedural_audio_write", (PyCFunction)py_ue_procedural_audio_write, METH_VARARGS, "" },
+	{ "procedural_audio_stats", (PyCFunction)py_ue_procedural_audio_stats, METH_VARARGS, "" },
+	{ "procedural_audio_stop", (PyCFunction)py_ue_procedural_audio_stop, METH_VARARGS, "" },
 
 	{ "world_tick", (PyCFunction)py_ue_world_tick, METH_VARARGS, "" },
 
@@ -1009,6 +1160,11 @@ static PyMethodDef ue_PyUObject_methods[] = {
 	{ "get_landscape_info", (PyCFunction)py_ue_get_landscape_info, METH_VARARGS, "" },
 	{ "landscape_import", (PyCFunction)py_ue_landscape_import, METH_VARARGS, "" },
 	{ "landscape_export_to_raw_mesh", (PyCFunction)py_ue_landscape_export_to_raw_mesh, METH_VARARGS, "" },
+	{ "landscape_get_extent", (PyCFunction)py_ue_landscape_get_extent, METH_VARARGS, "" },
+	{ "landscape_get_heights", (PyCFunction)py_ue_landscape_get_heights, METH_VARARGS | METH_KEYWORDS, "" },
+	{ "landscape_set_heights", (PyCFunction)py_ue_landscape_set_heights, METH_VARARGS | METH_KEYWORDS, "" },
+	{ "landscape_get_weights", (PyCFunction)py_ue_landscape_get_weights, METH_VARARGS | METH_KEYWORDS, "" },
+	{ "landscape_set_weights", (PyCFunction)py_ue_landscape_set_weights, METH_VARARGS | METH_KEYWORDS, "" },
 #endif
 
 	// Player
@@ -1077,6 +1233,8 @@ static PyMethodDef ue_PyUObject_methods[] = {
 #if ENGINE_MAJOR_VERSION == 5 || (ENGINE_MAJOR_VERSION == 4 && ENGINE_MINOR_VERSION > 12)
 	{ "skeletal_mesh_set_soft_vertices", (PyCFunction)py_ue_skeletal_mesh_set_soft_vertices, METH_VARARGS, "" },
 	{ "skeletal_mesh_get_soft_vertices", (PyCFunction)py_ue_skeletal_mesh_get_soft_vertices, METH_VARARGS, "" },
+	{ "skeletal_mesh_set_soft_vertices_buffers", (PyCFunction)py_ue_skeletal_mesh_set_soft_vertices_buffers, METH_VARARGS, "" },
+	{ "skeletal_mesh_get_soft_vertices_buffers", (PyCFunction)py_ue_skeletal_mesh_get_soft_vertices_buffers, METH_VARARGS, "" },
 #endif
 	{ "skeletal_mesh_get_lod", (PyCFunction)py_ue_skeletal_mesh_get_lod, METH_VARARGS, "" },
 
@@ -1102,12 +1260,15 @@ static PyMethodDef ue_PyUObject_methods[] = {
 #endif
 #if WITH_EDITOR
 	{ "skeletal_mesh_register_morph_target", (PyCFunction)py_ue_skeletal_mesh_register_morph_target, METH_VARARGS, "" },
+	{ "skeletal_mesh_add_morph_targets", (PyCFunction)py_ue_skeletal_mesh_add_morph_targets, METH_VARARGS | METH_KEYWORDS, "" },
 
 
 	{ "skeletal_mesh_to_import_vertex_map", (PyCFunction)py_ue_skeletal_mesh_to_import_vertex_map, METH_VARARGS, "" },
 
 	{ "morph_target_populate_deltas", (PyCFunction)py_ue_morph_target_populate_deltas, METH_VARARGS, "" },
 	{ "morph_target_get_deltas", (PyCFunction)py_ue_morph_target_get_deltas, METH_VARARGS, "" },
+	{ "morph_target_populate_deltas_buffer", (PyCFunction)py_ue_morph_target_populate_deltas_buffer, METH_VARARGS | METH_KEYWORDS, "" },
+	{ "morph_target_get_deltas_buffer", (PyCFunction)py_ue_morph_target_get_deltas_buffer, METH_VARARGS, "" },
 #endif
 	// Timer
 	{ "set_timer", (PyCFunction)py_ue_set_timer, METH_VARARGS, "" },
@@ -1152,6 +1313,10 @@ static PyMethodDef ue_PyUObject_methods[] = {
 	{ "sequencer_track_add_section", (PyCFunction)py_ue_sequencer_track_add_section, METH_VARARGS, "" },
 
 	{ "sequencer_section_add_key", (PyCFunction)py_ue_sequencer_section_add_key, METH_VARARGS, "" },
+#if ENGINE_MAJOR_VERSION == 5 || (ENGINE_MAJOR_VERSION == 4 && ENGINE_MINOR_VERSION >= 20)
+	{ "sequencer_section_add_keys", (PyCFunction)py_ue_sequencer_section_add_keys, METH_VARARGS | METH_KEYWORDS, "" },
+	{ "sequencer_section_get_keys", (PyCFunction)py_ue_sequencer_section_get_keys, METH_VARARGS, "" },
+#endif
 	{ "sequencer_remove_possessable", (PyCFunction)py_ue_sequencer_remove_possessable, METH_VARARGS, "" },
 	{ "sequencer_remove_spawnable", (PyCFunction)py_ue_sequencer_remove_spawnable, METH_VARARGS, "" },
 	{ "sequencer_remove_camera_cut_track", (PyCFunction)py_ue_sequencer_remove_camera_cut_track, METH_VARARGS, "" },
@@ -1370,10 +1535,60 @@ static PyObject* ue_PyUObject_getattro(ue_PyUObject* self, PyObject* attr_name)
 	return ret;
 }
 
+#if ENGINE_MAJOR_VERSION == 5 || (ENGINE_MAJOR_VERSION == 4 && ENGINE_MINOR_VERSION >= 25)
+// assign a python value to a property of a UObject, notifying the editor (and the archetype instances) of the change
+int ue_py_set_uobject_property(UObject* u_object, FProperty* f_property, PyObject* value)
+{
+#if WITH_EDITOR
+	u_object->PreEditChange(f_property);
+#endif
+	if (ue_py_convert_pyobject(value, f_property, (uint8*)u_object, 0))
+	{
+#if WITH_EDITOR
+		FPropertyChangedEvent PropertyEvent(f_property, EPropertyChangeType::ValueSet);
+		u_object->PostEditChangeProperty(PropertyEvent);
+
+		if (u_object->HasAnyFlags(RF_ArchetypeObject | RF_ClassDefaultObject))
+		{
+			TArray<UObject*> Instances;
+			u_object->GetArchetypeInstances(Instances);
+			for (UObject* Instance : Instances)
+			{
+				Instance->PreEditChange(f_property);
+				if (ue_py_convert_pyobject(value, f_property, (uint8*)Instance, 0))
+				{
+					FPropertyChangedEvent InstancePropertyEvent(f_property, EPropertyChangeType::ValueSet);
+					Instance->PostEditChangeProperty(InstancePropertyEvent);
+				}
+				else
+				{
+					PyErr_SetString(PyExc_ValueError, "invalid value for FProperty");
+					return -1;
+				}
+			}
+		}
+#endif
+		return 0;
+	}
+	PyErr_SetString(PyExc_ValueError, "invalid value for FProperty");
+	return -1;
+}
+#endif
+
 static int ue_PyUObject_setattro(ue_PyUObject* self, PyObject* attr_name, PyObject* value)
 {
 	ue_py_check_int(self);
 
+	// typed bindings: the descriptor is already bound to the property
+	if (Py_TYPE(self) != &ue_PyUObjectType)
+	{
+		PyObject* descr = _PyType_Lookup(Py_TYPE(self), attr_name);
+		if (descr && Py_TYPE(descr)->tp_descr_set)
+		{
+			return Py_TYPE(descr)->tp_descr_set(descr, (PyObject*)self, value);
+		}
+	}
+
 	// first of all check for Property (UProperty or FProperty)
 	if (PyUnicodeOrString_Check(attr_name))
 	{
@@ -1409,39 +1624,7 @@ static int ue_PyUObject_setattro(ue_PyUObject* self, PyObject* attr_name, PyObje
 				}
 			}
 #endif
-#if WITH_EDITOR
-			self->ue_object->PreEditChange(f_property);
-#endif
-			if (ue_py_convert_pyobject(value, f_property, (uint8*)self->ue_object, 0))
-			{
-#if WITH_EDITOR
-				FPropertyChangedEvent PropertyEvent(f_property, EPropertyChangeType::ValueSet);
-				self->ue_object->PostEditChangeProperty(PropertyEvent);
-
-				if (self->ue_object->HasAnyFlags(RF_ArchetypeObject | RF_ClassDefaultObject))
-				{
-					TArray<UObject*> Instances;
-					self->ue_object->GetArchetypeInstances(Instances);
-					for (UObject* Instance : Instances)
-					{
-						Instance->PreEditChange(f_property);
-						if (ue_py_convert_pyobject(value, f_property, (uint8*)Instance, 0))
-						{
-							FPropertyChangedEvent InstancePropertyEvent(f_property, EPropertyChangeType::ValueSet);
-							Instance->PostEditChangeProperty(InstancePropertyEvent);
-						}
-						else
-						{
-							PyErr_SetString(PyExc_ValueError, "invalid value for FProperty");
-							return -1;
-						}
-					}
-				}
-#endif
-				return 0;
-			}
-			PyErr_SetString(PyExc_ValueError, "invalid value for FProperty");
-			return -1;
+			return ue_py_set_uobject_property(self->ue_object, f_property, value);
 		}
 #else
 		UProperty* u_property = u_struct->FindPropertyByName(FName(UTF8_TO_TCHAR(attr)));
@@ -1575,11 +1758,8 @@ static PyObject* ue_PyUObject_call(ue_PyUObject* self, PyObject* args, PyObject*
 	{
 		UScriptStruct* u_script_struct = (UScriptStruct*)self->ue_object;
 		EXTRA_UE_LOG(LogPython, Warning, TEXT("Creating new UScriptStruct %s"), *u_script_struct->GetName());
-		uint8* data = (uint8*)FMemory::Malloc(u_script_struct->GetStructureSize());
-		u_script_struct->InitializeStruct(data);
-#if WITH_EDITOR
-		u_script_struct->InitializeDefaultValue(data);
-#endif
+		PyObject* py_struct = py_ue_new_owned_uscriptstruct_default(u_script_struct);
+		uint8* data = ((ue_PyUScriptStruct*)py_struct)->u_struct_ptr;
 		if (kw)
 		{
 			PyObject* struct_keys = PyObject_GetIter(kw);
@@ -1590,7 +1770,7 @@ static PyObject* ue_PyUObject_call(ue_PyUObject* self, PyObject* args, PyObject*
 				{
 					if (PyErr_Occurred())
 					{
-						FMemory::Free(data);
+						Py_DECREF(py_struct);
 						return PyErr_Format(PyExc_Exception, "unable to build struct from dictionary");
 					}
 					break;
@@ -1604,7 +1784,7 @@ static PyObject* ue_PyUObject_call(ue_PyUObject* self, PyObject* args, PyObject*
 				{
 					if (PyErr_Occurred())
 					{
-						FMemory::Free(data);
+						Py_DECREF(py_struct);
 						return PyErr_Format(PyExc_Exception, "unable to build struct from dictionary");
 					}
 					break;
@@ -1616,13 +1796,13 @@ static PyObject* ue_PyUObject_call(ue_PyUObject* self, PyObject* args, PyObject*
 				{
 					if (!ue_py_convert_pyobject(value, f_property, data, 0))
 					{
-						FMemory::Free(data);
+						Py_DECREF(py_struct);
 						return PyErr_Format(PyExc_Exception, "invalid value for FProperty");
 					}
 				}
 				else
 				{
-					FMemory::Free(data);
+					Py_DECREF(py_struct);
 					return PyErr_Format(PyExc_Exception, "FProperty %s not found", struct_key);
 				}
 #else
@@ -1631,19 +1811,19 @@ static PyObject* ue_PyUObject_call(ue_PyUObject* self, PyObject* args, PyObject*
 				{
 					if (!ue_py_convert_pyobject(value, u_property, data, 0))
 					{
-						FMemory::Free(data);
+						Py_DECREF(py_struct);
 						return PyErr_Format(PyExc_Exception, "invalid value for UProperty");
 					}
 				}
 				else
 				{
-					FMemory::Free(data);
+					Py_DECREF(py_struct);
 					return PyErr_Format(PyExc_Exception, "UProperty %s not found", struct_key);
 				}
 #endif
 			}
 		}
-		return py_ue_new_owned_uscriptstruct_zero_copy(u_script_struct, data);
+		return py_struct;
 	}
 
 	return PyErr_Format(PyExc_Exception, "the specified uobject has no __call__ support");
@@ -1669,7 +1849,7 @@ static PyTypeObject ue_PyUObjectType = {
 	(getattrofunc)ue_PyUObject_getattro, /* tp_getattro */
 	(setattrofunc)ue_PyUObject_setattro, /* tp_setattro */
 	0,                         /* tp_as_buffer */
-	Py_TPFLAGS_DEFAULT,        /* tp_flags */
+	Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE,        /* tp_flags */
 	"Unreal Engine UObject wrapper",           /* tp_doc */
 	0,                         /* tp_traverse */
 	0,                         /* tp_clear */
@@ -2030,8 +2210,15 @@ int unreal_engine_py_fproperty_init(ue_PyUObject*, PyObject*, PyObject*);
 int unreal_engine_py_ffieldclass_init(ue_PyUObject*, PyObject*, PyObject*);
 #endif
 
-void unreal_engine_init_py_module()
+void unreal_engine_init_py_module(bool bLazySubmodules)
 {
+#if PY_MAJOR_VERSION < 3 || PY_MINOR_VERSION < 7
+	// module level __getattr__ is not available
+	bLazySubmodules = false;
+#endif
+
+	FPythonStartupTrace::FScope TraceScope(TEXT("unreal_engine module"));
+
 #if PY_MAJOR_VERSION >= 3
 	PyObject * new_unreal_engine_module = PyImport_AddModule("unreal_engine");
 #else
@@ -2076,6 +2263,7 @@ void unreal_engine_init_py_module()
 
 	PyObject* unreal_engine_dict = PyModule_GetDict(new_unreal_engine_module);
 
+	FPythonStartupTrace::Get().BeginPhase(TEXT("unreal_engine functions"));
 	PyMethodDef* unreal_engine_function;
 	for (unreal_engine_function = unreal_engine_methods; unreal_engine_function->ml_name != NULL; unreal_engine_function++)
 	{
@@ -2083,11 +2271,15 @@ void unreal_engine_init_py_module()
 		PyDict_SetItemString(unreal_engine_dict, unreal_engine_function->ml_name, func);
 		Py_DECREF(func);
 	}
+	FPythonStartupTrace::Get().EndPhase();
+
+	FPythonStartupTrace::Get().BeginPhase(TEXT("unreal_engine types"));
 
 	ue_python_init_fvector(new_unreal_engine_module);
 	ue_python_init_fvector2d(new_unreal_engine_module);
 	ue_python_init_frotator(new_unreal_engine_module);
 	ue_python_init_ftransform(new_unreal_engine_module);
+	ue_python_init_fmath_arrays(new_unreal_engine_module);
 	ue_python_init_fhitresult(new_unreal_engine_module);
 	ue_python_init_fcolor(new_unreal_engine_module);
 	ue_python_init_flinearcolor(new_unreal_engine_module);
@@ -2119,6 +2311,8 @@ void unreal_engine_init_py_module()
 
 	ue_python_init_ftimerhandle(new_unreal_engine_module);
 
+	ue_python_init_fstreamable_handle(new_unreal_engine_module);
+
 	ue_python_init_fdelegatehandle(new_unreal_engine_module);
 
 	ue_python_init_fsocket(new_unreal_engine_module);
@@ -2130,6 +2324,9 @@ void unreal_engine_init_py_module()
 	ue_python_init_uclassesimporter(new_unreal_engine_module);
 	ue_python_init_enumsimporter(new_unreal_engine_module);
 	ue_python_init_ustructsimporter(new_unreal_engine_module);
+#if ENGINE_MAJOR_VERSION == 5 || (ENGINE_MAJOR_VERSION == 4 && ENGINE_MINOR_VERSION >= 25)
+	ue_python_init_typed_bindings(new_unreal_engine_module);
+#endif
 
 #if WITH_EDITOR
 	ue_python_init_ffoliage_instance(new_unreal_engine_module);
@@ -2140,21 +2337,20 @@ void unreal_engine_init_py_module()
 	ue_python_init_fassetdata(new_unreal_engine_module);
 	ue_python_init_edgraphpin(new_unreal_engine_module);
 	ue_python_init_fstring_asset_reference(new_unreal_engine_module);
-#if ENGINE_MAJOR_VERSION == 5 || (ENGINE_MAJOR_VERSION == 4 && ENGINE_MINOR_VERSION > 12)
-	ue_python_init_fbx(new_unreal_engine_module);
-#endif
 #if ENGINE_MAJOR_VERSION == 5 || (ENGINE_MAJOR_VERSION == 4 && ENGINE_MINOR_VERSION > 13)
 	ue_python_init_fraw_mesh(new_unreal_engine_module);
 #endif
 	ue_python_init_iplugin(new_unreal_engine_module);
 #endif
 
-	ue_python_init_slate(new_unreal_engine_module);
-
-
-	ue_python_init_ihttp_base(new_unreal_engine_module);
-	ue_python_init_ihttp_request(new_unreal_engine_module);
-	ue_python_init_ihttp_response(new_unreal_engine_module);
+	// slate, fbx and http types are registered by py_unreal_engine_module_getattr on first access
+	if (!bLazySubmodules)
+	{
+		for (int32 i = 0; i < (int32)EPythonSubmodule::Max; i++)
+		{
+			ue_python_ensure_submodule((EPythonSubmodule)i);
+		}
+	}
 
 	ue_python_init_iconsole_manager(new_unreal_engine_module);
 
@@ -2166,6 +2362,7 @@ void unreal_engine_init_py_module()
 #endif
 
 	ue_python_init_ivoice_capture(new_unreal_engine_module);
+	ue_python_init_fshared_buffer(new_unreal_engine_module);
 
 	ue_py_register_magic_module((char*)"unreal_engine.classes", py_ue_new_uclassesimporter);
 	ue_py_register_magic_module((char*)"unreal_engine.enums", py_ue_new_enumsimporter);
@@ -2174,6 +2371,10 @@ void unreal_engine_init_py_module()
 	ue_py_register_magic_module((char*)"unreal_engine.properties", py_ue_new_fpropertiesimporter);
 #endif
 
+	FPythonStartupTrace::Get().EndPhase();
+
+	FPythonStartupTrace::Get().BeginPhase(TEXT("unreal_engine constants"));
+
 
 	PyDict_SetItemString(unreal_engine_dict, "ENGINE_MAJOR_VERSION", PyLong_FromLong(ENGINE_MAJOR_VERSION));
 	PyDict_SetItemString(unreal_engine_dict, "ENGINE_MINOR_VERSION", PyLong_FromLong(ENGINE_MINOR_VERSION));
@@ -2272,6 +2473,8 @@ void unreal_engine_init_py_module()
 	PyDict_SetItemString(unreal_engine_dict, "APP_RETURN_TYPE_CANCEL", PyLong_FromLong(EAppReturnType::Cancel));
 
 #endif
+
+	FPythonStartupTrace::Get().EndPhase();
 }
 
 
@@ -2293,11 +2496,25 @@ ue_PyUObject* ue_get_python_uobject(UObject* ue_obj)
 #endif
 			return nullptr;
 
-		ue_PyUObject* ue_py_object = (ue_PyUObject*)PyObject_New(ue_PyUObject, &ue_PyUObjectType);
+		PyTypeObject* py_type = &ue_PyUObjectType;
+#if ENGINE_MAJOR_VERSION == 5 || (ENGINE_MAJOR_VERSION == 4 && ENGINE_MINOR_VERSION >= 25)
+		if (FPythonTypedBindings::Get().bEnabled && !ue_obj->IsA<UStruct>() && !ue_obj->IsA<UEnum>())
+		{
+			py_type = FPythonTypedBindings::Get().GetType(ue_obj->GetClass());
+		}
+#endif
+		ue_PyUObject* ue_py_object = (ue_PyUObject*)PyObject_New(ue_PyUObject, py_type);
 		if (!ue_py_object)
 		{
 			return nullptr;
 		}
+#if PY_VERSION_HEX < 0x03080000
+		// before 3.8 PyObject_New() does not take a reference to heap types, but their dealloc releases one
+		if (py_type->tp_flags & Py_TPFLAGS_HEAPTYPE)
+		{
+			Py_INCREF(py_type);
+		}
+#endif
 		ue_py_object->ue_object = ue_obj;
 		ue_py_object->py_proxy = nullptr;
 		ue_py_object->auto_rooted = 0;
@@ -4097,6 +4314,11 @@ ue_PyUObject* ue_is_pyuobject(PyObject* obj)
 	return (ue_PyUObject*)obj;
 }
 
+PyTypeObject* ue_get_pyuobject_type()
+{
+	return &ue_PyUObjectType;
+}
+
 #if ENGINE_MAJOR_VERSION == 5 || (ENGINE_MAJOR_VERSION == 4 && ENGINE_MINOR_VERSION >= 25)
 // check if a python object is a wrapper to an FProperty
 ue_PyFProperty* ue_is_pyfproperty(PyObject* obj)
@@ -4245,7 +4467,7 @@ void ue_autobind_events_for_pyclass(ue_PyUObject* u_obj, PyObject* py_class)
 	Py_DECREF(attrs);
 }
 
-static void py_ue_destroy_params(UFunction* u_function, uint8* buffer)
+void py_ue_destroy_params(UFunction* u_function, uint8* buffer)
 {
 	// destroy params
 #if ENGINE_MAJOR_VERSION == 5 || (ENGINE_MAJOR_VERSION == 4 && ENGINE_MINOR_VERSION >= 25)
@@ -34,6 +34,7 @@ PyObject *ue_py_convert_property(UProperty *, uint8 *, int32);
 bool ue_py_convert_pyobject(PyObject *, UProperty *, uint8 *, int32);
 #endif
 ue_PyUObject *ue_is_pyuobject(PyObject *);
+PyTypeObject *ue_get_pyuobject_type();
 #if ENGINE_MAJOR_VERSION == 5 || (ENGINE_MAJOR_VERSION == 4 && ENGINE_MINOR_VERSION >= 25)
 ue_PyFProperty *ue_is_pyfproperty(PyObject *);
 ue_PyFFieldClass *ue_is_pyffieldclass(PyObject *);
@@ -46,10 +47,25 @@ PyObject *ue_bind_pyevent(ue_PyUObject *, FString, PyObject *, bool);
 PyObject *ue_unbind_pyevent(ue_PyUObject *, FString, PyObject *, bool);
 
 PyObject *py_ue_ufunction_call(UFunction *, UObject *, PyObject *, int, PyObject *);
+void py_ue_destroy_params(UFunction *, uint8 *);
+#if ENGINE_MAJOR_VERSION == 5 || (ENGINE_MAJOR_VERSION == 4 && ENGINE_MINOR_VERSION >= 25)
+int ue_py_set_uobject_property(UObject *, FProperty *, PyObject *);
+#endif
 
 UClass *unreal_engine_new_uclass(char *, UClass *);
 UFunction *unreal_engine_add_function(UClass *, char *, PyObject *, uint32);
 
+// groups of types registered on first access when [Python] LazySubmodules is enabled,
+// C++ code creating their objects must call ue_python_ensure_submodule() first
+enum class EPythonSubmodule : uint8
+{
+	Slate,
+	Fbx,
+	Http,
+	Max
+};
+void ue_python_ensure_submodule(EPythonSubmodule);
+
 
 template <typename T> T *ue_py_check_type(PyObject *py_obj)
 {
@@ -0,0 +1,407 @@
+#include "UEPyModuleRegistry.h"
+
+#if WITH_EDITOR
+#include "HAL/FileManager.h"
+#include "Misc/Paths.h"
+#include "DirectoryWatcherModule.h"
+#include "IDirectoryWatcher.h"
+#endif
+
+FPythonModuleRegistry &FPythonModuleRegistry::Get()
+{
+	static FPythonModuleRegistry Singleton;
+	return Singleton;
+}
+
+FPythonModuleRegistry::FPythonModuleRegistry()
+{
+	bHotSwapClasses = false;
+#if WITH_EDITOR
+	Generation = 0;
+	Changes = 0;
+	bAnyPolled = false;
+#endif
+	Imports = 0;
+	Reloads = 0;
+	HotSwaps = 0;
+}
+
+PyObject *FPythonModuleRegistry::Import(const FString &ModuleName)
+{
+	Imports++;
+
+#if WITH_EDITOR
+	if (!Modules.Contains(ModuleName))
+	{
+		// the module could have been imported (and edited) before the registry started tracking it
+		bool bLoaded = PyDict_GetItemString(PyImport_GetModuleDict(), TCHAR_TO_UTF8(*ModuleName)) != nullptr;
+		PyObject *py_module = PyImport_ImportModule(TCHAR_TO_UTF8(*ModuleName));
+		if (!py_module)
+			return nullptr;
+		if (bLoaded)
+		{
+			PyObject *py_reloaded = PyImport_ReloadModule(py_module);
+			Py_DECREF(py_module);
+			if (!py_reloaded)
+				return nullptr;
+			Reloads++;
+			py_module = py_reloaded;
+		}
+		Track(ModuleName, py_module);
+		return py_module;
+	}
+
+	const FModuleEntry &Entry = Modules[ModuleName];
+	if (Entry.CheckedChanges != Changes || bAnyPolled)
+	{
+		TSet<FString> Visited;
+		Refresh(ModuleName, Visited);
+	}
+#endif
+
+	return PyImport_ImportModule(TCHAR_TO_UTF8(*ModuleName));
+}
+
+void FPythonModuleRegistry::TrackInstance(const FString &ModuleName, UObject *Owner)
+{
+#if WITH_EDITOR
+	if (!bHotSwapClasses || !Owner)
+		return;
+
+	if (FModuleEntry *Entry = Modules.Find(ModuleName))
+	{
+		Entry->Owners.Add(Owner);
+	}
+#endif
+}
+
+#if WITH_EDITOR
+static FString ue_py_module_registry_file(PyObject *py_module)
+{
+#if PY_MAJOR_VERSION >= 3
+	PyObject *py_file = PyModule_GetFilenameObject(py_module);
+	if (!py_file)
+	{
+		// builtin and namespace modules
+		PyErr_Clear();
+		return FString();
+	}
+	FString File = FPaths::ConvertRelativePathToFull(UTF8_TO_TCHAR(UEPyUnicode_AsUTF8(py_file)));
+	Py_DECREF(py_file);
+#else
+	const char *file = PyModule_GetFilename(py_module);
+	if (!file)
+	{
+		// builtin modules
+		PyErr_Clear();
+		return FString();
+	}
+	FString File = FPaths::ConvertRelativePathToFull(UTF8_TO_TCHAR(file));
+	// python 2 reports the compiled file of already compiled modules
+	if (File.EndsWith(TEXT(".pyc")))
+		File = File.LeftChop(1);
+#endif
+	FPaths::NormalizeFilename(File);
+	return File;
+}
+
+bool FPythonModuleRegistry::IsProjectFile(const FString &File) const
+{
+	if (!File.EndsWith(TEXT(".py")))
+		return false;
+	for (const FString &Prefix : PythonPrefixes)
+	{
+		if (File.StartsWith(Prefix))
+			return false;
+	}
+	return true;
+}
+
+void FPythonModuleRegistry::Track(const FString &ModuleName, PyObject *py_module)
+{
+	if (PythonPrefixes.Num() == 0)
+	{
+		const char *prefixes[] = { "prefix", "base_prefix" };
+		for (const char *prefix : prefixes)
+		{
+			PyObject *py_prefix = PySys_GetObject(prefix);
+			if (py_prefix && PyUnicodeOrString_Check(py_prefix))
+			{
+				FString Prefix = FPaths::ConvertRelativePathToFull(UTF8_TO_TCHAR(UEPyUnicode_AsUTF8(py_prefix)));
+				FPaths::NormalizeDirectoryName(Prefix);
+				PythonPrefixes.AddUnique(Prefix + TEXT("/"));
+			}
+		}
+	}
+
+	const FString File = ue_py_module_registry_file(py_module);
+	{
+		FModuleEntry &Entry = Modules.FindOrAdd(ModuleName);
+		if (!Entry.File.IsEmpty() && Entry.File != File)
+		{
+			if (TArray<FString> *Names = FileModules.Find(Entry.File))
+			{
+				Names->Remove(ModuleName);
+			}
+		}
+		Entry.File = File;
+		Entry.Timestamp = File.IsEmpty() ? FDateTime::MinValue() : IFileManager::Get().GetTimeStamp(*File);
+		Entry.Generation = Generation;
+		Entry.CheckedChanges = Changes;
+		Entry.bDirty = false;
+		Entry.bPolled = !File.IsEmpty() && !Watch(File);
+		bAnyPolled |= Entry.bPolled;
+	}
+
+	if (!File.IsEmpty())
+	{
+		FileModules.FindOrAdd(File).AddUnique(ModuleName);
+	}
+
+	// project modules referenced by the module dict (import foo, from foo import Bar)
+	TArray<FString> Dependencies;
+	PyObject *py_dict = PyModule_GetDict(py_module);
+	PyObject *py_key = nullptr;
+	PyObject *py_value = nullptr;
+	Py_ssize_t pos = 0;
+	while (PyDict_Next(py_dict, &pos, &py_key, &py_value))
+	{
+		FString Dependency;
+		if (PyModule_Check(py_value))
+		{
+			const char *name = PyModule_GetName(py_value);
+			if (name)
+				Dependency = UTF8_TO_TCHAR(name);
+		}
+		else if (PyType_Check(py_value) || PyFunction_Check(py_value))
+		{
+			PyObject *py_module_name = PyObject_GetAttrString(py_value, "__module__");
+			if (py_module_name && PyUnicodeOrString_Check(py_module_name))
+				Dependency = UTF8_TO_TCHAR(UEPyUnicode_AsUTF8(py_module_name));
+			Py_XDECREF(py_module_name);
+		}
+		PyErr_Clear();
+
+		if (Dependency.IsEmpty() || Dependency == ModuleName)
+			continue;
+		Dependencies.AddUnique(Dependency);
+	}
+
+	TArray<FString> TrackedDependencies;
+	for (const FString &Dependency : Dependencies)
+	{
+		if (!Modules.Contains(Dependency))
+		{
+			PyObject *py_dependency = PyDict_GetItemString(PyImport_GetModuleDict(), TCHAR_TO_UTF8(*Dependency));
+			if (!py_dependency || !PyModule_Check(py_dependency) || !IsProjectFile(ue_py_module_registry_file(py_dependency)))
+				continue;
+			Track(Dependency, py_dependency);
+		}
+		TrackedDependencies.Add(Dependency);
+	}
+
+	Modules[ModuleName].Dependencies = TrackedDependencies;
+}
+
+bool FPythonModuleRegistry::Watch(const FString &File)
+{
+	const FString Directory = FPaths::GetPath(File);
+	if (bool *bWatched = WatchedDirectories.Find(Directory))
+		return *bWatched;
+
+	bool bWatched = false;
+	FDirectoryWatcherModule &DirectoryWatcherModule = FModuleManager::LoadModuleChecked<FDirectoryWatcherModule>(TEXT("DirectoryWatcher"));
+	if (IDirectoryWatcher *DirectoryWatcher = DirectoryWatcherModule.Get())
+	{
+		FDelegateHandle Handle;
+		bWatched = DirectoryWatcher->RegisterDirectoryChangedCallback_Handle(Directory, IDirectoryWatcher::FDirectoryChanged::CreateRaw(this, &FPythonModuleRegistry::OnDirectoryChanged), Handle);
+		if (bWatched)
+			WatchHandles.Add(Directory, Handle);
+	}
+	WatchedDirectories.Add(Directory, bWatched);
+	return bWatched;
+}
+
+void FPythonModuleRegistry::OnDirectoryChanged(const TArray<FFileChangeData> &FileChanges)
+{
+	for (const FFileChangeData &FileChange : FileChanges)
+	{
+		FString File = FPaths::ConvertRelativePathToFull(FileChange.Filename);
+		FPaths::NormalizeFilename(File);
+		TArray<FString> *Names = FileModules.Find(File);
+		if (!Names)
+			continue;
+		for (const FString &Name : *Names)
+		{
+			if (FModuleEntry *Entry = Modules.Find(Name))
+			{
+				Entry->bDirty = true;
+			}
+		}
+		Changes++;
+	}
+}
+
+// returns the generation of the module, reloading it (after its dependencies) when needed
+uint64 FPythonModuleRegistry::Refresh(const FString &ModuleName, TSet<FString> &Visited)
+{
+	FModuleEntry *Entry = Modules.Find(ModuleName);
+	if (!Entry)
+		return 0;
+	if (Visited.Contains(ModuleName))
+		return Entry->Generation;
+	Visited.Add(ModuleName);
+
+	const uint64 LoadedGeneration = Entry->Generation;
+	bool bReload = false;
+	// copied, refreshing the dependencies could add new entries
+	const TArray<FString> Dependencies = Entry->Dependencies;
+	for (const FString &Dependency : Dependencies)
+	{
+		if (Refresh(Dependency, Visited) > LoadedGeneration)
+			bReload = true;
+	}
+
+	Entry = Modules.Find(ModuleName);
+	if ((Entry->bDirty || Entry->bPolled) && !Entry->File.IsEmpty())
+	{
+		bReload |= IFileManager::Get().GetTimeStamp(*Entry->File) != Entry->Timestamp;
+	}
+	Entry->bDirty = false;
+	Entry->CheckedChanges = Changes;
+
+	if (bReload)
+	{
+		Reload(ModuleName);
+	}
+	return Modules[ModuleName].Generation;
+}
+
+void FPythonModuleRegistry::Reload(const FString &ModuleName)
+{
+	PyObject *py_module = PyDict_GetItemString(PyImport_GetModuleDict(), TCHAR_TO_UTF8(*ModuleName));
+	PyObject *py_reloaded = py_module ? PyImport_ReloadModule(py_module) : PyImport_ImportModule(TCHAR_TO_UTF8(*ModuleName));
+	if (!py_reloaded)
+	{
+		unreal_engine_py_log_error();
+		// do not retry until the file changes again
+		FModuleEntry &Entry = Modules[ModuleName];
+		if (!Entry.File.IsEmpty())
+			Entry.Timestamp = IFileManager::Get().GetTimeStamp(*Entry.File);
+		return;
+	}
+
+	UE_LOG(LogPython, Log, TEXT("Reloaded python module %s"), *ModuleName);
+	Reloads++;
+	Generation++;
+	Track(ModuleName, py_reloaded);
+	if (bHotSwapClasses)
+	{
+		HotSwap(ModuleName, py_reloaded);
+	}
+	Py_DECREF(py_reloaded);
+}
+
+// move the proxies of the live objects to the classes with the same name in the reloaded module
+void FPythonModuleRegistry::HotSwap(const FString &ModuleName, PyObject *py_module)
+{
+	PyObject *py_dict = PyModule_GetDict(py_module);
+	FModuleEntry &Entry = Modules[ModuleName];
+	for (auto It = Entry.Owners.CreateIterator(); It; ++It)
+	{
+		UObject *Owner = It->Get();
+		if (!Owner)
+		{
+			It.RemoveCurrent();
+			continue;
+		}
+
+		ue_PyUObject *py_uobject = FUnrealEnginePythonHouseKeeper::Get()->GetPyUObject(Owner);
+		if (!py_uobject || !py_uobject->py_proxy)
+			continue;
+
+		PyObject *py_instance = py_uobject->py_proxy;
+		PyObject *py_old_class = (PyObject *)Py_TYPE(py_instance);
+		PyObject *py_class_module = PyObject_GetAttrString(py_old_class, "__module__");
+		PyObject *py_class_name = PyObject_GetAttrString(py_old_class, "__name__");
+		PyObject *py_new_class = nullptr;
+		if (py_class_module && py_class_name && PyUnicodeOrString_Check(py_class_module) && PyUnicodeOrString_Check(py_class_name) &&
+			ModuleName.Equals(UTF8_TO_TCHAR(UEPyUnicode_AsUTF8(py_class_module)), ESearchCase::CaseSensitive))
+		{
+			// borrowed
+			py_new_class = PyDict_GetItem(py_dict, py_class_name);
+		}
+		Py_XDECREF(py_class_module);
+		Py_XDECREF(py_class_name);
+		PyErr_Clear();
+
+		if (!py_new_class || !PyType_Check(py_new_class) || py_new_class == py_old_class)
+			continue;
+
+		if (PyObject_SetAttrString(py_instance, (char *)"__class__", py_new_class) < 0)
+		{
+			unreal_engine_py_log_error();
+			continue;
+		}
+		HotSwaps++;
+	}
+}
+#endif
+
+void FPythonModuleRegistry::Shutdown()
+{
+#if WITH_EDITOR
+	// the DirectoryWatcher module could already be gone
+	FDirectoryWatcherModule *DirectoryWatcherModule = FModuleManager::GetModulePtr<FDirectoryWatcherModule>(TEXT("DirectoryWatcher"));
+	if (IDirectoryWatcher *DirectoryWatcher = DirectoryWatcherModule ? DirectoryWatcherModule->Get() : nullptr)
+	{
+		for (const TPair<FString, FDelegateHandle> &Pair : WatchHandles)
+		{
+			DirectoryWatcher->UnregisterDirectoryChangedCallback_Handle(Pair.Key, Pair.Value);
+		}
+	}
+	WatchHandles.Empty();
+	WatchedDirectories.Empty();
+#endif
+}
+
+PyObject *FPythonModuleRegistry::GetStats()
+{
+	PyObject *py_dict = PyDict_New();
+	PyObject *py_value = nullptr;
+
+#if WITH_EDITOR
+	int32 Polled = 0;
+	for (const TPair<FString, FModuleEntry> &Pair : Modules)
+	{
+		if (Pair.Value.bPolled)
+			Polled++;
+	}
+	py_value = PyLong_FromLong(Modules.Num());
+	PyDict_SetItemString(py_dict, "modules", py_value);
+	Py_DECREF(py_value);
+	py_value = PyLong_FromLong(Polled);
+	PyDict_SetItemString(py_dict, "polled", py_value);
+	Py_DECREF(py_value);
+#endif
+
+	py_value = PyLong_FromUnsignedLongLong(Imports);
+	PyDict_SetItemString(py_dict, "imports", py_value);
+	Py_DECREF(py_value);
+	py_value = PyLong_FromUnsignedLongLong(Reloads);
+	PyDict_SetItemString(py_dict, "reloads", py_value);
+	Py_DECREF(py_value);
+	py_value = PyLong_FromUnsignedLongLong(HotSwaps);
+	PyDict_SetItemString(py_dict, "hot_swaps", py_value);
+	Py_DECREF(py_value);
+	py_value = PyBool_FromLong(bHotSwapClasses);
+	PyDict_SetItemString(py_dict, "hot_swap_classes", py_value);
+	Py_DECREF(py_value);
+
+	return py_dict;
+}
+
+PyObject *py_unreal_engine_module_registry_stats(PyObject *self, PyObject * args)
+{
+	return FPythonModuleRegistry::Get().GetStats();
+}
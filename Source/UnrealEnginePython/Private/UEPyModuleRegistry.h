@@ -0,0 +1,84 @@
+#pragma once
+
+
+
+#include "UEPyModule.h"
+
+/*
+
+Shared registry of the python modules used by PyActor, PyPawn, PyCharacter, PyHUD, PyUserWidget and PythonComponent.
+
+In the editor a module is reloaded only when its file (or the file of one of the project modules it depends on) changed,
+once for all of the instances. Changes are detected with the DirectoryWatcher (falling back to a timestamp check when the
+directory cannot be watched). Optionally the proxy instances of live objects are moved to the reloaded classes.
+
+Outside of the editor Import() is a plain PyImport_ImportModule().
+
+All of the methods must be called with the GIL held.
+
+*/
+class FPythonModuleRegistry
+{
+public:
+	static FPythonModuleRegistry &Get();
+
+	// set from the [Python] HotSwapClasses setting
+	bool bHotSwapClasses;
+
+	// new reference to the (up to date) module
+	PyObject *Import(const FString &ModuleName);
+
+	// the python proxy of Owner will be moved to the reloaded class on hot swap
+	void TrackInstance(const FString &ModuleName, UObject *Owner);
+
+	PyObject *GetStats();
+
+	// stops watching the module directories, called at module shutdown
+	void Shutdown();
+
+private:
+	FPythonModuleRegistry();
+
+#if WITH_EDITOR
+	struct FModuleEntry
+	{
+		FString File;
+		FDateTime Timestamp;
+		TArray<FString> Dependencies;
+		// value of Generation at the last (re)load
+		uint64 Generation = 0;
+		// value of Changes at the last check
+		uint64 CheckedChanges = 0;
+		bool bDirty = false;
+		// the directory is not watched, check the timestamp at every import
+		bool bPolled = false;
+		TSet<TWeakObjectPtr<UObject>> Owners;
+	};
+
+	void Track(const FString &ModuleName, PyObject *py_module);
+	uint64 Refresh(const FString &ModuleName, TSet<FString> &Visited);
+	void Reload(const FString &ModuleName);
+	void HotSwap(const FString &ModuleName, PyObject *py_module);
+	bool IsProjectFile(const FString &File) const;
+	bool Watch(const FString &File);
+	void OnDirectoryChanged(const TArray<struct FFileChangeData> &FileChanges);
+
+	TMap<FString, FModuleEntry> Modules;
+	TMap<FString, TArray<FString>> FileModules;
+	TMap<FString, bool> WatchedDirectories;
+	// DirectoryWatcher registrations, unregistered by Shutdown()
+	TMap<FString, FDelegateHandle> WatchHandles;
+	// sys.prefix and sys.base_prefix, modules living there are never tracked as dependencies
+	TArray<FString> PythonPrefixes;
+	uint64 Generation;
+	uint64 Changes;
+	// at least one module cannot be watched, dependencies must be checked at every import
+	bool bAnyPolled;
+#endif
+
+	uint64 Imports;
+	uint64 Reloads;
+	uint64 HotSwaps;
+};
+
+PyObject *py_unreal_engine_module_registry_stats(PyObject *, PyObject *);
@@ -0,0 +1,475 @@
+#include "UEPyShards.h"
+
+#include "HAL/PlatformProcess.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Internationalization/Regex.h"
+#include <stdio.h>
+
+// lines written by the children on their stdout, everything else (logs) is ignored
+#define UEPY_SHARD_RESULT_MARKER "@@uepy_result@@ "
+#define UEPY_SHARD_DONE_MARKER "@@uepy_done@@ "
+
+static FString ue_py_shards_json_string(const FString &Value)
+{
+	FString Escaped = TEXT("\"");
+	for (TCHAR Char : Value)
+	{
+		switch (Char)
+		{
+		case TEXT('"'):
+			Escaped += TEXT("\\\"");
+			break;
+		case TEXT('\\'):
+			Escaped += TEXT("\\\\");
+			break;
+		case TEXT('\n'):
+			Escaped += TEXT("\\n");
+			break;
+		case TEXT('\r'):
+			Escaped += TEXT("\\r");
+			break;
+		case TEXT('\t'):
+			Escaped += TEXT("\\t");
+			break;
+		default:
+			if (Char < 0x20)
+				Escaped += FString::Printf(TEXT("\\u%04x"), (int32)Char);
+			else
+				Escaped.AppendChar(Char);
+		}
+	}
+	Escaped.AppendChar(TEXT('"'));
+	return Escaped;
+}
+
+FPythonShardCoordinator::FPythonShardCoordinator(const TMap<FString, FString> &Params)
+{
+	NumProcesses = FMath::Max(1, FCString::Atoi(*Params.FindRef(TEXT("PyShards"))));
+	WorkListFile = Params.FindRef(TEXT("PyWorkList")).TrimQuotes();
+	OutputFile = Params.FindRef(TEXT("PyShardOutput")).TrimQuotes();
+	ShardSize = FCString::Atoi(*Params.FindRef(TEXT("PyShardSize")));
+	Retries = Params.Contains(TEXT("PyRetries")) ? FMath::Max(0, FCString::Atoi(*Params.FindRef(TEXT("PyRetries")))) : 1;
+	Timeout = FCString::Atod(*Params.FindRef(TEXT("PyShardTimeout")));
+	NumResults = 0;
+	NextShardId = 0;
+
+#if ENGINE_MAJOR_VERSION == 5 || (ENGINE_MAJOR_VERSION == 4 && ENGINE_MINOR_VERSION >= 18)
+	RunDir = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("PyShards"), FDateTime::Now().ToString());
+#else
+	RunDir = FPaths::Combine(FPaths::GameSavedDir(), TEXT("PyShards"), FDateTime::Now().ToString());
+#endif
+	if (OutputFile.IsEmpty())
+	{
+		OutputFile = FPaths::Combine(RunDir, TEXT("results.jsonl"));
+	}
+}
+
+FString FPythonShardCoordinator::StripSwitches(const FString &CommandLine)
+{
+	const FRegexPattern Pattern(TEXT("\\s*-(PyShards|PyWorkList|PyShardSize|PyRetries|PyShardTimeout|PyShardOutput|PyShard)=(\"[^\"]*\"|\\S+)"));
+	FRegexMatcher Matcher(Pattern, CommandLine);
+
+	FString Stripped;
+	int32 Last = 0;
+	while (Matcher.FindNext())
+	{
+		Stripped += CommandLine.Mid(Last, Matcher.GetMatchBeginning() - Last);
+		Last = Matcher.GetMatchEnding();
+	}
+	Stripped += CommandLine.Mid(Last);
+	return Stripped;
+}
+
+bool FPythonShardCoordinator::LoadWorkList()
+{
+	TArray<FString> Lines;
+	if (!FFileHelper::LoadFileToStringArray(Lines, *WorkListFile))
+	{
+		UE_LOG(LogPython, Error, TEXT("unable to read work list %s"), *WorkListFile);
+		return false;
+	}
+
+	for (FString &Line : Lines)
+	{
+		Line.TrimStartAndEndInline();
+		if (Line.IsEmpty() || Line.StartsWith(TEXT("#")))
+			continue;
+		Items.Add(Line);
+	}
+
+	Results.SetNum(Items.Num());
+	HasResult.Init(false, Items.Num());
+	return true;
+}
+
+int32 FPythonShardCoordinator::Run()
+{
+	if (WorkListFile.IsEmpty())
+	{
+		UE_LOG(LogPython, Error, TEXT("-PyShards requires a -PyWorkList file"));
+		return -1;
+	}
+
+	if (!LoadWorkList())
+		return -1;
+
+	if (Items.Num() == 0)
+	{
+		UE_LOG(LogPython, Warning, TEXT("work list %s is empty"), *WorkListFile);
+		return 0;
+	}
+
+	// smaller shards than Items / NumProcesses balance the load and make retries cheaper
+	if (ShardSize <= 0)
+	{
+		ShardSize = FMath::Max(1, FMath::DivideAndRoundUp(Items.Num(), NumProcesses * 4));
+	}
+
+	for (int32 Start = 0; Start < Items.Num(); Start += ShardSize)
+	{
+		FShard Shard;
+		Shard.Id = NextShardId++;
+		for (int32 i = Start; i < FMath::Min(Start + ShardSize, Items.Num()); i++)
+		{
+			Shard.Items.Add(i);
+		}
+		Pending.Add(Shard);
+	}
+
+	UE_LOG(LogPython, Log, TEXT("running %d items in %d shards over %d processes"), Items.Num(), Pending.Num(), NumProcesses);
+
+	const double StartTime = FPlatformTime::Seconds();
+	TArray<FRunningShard> Running;
+	for (;;)
+	{
+		while (Running.Num() < NumProcesses && Pending.Num() > 0)
+		{
+			FShard Shard = Pending[0];
+			Pending.RemoveAt(0);
+			FRunningShard &NewRunning = Running.AddDefaulted_GetRef();
+			if (!Launch(Shard, NewRunning))
+			{
+				Finish(NewRunning, false);
+				Running.Pop();
+			}
+		}
+
+		if (Running.Num() == 0)
+			break;
+
+		for (int32 i = Running.Num() - 1; i >= 0; i--)
+		{
+			FRunningShard &Current = Running[i];
+			Consume(Current);
+			if (!FPlatformProcess::IsProcRunning(Current.Process))
+			{
+				Consume(Current);
+				Finish(Current, false);
+				Running.RemoveAt(i);
+			}
+			else if (Timeout > 0 && FPlatformTime::Seconds() - Current.StartTime > Timeout)
+			{
+				FPlatformProcess::TerminateProc(Current.Process, true);
+				Consume(Current);
+				Finish(Current, true);
+				Running.RemoveAt(i);
+			}
+		}
+
+		FPlatformProcess::Sleep(0.05f);
+	}
+
+	const bool bWritten = WriteOutput();
+	UE_LOG(LogPython, Log, TEXT("%d/%d items completed in %.1f seconds, results in %s"), NumResults, Items.Num(), FPlatformTime::Seconds() - StartTime, *OutputFile);
+
+	return (bWritten && NumResults == Items.Num()) ? 0 : 1;
+}
+
+bool FPythonShardCoordinator::Launch(const FShard &Shard, FRunningShard &Running)
+{
+	Running.Shard = Shard;
+	Running.ShardItems = TSet<int32>(Shard.Items);
+	Running.StartTime = FPlatformTime::Seconds();
+
+	// one "index<TAB>item" per line
+	TArray<FString> Lines;
+	for (int32 Index : Shard.Items)
+	{
+		Lines.Add(FString::Printf(TEXT("%d\t%s"), Index, *Items[Index]));
+	}
+	const FString ShardFile = FPaths::ConvertRelativePathToFull(FPaths::Combine(RunDir, FString::Printf(TEXT("shard_%d_%d.txt"), Shard.Id, Shard.Attempt)));
+	if (!FFileHelper::SaveStringArrayToFile(Lines, *ShardFile, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM))
+	{
+		UE_LOG(LogPython, Error, TEXT("unable to write shard file %s"), *ShardFile);
+		return false;
+	}
+
+	if (!FPlatformProcess::CreatePipe(Running.ReadPipe, Running.WritePipe))
+	{
+		UE_LOG(LogPython, Error, TEXT("unable to create pipe for shard %d"), Shard.Id);
+		return false;
+	}
+
+	const FString Args = FString::Printf(TEXT("%s -PyShard=\"%s\""), *StripSwitches(FCommandLine::GetOriginal()), *ShardFile);
+	Running.Process = FPlatformProcess::CreateProc(FPlatformProcess::ExecutablePath(), *Args, false, true, true, nullptr, 0, nullptr, Running.WritePipe);
+	if (!Running.Process.IsValid())
+	{
+		UE_LOG(LogPython, Error, TEXT("unable to spawn process for shard %d"), Shard.Id);
+		FPlatformProcess::ClosePipe(Running.ReadPipe, Running.WritePipe);
+		Running.ReadPipe = nullptr;
+		Running.WritePipe = nullptr;
+		return false;
+	}
+	return true;
+}
+
+void FPythonShardCoordinator::Consume(FRunningShard &Running)
+{
+	if (!Running.ReadPipe)
+		return;
+
+	TArray<uint8> Data;
+	while (FPlatformProcess::ReadPipeToArray(Running.ReadPipe, Data) && Data.Num() > 0)
+	{
+		Running.Buffer.Append(Data);
+	}
+
+	int32 LineStart = 0;
+	for (int32 i = 0; i < Running.Buffer.Num(); i++)
+	{
+		if (Running.Buffer[i] != '\n')
+			continue;
+		FUTF8ToTCHAR Line((const ANSICHAR *)Running.Buffer.GetData() + LineStart, i - LineStart);
+		ProcessLine(Running, FString(Line.Length(), Line.Get()).TrimEnd());
+		LineStart = i + 1;
+	}
+	Running.Buffer.RemoveAt(0, LineStart);
+}
+
+void FPythonShardCoordinator::ProcessLine(FRunningShard &Running, const FString &Line)
+{
+	static const FString ResultMarker = UTF8_TO_TCHAR(UEPY_SHARD_RESULT_MARKER);
+	static const FString DoneMarker = UTF8_TO_TCHAR(UEPY_SHARD_DONE_MARKER);
+
+	// the marker can be preceded by log decorations
+	int32 Position = Line.Find(ResultMarker, ESearchCase::CaseSensitive);
+	if (Position != INDEX_NONE)
+	{
+		const FString Payload = Line.Mid(Position + ResultMarker.Len());
+		FString IndexString, Result;
+		if (!Payload.Split(TEXT(" "), &IndexString, &Result))
+			return;
+		const int32 Index = FCString::Atoi(*IndexString);
+		if (!Running.ShardItems.Contains(Index))
+		{
+			UE_LOG(LogPython, Warning, TEXT("[shard %d] ignoring result for item %s, not part of the shard"), Running.Shard.Id, *IndexString);
+			return;
+		}
+		Results[Index] = Result;
+		if (!HasResult[Index])
+		{
+			HasResult[Index] = true;
+			NumResults++;
+			Running.Reported++;
+		}
+		return;
+	}
+
+	Position = Line.Find(DoneMarker, ESearchCase::CaseSensitive);
+	if (Position != INDEX_NONE)
+	{
+		Running.bDone = true;
+		Running.PeakMemory = FCString::Strtoui64(*Line.Mid(Position + DoneMarker.Len()), nullptr, 10);
+		return;
+	}
+
+	UE_LOG(LogPython, VeryVerbose, TEXT("[shard %d] %s"), Running.Shard.Id, *Line);
+}
+
+void FPythonShardCoordinator::Finish(FRunningShard &Running, bool bTimedOut)
+{
+	int32 ReturnCode = -1;
+	if (Running.Process.IsValid())
+	{
+		FPlatformProcess::GetProcReturnCode(Running.Process, &ReturnCode);
+		FPlatformProcess::CloseProc(Running.Process);
+	}
+	if (Running.ReadPipe)
+	{
+		FPlatformProcess::ClosePipe(Running.ReadPipe, Running.WritePipe);
+		Running.ReadPipe = nullptr;
+		Running.WritePipe = nullptr;
+	}
+
+	FShard Missing;
+	Missing.Id = Running.Shard.Id;
+	Missing.Attempt = Running.Shard.Attempt + 1;
+	for (int32 Index : Running.Shard.Items)
+	{
+		if (!HasResult[Index])
+			Missing.Items.Add(Index);
+	}
+
+	UE_LOG(LogPython, Log, TEXT("shard %d (attempt %d): %d/%d items in %.1f seconds, peak memory %.1f MB, exit code %d%s%s"),
+		Running.Shard.Id, Running.Shard.Attempt + 1, Running.Shard.Items.Num() - Missing.Items.Num(), Running.Shard.Items.Num(),
+		FPlatformTime::Seconds() - Running.StartTime, Running.PeakMemory / (1024.0 * 1024.0), ReturnCode,
+		bTimedOut ? TEXT(", timed out") : TEXT(""), Running.bDone ? TEXT("") : TEXT(", did not complete"));
+
+	if (Missing.Items.Num() == 0)
+		return;
+
+	if (Missing.Attempt <= Retries)
+	{
+		Pending.Add(Missing);
+	}
+	else
+	{
+		UE_LOG(LogPython, Error, TEXT("shard %d failed, %d items without results"), Running.Shard.Id, Missing.Items.Num());
+	}
+}
+
+bool FPythonShardCoordinator::WriteOutput()
+{
+	TArray<FString> Lines;
+	TArray<FString> Failed;
+	for (int32 i = 0; i < Items.Num(); i++)
+	{
+		if (HasResult[i])
+		{
+			Lines.Add(FString::Printf(TEXT("{\"index\": %d, \"item\": %s, \"result\": %s}"), i, *ue_py_shards_json_string(Items[i]), *Results[i]));
+		}
+		else
+		{
+			Failed.Add(Items[i]);
+		}
+	}
+
+	if (!FFileHelper::SaveStringArrayToFile(Lines, *OutputFile, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM))
+	{
+		UE_LOG(LogPython, Error, TEXT("unable to write results to %s"), *OutputFile);
+		return false;
+	}
+
+	if (Failed.Num() > 0)
+	{
+		const FString FailedFile = FPaths::Combine(RunDir, TEXT("failed.txt"));
+		FFileHelper::SaveStringArrayToFile(Failed, *FailedFile, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM);
+		UE_LOG(LogPython, Error, TEXT("%d items failed, list in %s"), Failed.Num(), *FailedFile);
+	}
+	return true;
+}
+
+FPythonShard &FPythonShard::Get()
+{
+	static FPythonShard Singleton;
+	return Singleton;
+}
+
+FPythonShard::FPythonShard()
+{
+	bActive = false;
+}
+
+bool FPythonShard::Load(const FString &Filename)
+{
+	TArray<FString> Lines;
+	if (!FFileHelper::LoadFileToStringArray(Lines, *Filename))
+	{
+		UE_LOG(LogPython, Error, TEXT("unable to read shard file %s"), *Filename);
+		return false;
+	}
+
+	for (const FString &Line : Lines)
+	{
+		FString IndexString, Item;
+		if (!Line.Split(TEXT("\t"), &IndexString, &Item))
+			continue;
+		const int32 Index = FCString::Atoi(*IndexString);
+		Items.Add(Item);
+		Indices.Add(Index);
+		ItemIndices.Add(Item, Index);
+	}
+
+	bActive = true;
+	return true;
+}
+
+int32 FPythonShard::FindIndex(const FString &Item) const
+{
+	const int32 *Index = ItemIndices.Find(Item);
+	return Index ? *Index : INDEX_NONE;
+}
+
+void FPythonShard::Report(int32 Index, const FString &Payload)
+{
+	// a single write per line, so it is not interleaved with the log output
+	FTCHARToUTF8 Utf8Payload(*Payload);
+	fprintf(stdout, "\n" UEPY_SHARD_RESULT_MARKER "%d %s\n", Index, Utf8Payload.Get());
+	fflush(stdout);
+}
+
+void FPythonShard::Done()
+{
+	fprintf(stdout, "\n" UEPY_SHARD_DONE_MARKER "%llu\n", (unsigned long long)FPlatformMemory::GetStats().PeakUsedPhysical);
+	fflush(stdout);
+}
+
+PyObject *py_unreal_engine_get_shard_items(PyObject *self, PyObject * args)
+{
+	FPythonShard &Shard = FPythonShard::Get();
+	if (!Shard.IsActive())
+		Py_RETURN_NONE;
+
+	PyObject *py_list = PyList_New(Shard.Items.Num());
+	for (int32 i = 0; i < Shard.Items.Num(); i++)
+	{
+		PyList_SetItem(py_list, i, PyUnicode_FromString(TCHAR_TO_UTF8(*Shard.Items[i])));
+	}
+	return py_list;
+}
+
+PyObject *py_unreal_engine_shard_result(PyObject *self, PyObject * args)
+{
+	PyObject *py_item;
+	PyObject *py_result = Py_None;
+	if (!PyArg_ParseTuple(args, "O|O:shard_result", &py_item, &py_result))
+		return nullptr;
+
+	FPythonShard &Shard = FPythonShard::Get();
+	if (!Shard.IsActive())
+		return PyErr_Format(PyExc_Exception, "not running as a shard (-PyShard)");
+
+	int32 Index = INDEX_NONE;
+	if (PyLong_Check(py_item))
+	{
+		// position in get_shard_items()
+		const long Position = PyLong_AsLong(py_item);
+		if (Position < 0 || Position >= Shard.Indices.Num())
+			return PyErr_Format(PyExc_IndexError, "shard item index out of range");
+		Index = Shard.Indices[Position];
+	}
+	else if (PyUnicodeOrString_Check(py_item))
+	{
+		Index = Shard.FindIndex(UTF8_TO_TCHAR(UEPyUnicode_AsUTF8(py_item)));
+		if (Index == INDEX_NONE)
+			return PyErr_Format(PyExc_Exception, "item is not part of this shard");
+	}
+	else
+	{
+		return PyErr_Format(PyExc_TypeError, "argument is not a shard item or its index");
+	}
+
+	PyObject *py_json = PyImport_ImportModule("json");
+	if (!py_json)
+		return nullptr;
+	PyObject *py_payload = PyObject_CallMethod(py_json, (char *)"dumps", (char *)"O", py_result);
+	Py_DECREF(py_json);
+	if (!py_payload)
+		return nullptr;
+
+	Shard.Report(Index, UTF8_TO_TCHAR(UEPyUnicode_AsUTF8(py_payload)));
+	Py_DECREF(py_payload);
+
+	Py_RETURN_NONE;
+}
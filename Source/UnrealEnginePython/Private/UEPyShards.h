@@ -0,0 +1,104 @@
+#pragma once
+
+
+
+#include "UEPyModule.h"
+
+/*
+
+Sharded execution of UPyCommandlet jobs.
+
+The coordinator (-PyShards=N -PyWorkList=file) splits the work list into shards and runs them in up to N child
+commandlet processes. Every child receives its shard with -PyShard=file, gets the items with
+unreal_engine.get_shard_items() and streams back a json result per item with unreal_engine.shard_result()
+over its stdout pipe. Items without a result (crashes, timeouts, python errors) are retried in a new shard,
+then all of the results are merged in work list order.
+
+*/
+class FPythonShardCoordinator
+{
+public:
+	FPythonShardCoordinator(const TMap<FString, FString> &Params);
+
+	int32 Run();
+
+	// remove the coordinator and shard switches from a command line
+	static FString StripSwitches(const FString &CommandLine);
+
+private:
+	struct FShard
+	{
+		int32 Id = 0;
+		int32 Attempt = 0;
+		TArray<int32> Items;
+	};
+
+	struct FRunningShard
+	{
+		FShard Shard;
+		// the items of Shard, a worker can only report these
+		TSet<int32> ShardItems;
+		FProcHandle Process;
+		void *ReadPipe = nullptr;
+		void *WritePipe = nullptr;
+		double StartTime = 0;
+		TArray<uint8> Buffer;
+		int32 Reported = 0;
+		uint64 PeakMemory = 0;
+		bool bDone = false;
+	};
+
+	bool LoadWorkList();
+	bool Launch(const FShard &Shard, FRunningShard &Running);
+	void Consume(FRunningShard &Running);
+	void ProcessLine(FRunningShard &Running, const FString &Line);
+	void Finish(FRunningShard &Running, bool bTimedOut);
+	bool WriteOutput();
+
+	FString WorkListFile;
+	FString OutputFile;
+	FString RunDir;
+	int32 NumProcesses;
+	int32 ShardSize;
+	int32 Retries;
+	double Timeout;
+
+	TArray<FString> Items;
+	TArray<FString> Results;
+	TArray<bool> HasResult;
+	int32 NumResults;
+	TArray<FShard> Pending;
+	int32 NextShardId;
+};
+
+/*
+
+Child side of a sharded job, loaded by UPyCommandlet when -PyShard is passed.
+
+*/
+class FPythonShard
+{
+public:
+	static FPythonShard &Get();
+
+	bool Load(const FString &Filename);
+	bool IsActive() const { return bActive; }
+
+	// global (work list) index of an item of the shard
+	int32 FindIndex(const FString &Item) const;
+
+	void Report(int32 Index, const FString &Payload);
+	void Done();
+
+	TArray<FString> Items;
+	TArray<int32> Indices;
+
+private:
+	FPythonShard();
+
+	bool bActive;
+	TMap<FString, int32> ItemIndices;
+};
+
+PyObject *py_unreal_engine_get_shard_items(PyObject *, PyObject *);
+PyObject *py_unreal_engine_shard_result(PyObject *, PyObject *);
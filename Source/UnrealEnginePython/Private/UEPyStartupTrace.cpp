@@ -0,0 +1,90 @@
+#include "UEPyStartupTrace.h"
+
+#if ENGINE_MAJOR_VERSION == 5
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#endif
+
+FPythonStartupTrace &FPythonStartupTrace::Get()
+{
+	static FPythonStartupTrace Singleton;
+	return Singleton;
+}
+
+FPythonStartupTrace::FPythonStartupTrace()
+{
+	bVerbose = false;
+	StartTime = 0;
+}
+
+void FPythonStartupTrace::BeginPhase(const FString &Name)
+{
+	const double Now = FPlatformTime::Seconds();
+	if (Phases.Num() == 0)
+	{
+		StartTime = Now;
+	}
+
+	FPhase Phase;
+	Phase.Name = Name;
+	Phase.Depth = OpenPhases.Num();
+	Phase.Start = Now - StartTime;
+	OpenPhases.Add(Phases.Add(Phase));
+
+#if ENGINE_MAJOR_VERSION == 5 && CPUPROFILERTRACE_ENABLED
+	FCpuProfilerTrace::OutputBeginDynamicEvent(*FString::Printf(TEXT("Python: %s"), *Name));
+#endif
+}
+
+void FPythonStartupTrace::EndPhase()
+{
+	if (OpenPhases.Num() == 0)
+		return;
+
+#if ENGINE_MAJOR_VERSION == 5 && CPUPROFILERTRACE_ENABLED
+	FCpuProfilerTrace::OutputEndEvent();
+#endif
+
+	FPhase &Phase = Phases[OpenPhases.Pop()];
+	Phase.Duration = FPlatformTime::Seconds() - StartTime - Phase.Start;
+}
+
+void FPythonStartupTrace::Report()
+{
+	double Total = 0;
+	for (const FPhase &Phase : Phases)
+	{
+		if (Phase.Depth == 0)
+			Total += Phase.Duration;
+	}
+	UE_LOG(LogPython, Log, TEXT("Python startup took %.2f ms"), Total * 1000);
+
+	for (const FPhase &Phase : Phases)
+	{
+		const FString Indent = FString::ChrN(Phase.Depth * 2, TEXT(' '));
+		if (bVerbose)
+		{
+			UE_LOG(LogPython, Log, TEXT("  %s%s: %.2f ms"), *Indent, *Phase.Name, Phase.Duration * 1000);
+		}
+		else
+		{
+			UE_LOG(LogPython, Verbose, TEXT("  %s%s: %.2f ms"), *Indent, *Phase.Name, Phase.Duration * 1000);
+		}
+	}
+}
+
+PyObject *FPythonStartupTrace::GetPhases()
+{
+	PyObject *py_list = PyList_New(0);
+	for (const FPhase &Phase : Phases)
+	{
+		PyObject *py_phase = Py_BuildValue("(sidd)", TCHAR_TO_UTF8(*Phase.Name), Phase.Depth, Phase.Start, Phase.Duration);
+		PyList_Append(py_list, py_phase);
+		Py_DECREF(py_phase);
+	}
+	return py_list;
+}
+
+PyObject *py_unreal_engine_startup_trace(PyObject *self, PyObject * args)
+{
+	return FPythonStartupTrace::Get().GetPhases();
+}
@@ -0,0 +1,61 @@
+#pragma once
+
+
+
+#include "UEPyModule.h"
+
+/*
+
+Timings of the interpreter bring-up (ini parsing, Py_Initialize, unreal_engine module setup, ue_site and the
+ImportModules), plus the lazily initialized submodules when they are first accessed.
+
+Phases are reported to Unreal Insights too (when the cpu profiler trace is enabled) and can be read from python
+with unreal_engine.startup_trace().
+
+*/
+class FPythonStartupTrace
+{
+public:
+	static FPythonStartupTrace &Get();
+
+	// set from the [Python] StartupTrace setting, log every phase instead of just the total
+	bool bVerbose;
+
+	void BeginPhase(const FString &Name);
+	void EndPhase();
+
+	// log the phases recorded so far
+	void Report();
+
+	PyObject *GetPhases();
+
+	struct FScope
+	{
+		FScope(const FString &Name)
+		{
+			FPythonStartupTrace::Get().BeginPhase(Name);
+		}
+
+		~FScope()
+		{
+			FPythonStartupTrace::Get().EndPhase();
+		}
+	};
+
+private:
+	FPythonStartupTrace();
+
+	struct FPhase
+	{
+		FString Name;
+		int32 Depth = 0;
+		double Start = 0;
+		double Duration = 0;
+	};
+
+	TArray<FPhase> Phases;
+	TArray<int32> OpenPhases;
+	double StartTime;
+};
+
+PyObject *py_unreal_engine_startup_trace(PyObject *, PyObject *);
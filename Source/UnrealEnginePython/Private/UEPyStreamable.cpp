@@ -0,0 +1,457 @@
+#include "UEPyStreamable.h"
+
+#include "Engine/AssetManager.h"
+#include "Runtime/CoreUObject/Public/UObject/UObjectGlobals.h"
+#if WITH_EDITOR
+#include "Wrappers/UEPyFStringAssetReference.h"
+#endif
+
+// forwards streamable manager events to python, always called on the game thread
+class FPythonStreamableDelegate : public TSharedFromThis<FPythonStreamableDelegate>
+{
+public:
+	FPythonStreamableDelegate(PyObject *InOnComplete, PyObject *InOnUpdate, PyObject *InOnCancel) :
+		OnComplete(InOnComplete), OnUpdate(InOnUpdate), OnCancel(InOnCancel)
+	{
+		Py_XINCREF(OnComplete);
+		Py_XINCREF(OnUpdate);
+		Py_XINCREF(OnCancel);
+	}
+
+	~FPythonStreamableDelegate()
+	{
+		FScopePythonGIL gil;
+		Py_XDECREF(OnComplete);
+		Py_XDECREF(OnUpdate);
+		Py_XDECREF(OnCancel);
+	}
+
+	void Complete(TSharedPtr<FStreamableHandle> Handle)
+	{
+		if (OnComplete)
+		{
+			FScopePythonGIL gil;
+			PyObject *ret = PyObject_CallFunction(OnComplete, (char *)"N", LoadedAssetsToList(Handle));
+			if (!ret)
+			{
+				unreal_engine_py_log_error();
+			}
+			Py_XDECREF(ret);
+		}
+		ReleaseOrphan(Handle);
+	}
+
+	void Update(TSharedRef<FStreamableHandle> Handle)
+	{
+		if (!OnUpdate)
+			return;
+		FScopePythonGIL gil;
+		PyObject *ret = PyObject_CallFunction(OnUpdate, (char *)"f", Handle->GetProgress());
+		if (!ret)
+		{
+			unreal_engine_py_log_error();
+		}
+		Py_XDECREF(ret);
+	}
+
+	void Cancel(TSharedPtr<FStreamableHandle> Handle)
+	{
+		if (OnCancel)
+		{
+			FScopePythonGIL gil;
+			PyObject *ret = PyObject_CallFunction(OnCancel, nullptr);
+			if (!ret)
+			{
+				unreal_engine_py_log_error();
+			}
+			Py_XDECREF(ret);
+		}
+		ReleaseOrphan(Handle);
+	}
+
+	static PyObject *LoadedAssetsToList(TSharedPtr<FStreamableHandle> Handle)
+	{
+		PyObject *py_list = PyList_New(0);
+		if (!Handle.IsValid())
+			return py_list;
+		TArray<UObject *> Assets;
+		Handle->GetLoadedAssets(Assets);
+		for (UObject *Asset : Assets)
+		{
+			ue_PyUObject *py_asset = ue_get_python_uobject(Asset);
+			if (py_asset)
+			{
+				PyList_Append(py_list, (PyObject *)py_asset);
+			}
+		}
+		return py_list;
+	}
+
+	// handles whose python wrapper has been collected while still loading,
+	// kept alive until the streamable manager is done with them
+	static TArray<TSharedPtr<FStreamableHandle>> Orphans;
+
+private:
+	void ReleaseOrphan(TSharedPtr<FStreamableHandle> Handle)
+	{
+		Orphans.Remove(Handle);
+	}
+
+	PyObject *OnComplete;
+	PyObject *OnUpdate;
+	PyObject *OnCancel;
+};
+
+TArray<TSharedPtr<FStreamableHandle>> FPythonStreamableDelegate::Orphans;
+
+static FStreamableManager& ue_py_get_streamable_manager()
+{
+	if (UAssetManager::IsInitialized())
+	{
+		return UAssetManager::GetStreamableManager();
+	}
+	// the asset manager is not available in some commandlets
+	static FStreamableManager *StreamableManager = new FStreamableManager();
+	return *StreamableManager;
+}
+
+static PyObject *py_ue_fstreamable_handle_get_progress(ue_PyFStreamableHandle *self, PyObject * args)
+{
+	return PyFloat_FromDouble(self->handle->GetProgress());
+}
+
+static PyObject *py_ue_fstreamable_handle_get_loaded_count(ue_PyFStreamableHandle *self, PyObject * args)
+{
+	int32 loaded = 0;
+	int32 requested = 0;
+	self->handle->GetLoadedCount(loaded, requested);
+	return Py_BuildValue((char *)"(ii)", loaded, requested);
+}
+
+static PyObject *py_ue_fstreamable_handle_has_load_completed(ue_PyFStreamableHandle *self, PyObject * args)
+{
+	if (self->handle->HasLoadCompleted())
+		Py_RETURN_TRUE;
+	Py_RETURN_FALSE;
+}
+
+static PyObject *py_ue_fstreamable_handle_is_loading_in_progress(ue_PyFStreamableHandle *self, PyObject * args)
+{
+	if (self->handle->IsLoadingInProgress())
+		Py_RETURN_TRUE;
+	Py_RETURN_FALSE;
+}
+
+static PyObject *py_ue_fstreamable_handle_was_canceled(ue_PyFStreamableHandle *self, PyObject * args)
+{
+	if (self->handle->WasCanceled())
+		Py_RETURN_TRUE;
+	Py_RETURN_FALSE;
+}
+
+static PyObject *py_ue_fstreamable_handle_cancel(ue_PyFStreamableHandle *self, PyObject * args)
+{
+	self->handle->CancelHandle();
+	Py_RETURN_NONE;
+}
+
+static PyObject *py_ue_fstreamable_handle_release(ue_PyFStreamableHandle *self, PyObject * args)
+{
+	self->handle->ReleaseHandle();
+	Py_RETURN_NONE;
+}
+
+static PyObject *py_ue_fstreamable_handle_wait_until_complete(ue_PyFStreamableHandle *self, PyObject * args)
+{
+	float timeout = 0;
+	if (!PyArg_ParseTuple(args, "|f:wait_until_complete", &timeout))
+	{
+		return nullptr;
+	}
+
+	EAsyncPackageState::Type result;
+	Py_BEGIN_ALLOW_THREADS;
+	result = self->handle->WaitUntilComplete(timeout);
+	Py_END_ALLOW_THREADS;
+
+	if (result == EAsyncPackageState::Complete)
+		Py_RETURN_TRUE;
+	Py_RETURN_FALSE;
+}
+
+static PyObject *py_ue_fstreamable_handle_get_loaded_assets(ue_PyFStreamableHandle *self, PyObject * args)
+{
+	return FPythonStreamableDelegate::LoadedAssetsToList(self->handle);
+}
+
+static PyMethodDef ue_PyFStreamableHandle_methods[] = {
+	{ "get_progress", (PyCFunction)py_ue_fstreamable_handle_get_progress, METH_VARARGS, "" },
+	{ "get_loaded_count", (PyCFunction)py_ue_fstreamable_handle_get_loaded_count, METH_VARARGS, "" },
+	{ "has_load_completed", (PyCFunction)py_ue_fstreamable_handle_has_load_completed, METH_VARARGS, "" },
+	{ "is_loading_in_progress", (PyCFunction)py_ue_fstreamable_handle_is_loading_in_progress, METH_VARARGS, "" },
+	{ "was_canceled", (PyCFunction)py_ue_fstreamable_handle_was_canceled, METH_VARARGS, "" },
+	{ "cancel", (PyCFunction)py_ue_fstreamable_handle_cancel, METH_VARARGS, "" },
+	{ "release", (PyCFunction)py_ue_fstreamable_handle_release, METH_VARARGS, "" },
+	{ "wait_until_complete", (PyCFunction)py_ue_fstreamable_handle_wait_until_complete, METH_VARARGS, "" },
+	{ "get_loaded_assets", (PyCFunction)py_ue_fstreamable_handle_get_loaded_assets, METH_VARARGS, "" },
+	{ NULL }  /* Sentinel */
+};
+
+// destructor
+static void ue_pyfstreamable_handle_dealloc(ue_PyFStreamableHandle *self)
+{
+	// do not abort in-flight loads when the python side loses interest, callbacks still need to fire
+	if (self->handle.IsValid() && self->handle->IsLoadingInProgress())
+	{
+		FPythonStreamableDelegate::Orphans.Add(self->handle);
+	}
+	self->handle.Reset();
+	self->delegate_ptr.Reset();
+	Py_TYPE(self)->tp_free((PyObject *)self);
+}
+
+// awaiting a handle yields to the event loop until the load is over, the result is the list of loaded assets
+static PyObject *ue_pyfstreamable_handle_await(ue_PyFStreamableHandle *self)
+{
+	Py_INCREF(self);
+	return (PyObject *)self;
+}
+
+static PyObject *ue_pyfstreamable_handle_iternext(ue_PyFStreamableHandle *self)
+{
+	if (self->handle->IsLoadingInProgress())
+	{
+		Py_RETURN_NONE;
+	}
+
+	if (self->handle->WasCanceled())
+	{
+		PyErr_SetString(PyExc_Exception, "async load has been canceled");
+		return nullptr;
+	}
+
+	PyObject *py_assets = FPythonStreamableDelegate::LoadedAssetsToList(self->handle);
+	PyObject *py_stop = PyObject_CallFunctionObjArgs(PyExc_StopIteration, py_assets, nullptr);
+	Py_DECREF(py_assets);
+	if (!py_stop)
+		return nullptr;
+	PyErr_SetObject(PyExc_StopIteration, py_stop);
+	Py_DECREF(py_stop);
+	return nullptr;
+}
+
+#if PY_MAJOR_VERSION >= 3
+static PyAsyncMethods ue_PyFStreamableHandle_async = {
+	(unaryfunc)ue_pyfstreamable_handle_await, /* am_await */
+	0,                                        /* am_aiter */
+	0,                                        /* am_anext */
+};
+#endif
+
+static PyTypeObject ue_PyFStreamableHandleType = {
+	PyVarObject_HEAD_INIT(NULL, 0)
+	"unreal_engine.FStreamableHandle", /* tp_name */
+	sizeof(ue_PyFStreamableHandle), /* tp_basicsize */
+	0,                         /* tp_itemsize */
+	(destructor)ue_pyfstreamable_handle_dealloc,       /* tp_dealloc */
+	0,                         /* tp_print */
+	0,                         /* tp_getattr */
+	0,                         /* tp_setattr */
+	0,                         /* tp_reserved */
+	0,                         /* tp_repr */
+	0,                         /* tp_as_number */
+	0,                         /* tp_as_sequence */
+	0,                         /* tp_as_mapping */
+	0,                         /* tp_hash  */
+	0,                         /* tp_call */
+	0,                         /* tp_str */
+	0,                         /* tp_getattro */
+	0,                         /* tp_setattro */
+	0,                         /* tp_as_buffer */
+	Py_TPFLAGS_DEFAULT,        /* tp_flags */
+	"Unreal Engine FStreamableHandle",           /* tp_doc */
+	0,                         /* tp_traverse */
+	0,                         /* tp_clear */
+	0,                         /* tp_richcompare */
+	0,                         /* tp_weaklistoffset */
+	0,                         /* tp_iter */
+	(iternextfunc)ue_pyfstreamable_handle_iternext,  /* tp_iternext */
+	ue_PyFStreamableHandle_methods,             /* tp_methods */
+};
+
+void ue_python_init_fstreamable_handle(PyObject *ue_module)
+{
+	// handles are only returned by the async load functions, no tp_new
+	ue_PyFStreamableHandleType.tp_iter = PyObject_SelfIter;
+#if PY_MAJOR_VERSION >= 3
+	ue_PyFStreamableHandleType.tp_as_async = &ue_PyFStreamableHandle_async;
+#endif
+	if (PyType_Ready(&ue_PyFStreamableHandleType) < 0)
+		return;
+
+	Py_INCREF(&ue_PyFStreamableHandleType);
+	PyModule_AddObject(ue_module, "FStreamableHandle", (PyObject *)&ue_PyFStreamableHandleType);
+
+	PyObject *unreal_engine_dict = PyModule_GetDict(ue_module);
+	PyDict_SetItemString(unreal_engine_dict, "ASYNC_LOAD_DEFAULT_PRIORITY", PyLong_FromLong(FStreamableManager::DefaultAsyncLoadPriority));
+	PyDict_SetItemString(unreal_engine_dict, "ASYNC_LOAD_HIGH_PRIORITY", PyLong_FromLong(FStreamableManager::AsyncLoadHighPriority));
+}
+
+static bool ue_py_soft_path_from_pyobject(PyObject *py_item, FSoftObjectPath& path)
+{
+	if (PyUnicodeOrString_Check(py_item))
+	{
+		path = FSoftObjectPath(FString(UTF8_TO_TCHAR(UEPyUnicode_AsUTF8(py_item))));
+		return true;
+	}
+
+	if (ue_PyUObject *py_obj = ue_is_pyuobject(py_item))
+	{
+		path = FSoftObjectPath(py_obj->ue_object);
+		return true;
+	}
+
+#if WITH_EDITOR
+	if (ue_PyFStringAssetReference *py_ref = py_ue_is_fstring_asset_reference(py_item))
+	{
+		path = py_ref->fstring_asset_reference;
+		return true;
+	}
+#endif
+
+	return false;
+}
+
+PyObject *py_unreal_engine_request_async_load(PyObject * self, PyObject * args, PyObject *kwargs)
+{
+	PyObject *py_paths;
+	PyObject *py_on_complete = nullptr;
+	int priority = FStreamableManager::DefaultAsyncLoadPriority;
+	PyObject *py_on_update = nullptr;
+	PyObject *py_on_cancel = nullptr;
+
+	static char *kw_names[] = { (char *)"paths", (char *)"on_complete", (char *)"priority", (char *)"on_update", (char *)"on_cancel", NULL };
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O|OiOO:request_async_load", kw_names, &py_paths, &py_on_complete, &priority, &py_on_update, &py_on_cancel))
+	{
+		return nullptr;
+	}
+
+	if (py_on_complete == Py_None)
+		py_on_complete = nullptr;
+	if (py_on_update == Py_None)
+		py_on_update = nullptr;
+	if (py_on_cancel == Py_None)
+		py_on_cancel = nullptr;
+
+	if ((py_on_complete && !PyCallable_Check(py_on_complete)) ||
+		(py_on_update && !PyCallable_Check(py_on_update)) ||
+		(py_on_cancel && !PyCallable_Check(py_on_cancel)))
+	{
+		return PyErr_Format(PyExc_Exception, "callbacks must be callables");
+	}
+
+	TArray<FSoftObjectPath> paths;
+	FSoftObjectPath path;
+	if (ue_py_soft_path_from_pyobject(py_paths, path))
+	{
+		paths.Add(path);
+	}
+	else
+	{
+		PyObject *py_iter = PyObject_GetIter(py_paths);
+		if (!py_iter)
+			return PyErr_Format(PyExc_Exception, "argument is not a path or an iterable of paths");
+
+		while (PyObject *py_item = PyIter_Next(py_iter))
+		{
+			if (!ue_py_soft_path_from_pyobject(py_item, path))
+			{
+				Py_DECREF(py_item);
+				Py_DECREF(py_iter);
+				return PyErr_Format(PyExc_Exception, "argument is not a path or an iterable of paths");
+			}
+			paths.Add(path);
+			Py_DECREF(py_item);
+		}
+		Py_DECREF(py_iter);
+	}
+
+	TSharedRef<FPythonStreamableDelegate> py_delegate = MakeShareable(new FPythonStreamableDelegate(py_on_complete, py_on_update, py_on_cancel));
+
+	// the handle does not exist yet when the delegate is built, so resolve it lazily through a shared slot
+	TSharedRef<TWeakPtr<FStreamableHandle>> handle_slot = MakeShareable(new TWeakPtr<FStreamableHandle>());
+
+	FStreamableDelegate complete_delegate = FStreamableDelegate::CreateLambda([py_delegate, handle_slot]()
+	{
+		py_delegate->Complete(handle_slot->Pin());
+	});
+
+	TSharedPtr<FStreamableHandle> handle = ue_py_get_streamable_manager().RequestAsyncLoad(paths, complete_delegate, priority, false, true, TEXT("UnrealEnginePython"));
+	if (!handle.IsValid())
+		return PyErr_Format(PyExc_Exception, "unable to start async load");
+
+	*handle_slot = handle;
+
+	handle->BindUpdateDelegate(FStreamableUpdateDelegate::CreateSP(py_delegate, &FPythonStreamableDelegate::Update));
+	handle->BindCancelDelegate(FStreamableDelegate::CreateLambda([py_delegate, handle_slot]()
+	{
+		py_delegate->Cancel(handle_slot->Pin());
+	}));
+
+	// the request was created stalled, so all of the delegates are bound before anything can complete
+	handle->StartStalledHandle();
+
+	ue_PyFStreamableHandle *ret = (ue_PyFStreamableHandle *)PyObject_New(ue_PyFStreamableHandle, &ue_PyFStreamableHandleType);
+	if (!ret)
+	{
+		return PyErr_Format(PyExc_Exception, "unable to allocate FStreamableHandle python object");
+	}
+
+	new(&ret->handle) TSharedPtr<FStreamableHandle>(handle);
+	new(&ret->delegate_ptr) TSharedPtr<FPythonStreamableDelegate>(py_delegate);
+
+	return (PyObject *)ret;
+}
+
+PyObject *py_unreal_engine_load_package_async(PyObject * self, PyObject * args)
+{
+	char *name;
+	PyObject *py_callable = nullptr;
+	int priority = 0;
+	if (!PyArg_ParseTuple(args, "s|Oi:load_package_async", &name, &py_callable, &priority))
+	{
+		return nullptr;
+	}
+
+	if (py_callable == Py_None)
+		py_callable = nullptr;
+
+	if (py_callable && !PyCallable_Check(py_callable))
+		return PyErr_Format(PyExc_Exception, "object is not a callable");
+
+	TSharedRef<FPythonSmartDelegate> py_delegate = MakeShareable(new FPythonSmartDelegate);
+	if (py_callable)
+	{
+		py_delegate->SetPyCallable(py_callable);
+	}
+
+	int32 request_id = LoadPackageAsync(FString(UTF8_TO_TCHAR(name)), FLoadPackageAsyncDelegate::CreateLambda([py_delegate, py_callable](const FName& PackageName, UPackage *Package, EAsyncLoadingResult::Type Result)
+	{
+		if (!py_callable)
+			return;
+		FScopePythonGIL gil;
+		PyObject *py_package = Package ? (PyObject *)ue_get_python_uobject(Package) : Py_None;
+		if (!py_package)
+			py_package = Py_None;
+		PyObject *ret = PyObject_CallFunction(py_callable, (char *)"sOi", TCHAR_TO_UTF8(*PackageName.ToString()), py_package, (int)Result);
+		if (!ret)
+		{
+			unreal_engine_py_log_error();
+			return;
+		}
+		Py_DECREF(ret);
+	}), priority);
+
+	return PyLong_FromLong(request_id);
+}
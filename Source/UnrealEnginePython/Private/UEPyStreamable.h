@@ -0,0 +1,21 @@
+#pragma once
+
+
+
+#include "UEPyModule.h"
+#include "Engine/StreamableManager.h"
+
+class FPythonStreamableDelegate;
+
+typedef struct
+{
+	PyObject_HEAD
+		/* Type-specific fields go here. */
+		TSharedPtr<FStreamableHandle> handle;
+	TSharedPtr<FPythonStreamableDelegate> delegate_ptr;
+} ue_PyFStreamableHandle;
+
+PyObject *py_unreal_engine_request_async_load(PyObject *, PyObject *, PyObject *);
+PyObject *py_unreal_engine_load_package_async(PyObject *, PyObject *);
+
+void ue_python_init_fstreamable_handle(PyObject *);
@@ -0,0 +1,805 @@
+#include "UEPyTypedBindings.h"
+
+#if ENGINE_MAJOR_VERSION == 5 || (ENGINE_MAJOR_VERSION == 4 && ENGINE_MINOR_VERSION >= 25)
+
+#include "Runtime/Core/Public/Misc/FileHelper.h"
+#include "Engine/EngineTypes.h"
+
+// precomputed ProcessEvent() parameters of a UFunction
+struct FPythonCallPlan
+{
+	struct FInput
+	{
+		FProperty *Property;
+		TArray<ANSICHAR> Name;
+	};
+
+	UFunction *Function;
+	TArray<FInput> Inputs;
+	// parameters that are not zero constructible
+	TArray<FProperty *> Initialized;
+	TArray<TPair<FProperty *, FString>> Defaults;
+	FProperty *ReturnProperty;
+	TArray<FProperty *> Outputs;
+
+	FPythonCallPlan(UFunction *InFunction) : Function(InFunction), ReturnProperty(nullptr)
+	{
+		bool bInputs = true;
+		for (TFieldIterator<FProperty> It(Function); It && It->HasAnyPropertyFlags(CPF_Parm); ++It)
+		{
+			FProperty *Property = *It;
+			if (!Property->HasAnyPropertyFlags(CPF_ZeroConstructor))
+			{
+				Initialized.Add(Property);
+			}
+
+			if (Property->HasAnyPropertyFlags(CPF_ReturnParm))
+			{
+				ReturnProperty = Property;
+				// like py_ue_ufunction_call(), python arguments stop at the return value
+				bInputs = false;
+				continue;
+			}
+
+			if (bInputs)
+			{
+				FInput Input;
+				Input.Property = Property;
+				FTCHARToUTF8 Utf8Name(*Property->GetName());
+				Input.Name.Append(Utf8Name.Get(), Utf8Name.Length() + 1);
+				Inputs.Add(Input);
+#if WITH_EDITOR
+				FString DefaultValue = Function->GetMetaData(FName(*(FString("CPP_Default_") + Property->GetName())));
+				if (!DefaultValue.IsEmpty())
+				{
+					Defaults.Add(TPair<FProperty *, FString>(Property, DefaultValue));
+				}
+#endif
+			}
+
+			if (Property->HasAnyPropertyFlags(CPF_OutParm) && (Property->IsA<FArrayProperty>() || !Property->HasAnyPropertyFlags(CPF_ConstParm)))
+			{
+				Outputs.Add(Property);
+			}
+		}
+	}
+
+	PyObject *Call(UObject *Target, PyObject *args, PyObject *kwargs) const
+	{
+		// __super calls (and every other corner case) go through the generic path
+		if (kwargs && PyDict_GetItemString(kwargs, (char *)"__super"))
+		{
+			return py_ue_ufunction_call(Function, Target, args, 0, kwargs);
+		}
+
+		uint8 *buffer = (uint8 *)FMemory_Alloca(Function->ParmsSize);
+		FMemory::Memzero(buffer, Function->ParmsSize);
+		for (FProperty *Property : Initialized)
+		{
+			Property->InitializeValue_InContainer(buffer);
+		}
+		for (const TPair<FProperty *, FString> &Default : Defaults)
+		{
+			Default.Key->ImportText_Direct(*Default.Value, Default.Key->ContainerPtrToValuePtr<uint8>(buffer), nullptr, PPF_None, nullptr);
+		}
+
+		const Py_ssize_t tuple_len = PyTuple_Size(args);
+		for (int32 i = 0; i < Inputs.Num(); i++)
+		{
+			PyObject *py_arg = nullptr;
+			if (i < tuple_len)
+			{
+				py_arg = PyTuple_GetItem(args, i);
+			}
+			else if (kwargs)
+			{
+				py_arg = PyDict_GetItemString(kwargs, Inputs[i].Name.GetData());
+			}
+
+			if (py_arg && !ue_py_convert_pyobject(py_arg, Inputs[i].Property, buffer, 0))
+			{
+				py_ue_destroy_params(Function, buffer);
+				return PyErr_Format(PyExc_TypeError, "unable to convert pyobject to property %s (%s)", Inputs[i].Name.GetData(), TCHAR_TO_UTF8(*Inputs[i].Property->GetClass()->GetName()));
+			}
+		}
+
+		FScopeCycleCounterUObject ObjectScope(Target);
+		FScopeCycleCounterUObject FunctionScope(Function);
+
+		Py_BEGIN_ALLOW_THREADS;
+		Target->ProcessEvent(Function, buffer);
+		Py_END_ALLOW_THREADS;
+
+		PyObject *ret = nullptr;
+		if (ReturnProperty)
+		{
+			ret = ue_py_convert_property(ReturnProperty, buffer, 0);
+			if (!ret)
+			{
+				py_ue_destroy_params(Function, buffer);
+				return nullptr;
+			}
+		}
+
+		if (Outputs.Num() > 0)
+		{
+			const int32 has_ret = ret ? 1 : 0;
+			PyObject *multi_ret = PyTuple_New(Outputs.Num() + has_ret);
+			if (ret)
+			{
+				PyTuple_SetItem(multi_ret, 0, ret);
+			}
+			for (int32 i = 0; i < Outputs.Num(); i++)
+			{
+				PyObject *py_out = ue_py_convert_property(Outputs[i], buffer, 0);
+				if (!py_out)
+				{
+					Py_DECREF(multi_ret);
+					py_ue_destroy_params(Function, buffer);
+					return nullptr;
+				}
+				PyTuple_SetItem(multi_ret, i + has_ret, py_out);
+			}
+			py_ue_destroy_params(Function, buffer);
+			return multi_ret;
+		}
+
+		py_ue_destroy_params(Function, buffer);
+
+		if (ret)
+			return ret;
+
+		Py_RETURN_NONE;
+	}
+};
+
+typedef struct
+{
+	PyObject_HEAD
+		/* Type-specific fields go here. */
+	FProperty *property;
+	PyObject *name;
+} ue_PyTypedProperty;
+
+typedef struct
+{
+	PyObject_HEAD
+		/* Type-specific fields go here. */
+	UFunction *function;
+	// built on the first call
+	FPythonCallPlan *plan;
+	PyObject *name;
+} ue_PyTypedFunction;
+
+typedef struct
+{
+	PyObject_HEAD
+		/* Type-specific fields go here. */
+	ue_PyTypedFunction *descriptor;
+	ue_PyUObject *py_object;
+} ue_PyTypedBoundFunction;
+
+static PyObject *ue_PyTypedProperty_get(ue_PyTypedProperty *self, PyObject *obj, PyObject *type)
+{
+	if (!obj)
+	{
+		Py_INCREF(self);
+		return (PyObject *)self;
+	}
+
+	ue_PyUObject *py_obj = (ue_PyUObject *)obj;
+	ue_py_check(py_obj);
+
+	return ue_py_convert_property(self->property, (uint8 *)py_obj->ue_object, 0);
+}
+
+static int ue_PyTypedProperty_set(ue_PyTypedProperty *self, PyObject *obj, PyObject *value)
+{
+	if (!value)
+	{
+		PyErr_Format(PyExc_AttributeError, "FProperty %s cannot be deleted", UEPyUnicode_AsUTF8(self->name));
+		return -1;
+	}
+
+	ue_PyUObject *py_obj = (ue_PyUObject *)obj;
+	ue_py_check_int(py_obj);
+
+	return ue_py_set_uobject_property(py_obj->ue_object, self->property, value);
+}
+
+static void ue_PyTypedProperty_dealloc(ue_PyTypedProperty *self)
+{
+	Py_XDECREF(self->name);
+	Py_TYPE(self)->tp_free((PyObject *)self);
+}
+
+static PyObject *ue_PyTypedProperty_repr(ue_PyTypedProperty *self)
+{
+	return PyUnicode_FromFormat("<unreal_engine property '%U' (%s)>", self->name, TCHAR_TO_UTF8(*self->property->GetClass()->GetName()));
+}
+
+static PyTypeObject ue_PyTypedPropertyType = {
+	PyVarObject_HEAD_INIT(NULL, 0)
+	"unreal_engine.TypedProperty", /* tp_name */
+	sizeof(ue_PyTypedProperty), /* tp_basicsize */
+	0,                         /* tp_itemsize */
+	(destructor)ue_PyTypedProperty_dealloc,       /* tp_dealloc */
+	0,                         /* tp_print */
+	0,                         /* tp_getattr */
+	0,                         /* tp_setattr */
+	0,                         /* tp_reserved */
+	(reprfunc)ue_PyTypedProperty_repr,                         /* tp_repr */
+	0,                         /* tp_as_number */
+	0,                         /* tp_as_sequence */
+	0,                         /* tp_as_mapping */
+	0,                         /* tp_hash  */
+	0,                         /* tp_call */
+	0,                         /* tp_str */
+	0,                         /* tp_getattro */
+	0,                         /* tp_setattro */
+	0,                         /* tp_as_buffer */
+	Py_TPFLAGS_DEFAULT,        /* tp_flags */
+	"Unreal Engine typed property descriptor",           /* tp_doc */
+	0,                         /* tp_traverse */
+	0,                         /* tp_clear */
+	0,                         /* tp_richcompare */
+	0,                         /* tp_weaklistoffset */
+	0,                         /* tp_iter */
+	0,                         /* tp_iternext */
+	0,                         /* tp_methods */
+	0,                         /* tp_members */
+	0,                         /* tp_getset */
+	0,                         /* tp_base */
+	0,                         /* tp_dict */
+	(descrgetfunc)ue_PyTypedProperty_get,                         /* tp_descr_get */
+	(descrsetfunc)ue_PyTypedProperty_set,                         /* tp_descr_set */
+};
+
+static PyObject *ue_PyTypedBoundFunction_call(ue_PyTypedBoundFunction *self, PyObject *args, PyObject *kwargs)
+{
+	ue_py_check(self->py_object);
+
+	ue_PyTypedFunction *descriptor = self->descriptor;
+	UObject *target = self->py_object->ue_object;
+
+	// blueprint (and python) subclasses share the type of their native ancestor, so events overridden
+	// by them must be resolved on the object, like py_ue_call_function() does
+	if (descriptor->function->HasAnyFunctionFlags(FUNC_BlueprintEvent) && target->GetClass() != descriptor->function->GetOwnerClass())
+	{
+		UFunction *function = target->FindFunction(descriptor->function->GetFName());
+		if (function && function != descriptor->function)
+		{
+			return py_ue_ufunction_call(function, target, args, 0, kwargs);
+		}
+	}
+
+	if (!descriptor->plan)
+	{
+		descriptor->plan = new FPythonCallPlan(descriptor->function);
+	}
+
+	return descriptor->plan->Call(target, args, kwargs);
+}
+
+static void ue_PyTypedBoundFunction_dealloc(ue_PyTypedBoundFunction *self)
+{
+	Py_XDECREF(self->descriptor);
+	Py_XDECREF(self->py_object);
+	Py_TYPE(self)->tp_free((PyObject *)self);
+}
+
+static PyTypeObject ue_PyTypedBoundFunctionType = {
+	PyVarObject_HEAD_INIT(NULL, 0)
+	"unreal_engine.TypedBoundFunction", /* tp_name */
+	sizeof(ue_PyTypedBoundFunction), /* tp_basicsize */
+	0,                         /* tp_itemsize */
+	(destructor)ue_PyTypedBoundFunction_dealloc,       /* tp_dealloc */
+	0,                         /* tp_print */
+	0,                         /* tp_getattr */
+	0,                         /* tp_setattr */
+	0,                         /* tp_reserved */
+	0,                         /* tp_repr */
+	0,                         /* tp_as_number */
+	0,                         /* tp_as_sequence */
+	0,                         /* tp_as_mapping */
+	0,                         /* tp_hash  */
+	(ternaryfunc)ue_PyTypedBoundFunction_call,                         /* tp_call */
+	0,                         /* tp_str */
+	0,                         /* tp_getattro */
+	0,                         /* tp_setattro */
+	0,                         /* tp_as_buffer */
+	Py_TPFLAGS_DEFAULT,        /* tp_flags */
+	"Unreal Engine typed bound function",           /* tp_doc */
+};
+
+static PyObject *ue_PyTypedFunction_get(ue_PyTypedFunction *self, PyObject *obj, PyObject *type)
+{
+	if (!obj)
+	{
+		Py_INCREF(self);
+		return (PyObject *)self;
+	}
+
+	ue_PyTypedBoundFunction *ret = (ue_PyTypedBoundFunction *)PyObject_New(ue_PyTypedBoundFunction, &ue_PyTypedBoundFunctionType);
+	Py_INCREF(self);
+	ret->descriptor = self;
+	Py_INCREF(obj);
+	ret->py_object = (ue_PyUObject *)obj;
+	return (PyObject *)ret;
+}
+
+static void ue_PyTypedFunction_dealloc(ue_PyTypedFunction *self)
+{
+	delete self->plan;
+	Py_XDECREF(self->name);
+	Py_TYPE(self)->tp_free((PyObject *)self);
+}
+
+static PyObject *ue_PyTypedFunction_repr(ue_PyTypedFunction *self)
+{
+	return PyUnicode_FromFormat("<unreal_engine function '%U'>", self->name);
+}
+
+static PyTypeObject ue_PyTypedFunctionType = {
+	PyVarObject_HEAD_INIT(NULL, 0)
+	"unreal_engine.TypedFunction", /* tp_name */
+	sizeof(ue_PyTypedFunction), /* tp_basicsize */
+	0,                         /* tp_itemsize */
+	(destructor)ue_PyTypedFunction_dealloc,       /* tp_dealloc */
+	0,                         /* tp_print */
+	0,                         /* tp_getattr */
+	0,                         /* tp_setattr */
+	0,                         /* tp_reserved */
+	(reprfunc)ue_PyTypedFunction_repr,                         /* tp_repr */
+	0,                         /* tp_as_number */
+	0,                         /* tp_as_sequence */
+	0,                         /* tp_as_mapping */
+	0,                         /* tp_hash  */
+	0,                         /* tp_call */
+	0,                         /* tp_str */
+	0,                         /* tp_getattro */
+	0,                         /* tp_setattro */
+	0,                         /* tp_as_buffer */
+	Py_TPFLAGS_DEFAULT,        /* tp_flags */
+	"Unreal Engine typed function descriptor",           /* tp_doc */
+	0,                         /* tp_traverse */
+	0,                         /* tp_clear */
+	0,                         /* tp_richcompare */
+	0,                         /* tp_weaklistoffset */
+	0,                         /* tp_iter */
+	0,                         /* tp_iternext */
+	0,                         /* tp_methods */
+	0,                         /* tp_members */
+	0,                         /* tp_getset */
+	0,                         /* tp_base */
+	0,                         /* tp_dict */
+	(descrgetfunc)ue_PyTypedFunction_get,                         /* tp_descr_get */
+	0,                         /* tp_descr_set */
+};
+
+void ue_python_init_typed_bindings(PyObject *ue_module)
+{
+	if (PyType_Ready(&ue_PyTypedPropertyType) < 0)
+		return;
+
+	if (PyType_Ready(&ue_PyTypedFunctionType) < 0)
+		return;
+
+	if (PyType_Ready(&ue_PyTypedBoundFunctionType) < 0)
+		return;
+}
+
+FPythonTypedBindings &FPythonTypedBindings::Get()
+{
+	static FPythonTypedBindings Singleton;
+	return Singleton;
+}
+
+FPythonTypedBindings::FPythonTypedBindings()
+{
+	bEnabled = false;
+	NumProperties = 0;
+	NumFunctions = 0;
+	BuildTime = 0;
+}
+
+PyTypeObject *FPythonTypedBindings::GetType(UClass *Class)
+{
+	// blueprints and python classes can be recompiled, they use the type of their native ancestor
+	while (Class && !Class->HasAnyClassFlags(CLASS_Native))
+	{
+		Class = Class->GetSuperClass();
+	}
+
+	if (!Class)
+		return ue_get_pyuobject_type();
+
+	if (FClassBinding *Binding = Types.Find(Class))
+	{
+		if (Binding->Class.Get() == Class)
+			return Binding->Type;
+		// a new class at the address of a destroyed one
+		Py_DECREF(Binding->Type);
+		Types.Remove(Class);
+	}
+
+	PyTypeObject *Type = BuildType(Class);
+	if (!Type)
+	{
+		unreal_engine_py_log_error();
+		// do not retry at every wrap
+		Type = ue_get_pyuobject_type();
+		Py_INCREF(Type);
+	}
+
+	FClassBinding Binding;
+	Binding.Class = Class;
+	Binding.Type = Type;
+	Types.Add(Class, Binding);
+
+	return Type;
+}
+
+static bool ue_py_is_valid_identifier(const FString &Name)
+{
+	static const TCHAR *Keywords[] = {
+		TEXT("False"), TEXT("None"), TEXT("True"), TEXT("and"), TEXT("as"), TEXT("assert"), TEXT("async"), TEXT("await"),
+		TEXT("break"), TEXT("class"), TEXT("continue"), TEXT("def"), TEXT("del"), TEXT("elif"), TEXT("else"), TEXT("except"),
+		TEXT("finally"), TEXT("for"), TEXT("from"), TEXT("global"), TEXT("if"), TEXT("import"), TEXT("in"), TEXT("is"),
+		TEXT("lambda"), TEXT("nonlocal"), TEXT("not"), TEXT("or"), TEXT("pass"), TEXT("raise"), TEXT("return"), TEXT("try"),
+		TEXT("while"), TEXT("with"), TEXT("yield")
+	};
+
+	if (Name.IsEmpty() || FChar::IsDigit(Name[0]))
+		return false;
+
+	for (TCHAR Char : Name)
+	{
+		if (!FChar::IsAlnum(Char) && Char != '_')
+			return false;
+	}
+
+	for (const TCHAR *Keyword : Keywords)
+	{
+		if (Name.Equals(Keyword, ESearchCase::CaseSensitive))
+			return false;
+	}
+
+	return true;
+}
+
+PyTypeObject *FPythonTypedBindings::BuildType(UClass *Class)
+{
+	PyTypeObject *Base = Class->GetSuperClass() ? GetType(Class->GetSuperClass()) : ue_get_pyuobject_type();
+
+	const double StartTime = FPlatformTime::Seconds();
+
+	// attributes of unreal_engine.UObject (the api methods) win over reflected ones, like in getattro
+	PyObject *base_dict = ue_get_pyuobject_type()->tp_dict;
+
+	PyObject *py_dict = PyDict_New();
+	PyObject *py_slots = PyTuple_New(0);
+	PyDict_SetItemString(py_dict, "__slots__", py_slots);
+	Py_DECREF(py_slots);
+	PyObject *py_module = PyUnicode_FromString("unreal_engine.typed");
+	PyDict_SetItemString(py_dict, "__module__", py_module);
+	Py_DECREF(py_module);
+
+	for (TFieldIterator<FProperty> It(Class, EFieldIteratorFlags::ExcludeSuper); It; ++It)
+	{
+		FProperty *Property = *It;
+		PyObject *py_name = PyUnicode_FromString(TCHAR_TO_UTF8(*Property->GetName()));
+		if (PyDict_Contains(base_dict, py_name) || PyDict_Contains(py_dict, py_name))
+		{
+			Py_DECREF(py_name);
+			continue;
+		}
+
+		ue_PyTypedProperty *py_property = (ue_PyTypedProperty *)PyObject_New(ue_PyTypedProperty, &ue_PyTypedPropertyType);
+		py_property->property = Property;
+		py_property->name = py_name;
+		PyDict_SetItem(py_dict, py_name, (PyObject *)py_property);
+		Py_DECREF(py_property);
+		NumProperties++;
+	}
+
+	for (TFieldIterator<UFunction> It(Class, EFieldIteratorFlags::ExcludeSuper); It; ++It)
+	{
+		UFunction *Function = *It;
+		const FString Name = Function->GetName();
+		PyObject *py_name = PyUnicode_FromString(TCHAR_TO_UTF8(*Name));
+		if (PyDict_Contains(base_dict, py_name) || PyDict_Contains(py_dict, py_name))
+		{
+			Py_DECREF(py_name);
+			continue;
+		}
+
+		ue_PyTypedFunction *py_function = (ue_PyTypedFunction *)PyObject_New(ue_PyTypedFunction, &ue_PyTypedFunctionType);
+		py_function->function = Function;
+		py_function->plan = nullptr;
+		py_function->name = py_name;
+		PyDict_SetItem(py_dict, py_name, (PyObject *)py_function);
+		NumFunctions++;
+
+		// getattro retries names with the K2_ prefix
+		if (Name.StartsWith(TEXT("K2_")))
+		{
+			const FString Alias = Name.Mid(3);
+			if (!Class->FindPropertyByName(FName(*Alias)) && !Class->FindFunctionByName(FName(*Alias)))
+			{
+				PyObject *py_alias = PyUnicode_FromString(TCHAR_TO_UTF8(*Alias));
+				if (!PyDict_Contains(base_dict, py_alias) && !PyDict_Contains(py_dict, py_alias))
+				{
+					PyDict_SetItem(py_dict, py_alias, (PyObject *)py_function);
+				}
+				Py_DECREF(py_alias);
+			}
+		}
+		Py_DECREF(py_function);
+	}
+
+	PyObject *py_type = PyObject_CallFunction((PyObject *)&PyType_Type, (char *)"s(O)O", TCHAR_TO_UTF8(*Class->GetName()), (PyObject *)Base, py_dict);
+	Py_DECREF(py_dict);
+
+	BuildTime += FPlatformTime::Seconds() - StartTime;
+
+	return (PyTypeObject *)py_type;
+}
+
+FString FPythonTypedBindings::GetStubType(FProperty *Property) const
+{
+	if (Property->IsA<FBoolProperty>())
+		return TEXT("bool");
+
+	if (FNumericProperty *Numeric = CastField<FNumericProperty>(Property))
+		return Numeric->IsFloatingPoint() ? TEXT("float") : TEXT("int");
+
+	if (Property->IsA<FEnumProperty>())
+		return TEXT("int");
+
+	if (Property->IsA<FStrProperty>() || Property->IsA<FNameProperty>() || Property->IsA<FTextProperty>())
+		return TEXT("str");
+
+	if (Property->IsA<FClassProperty>())
+		return TEXT("UObject");
+
+	if (FObjectPropertyBase *Object = CastField<FObjectPropertyBase>(Property))
+	{
+		if (Object->PropertyClass && Object->PropertyClass->HasAnyClassFlags(CLASS_Native))
+			return FString::Printf(TEXT("'%s'"), *Object->PropertyClass->GetName());
+		return TEXT("UObject");
+	}
+
+	if (FStructProperty *Struct = CastField<FStructProperty>(Property))
+	{
+		if (Struct->Struct == TBaseStructure<FVector>::Get())
+			return TEXT("FVector");
+		if (Struct->Struct == TBaseStructure<FVector2D>::Get())
+			return TEXT("FVector2D");
+		if (Struct->Struct == TBaseStructure<FRotator>::Get())
+			return TEXT("FRotator");
+		if (Struct->Struct == TBaseStructure<FTransform>::Get())
+			return TEXT("FTransform");
+		if (Struct->Struct == FHitResult::StaticStruct())
+			return TEXT("FHitResult");
+		if (Struct->Struct == TBaseStructure<FColor>::Get())
+			return TEXT("FColor");
+		if (Struct->Struct == TBaseStructure<FLinearColor>::Get())
+			return TEXT("FLinearColor");
+		return TEXT("UScriptStruct");
+	}
+
+	if (FArrayProperty *Array = CastField<FArrayProperty>(Property))
+	{
+		if (Array->Inner->IsA<FByteProperty>())
+			return TEXT("bytearray");
+		return FString::Printf(TEXT("typing.List[%s]"), *GetStubType(Array->Inner));
+	}
+
+	if (FMapProperty *Map = CastField<FMapProperty>(Property))
+		return FString::Printf(TEXT("typing.Dict[%s, %s]"), *GetStubType(Map->KeyProp), *GetStubType(Map->ValueProp));
+
+	if (FSetProperty *Set = CastField<FSetProperty>(Property))
+		return FString::Printf(TEXT("typing.Set[%s]"), *GetStubType(Set->ElementProp));
+
+	return TEXT("typing.Any");
+}
+
+void FPythonTypedBindings::WriteStub(FString &Stubs, UClass *Class) const
+{
+	UClass *Super = Class->GetSuperClass();
+	Stubs += FString::Printf(TEXT("class %s(%s):\n"), *Class->GetName(), Super ? *Super->GetName() : TEXT("UObject"));
+
+	int32 NumAttributes = 0;
+
+	for (TFieldIterator<FProperty> It(Class, EFieldIteratorFlags::ExcludeSuper); It; ++It)
+	{
+		if (!ue_py_is_valid_identifier(It->GetName()))
+			continue;
+		Stubs += FString::Printf(TEXT("    %s: %s\n"), *It->GetName(), *GetStubType(*It));
+		NumAttributes++;
+	}
+
+	for (TFieldIterator<UFunction> It(Class, EFieldIteratorFlags::ExcludeSuper); It; ++It)
+	{
+		UFunction *Function = *It;
+		if (!ue_py_is_valid_identifier(Function->GetName()))
+			continue;
+
+		FString Params = TEXT("self");
+		FString ReturnType;
+		TArray<FString> OutputTypes;
+		int32 NumInputs = 0;
+		bool bInputs = true;
+		for (TFieldIterator<FProperty> PIt(Function); PIt && PIt->HasAnyPropertyFlags(CPF_Parm); ++PIt)
+		{
+			FProperty *Property = *PIt;
+			if (Property->HasAnyPropertyFlags(CPF_ReturnParm))
+			{
+				ReturnType = GetStubType(Property);
+				bInputs = false;
+				continue;
+			}
+			// missing arguments are zero initialized, so all of them are optional
+			if (bInputs)
+			{
+				const FString Name = ue_py_is_valid_identifier(Property->GetName()) ? Property->GetName() : FString::Printf(TEXT("arg%d"), NumInputs);
+				Params += FString::Printf(TEXT(", %s: %s = ..."), *Name, *GetStubType(Property));
+				NumInputs++;
+			}
+			if (Property->HasAnyPropertyFlags(CPF_OutParm) && (Property->IsA<FArrayProperty>() || !Property->HasAnyPropertyFlags(CPF_ConstParm)))
+			{
+				OutputTypes.Add(GetStubType(Property));
+			}
+		}
+
+		FString Return = ReturnType.IsEmpty() ? TEXT("None") : ReturnType;
+		if (OutputTypes.Num() > 0)
+		{
+			if (!ReturnType.IsEmpty())
+				OutputTypes.Insert(ReturnType, 0);
+			Return = FString::Printf(TEXT("typing.Tuple[%s]"), *FString::Join(OutputTypes, TEXT(", ")));
+		}
+
+		Stubs += FString::Printf(TEXT("    def %s(%s) -> %s: ...\n"), *Function->GetName(), *Params, *Return);
+		NumAttributes++;
+	}
+
+	if (NumAttributes == 0)
+	{
+		Stubs += TEXT("    pass\n");
+	}
+	Stubs += TEXT("\n\n");
+}
+
+void FPythonTypedBindings::GetNativeClasses(TArray<UClass *> &Classes) const
+{
+	for (TObjectIterator<UClass> It; It; ++It)
+	{
+		if (It->HasAnyClassFlags(CLASS_Native) && !It->HasAnyClassFlags(CLASS_NewerVersionExists))
+		{
+			Classes.Add(*It);
+		}
+	}
+}
+
+bool FPythonTypedBindings::SaveStubs(const TArray<UClass *> &Classes, const FString &StubsFilename) const
+{
+	// parents first
+	TSet<UClass *> Written;
+	TArray<UClass *> Chain;
+	FString Stubs = TEXT("import typing\n\nfrom unreal_engine import UObject, UScriptStruct, FVector, FVector2D, FRotator, FTransform, FHitResult, FColor, FLinearColor\n\n\n");
+	for (UClass *Class : Classes)
+	{
+		Chain.Reset();
+		for (UClass *Current = Class; Current && !Written.Contains(Current); Current = Current->GetSuperClass())
+		{
+			Chain.Add(Current);
+		}
+		for (int32 i = Chain.Num() - 1; i >= 0; i--)
+		{
+			Written.Add(Chain[i]);
+			WriteStub(Stubs, Chain[i]);
+		}
+	}
+
+	if (!FFileHelper::SaveStringToFile(Stubs, *StubsFilename, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM))
+	{
+		PyErr_Format(PyExc_Exception, "unable to write %s", TCHAR_TO_UTF8(*StubsFilename));
+		return false;
+	}
+
+	return true;
+}
+
+int32 FPythonTypedBindings::Generate(const FString &StubsFilename)
+{
+	TArray<UClass *> Classes;
+	GetNativeClasses(Classes);
+
+	for (UClass *Class : Classes)
+	{
+		GetType(Class);
+	}
+
+	if (!StubsFilename.IsEmpty() && !SaveStubs(Classes, StubsFilename))
+		return -1;
+
+	return Classes.Num();
+}
+
+int32 FPythonTypedBindings::GenerateStubs(const FString &StubsFilename)
+{
+	// the stubs only need the reflection data, no python type is built
+	TArray<UClass *> Classes;
+	GetNativeClasses(Classes);
+
+	if (!SaveStubs(Classes, StubsFilename))
+		return -1;
+
+	return Classes.Num();
+}
+
+PyObject *FPythonTypedBindings::GetStats()
+{
+	return Py_BuildValue((char *)"{s:O,s:i,s:i,s:i,s:d}",
+		"enabled", bEnabled ? Py_True : Py_False,
+		"classes", Types.Num(),
+		"properties", NumProperties,
+		"functions", NumFunctions,
+		"build_time", BuildTime);
+}
+
+PyObject *py_unreal_engine_generate_typed_bindings(PyObject *self, PyObject *args)
+{
+	char *stubs = nullptr;
+	if (!PyArg_ParseTuple(args, "|z:generate_typed_bindings", &stubs))
+	{
+		return nullptr;
+	}
+
+	int32 Classes = FPythonTypedBindings::Get().Generate(stubs ? FString(UTF8_TO_TCHAR(stubs)) : FString());
+	if (Classes < 0)
+		return nullptr;
+
+	return PyLong_FromLong(Classes);
+}
+
+PyObject *py_unreal_engine_generate_typed_stubs(PyObject *self, PyObject *args)
+{
+	char *stubs;
+	if (!PyArg_ParseTuple(args, "s:generate_typed_stubs", &stubs))
+	{
+		return nullptr;
+	}
+
+	int32 Classes = FPythonTypedBindings::Get().GenerateStubs(FString(UTF8_TO_TCHAR(stubs)));
+	if (Classes < 0)
+		return nullptr;
+
+	return PyLong_FromLong(Classes);
+}
+
+PyObject *py_unreal_engine_typed_bindings_stats(PyObject *self, PyObject *args)
+{
+	return FPythonTypedBindings::Get().GetStats();
+}
+
+PyObject *py_unreal_engine_typed_class(PyObject *self, PyObject *args)
+{
+	PyObject *py_class;
+	if (!PyArg_ParseTuple(args, "O:typed_class", &py_class))
+	{
+		return nullptr;
+	}
+
+	UClass *u_class = ue_py_check_type<UClass>(py_class);
+	if (!u_class)
+		return PyErr_Format(PyExc_Exception, "argument is not a UClass");
+
+	PyObject *ret = (PyObject *)FPythonTypedBindings::Get().GetType(u_class);
+	Py_INCREF(ret);
+	return ret;
+}
+
+#endif
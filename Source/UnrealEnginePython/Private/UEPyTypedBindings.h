@@ -0,0 +1,75 @@
+#pragma once
+
+
+
+#include "UEPyModule.h"
+
+#if ENGINE_MAJOR_VERSION == 5 || (ENGINE_MAJOR_VERSION == 4 && ENGINE_MINOR_VERSION >= 25)
+
+/*
+
+Typed bindings for reflected native classes.
+
+When [Python] TypedBindings is enabled, UObjects are not wrapped as plain unreal_engine.UObject anymore but as
+instances of a per-class subtype (built on the first wrap of an object of that class and cached). The subtype
+holds a descriptor for every property (bound to its FProperty, so reads and writes skip the name lookup) and
+for every function (bound to a call plan with the precomputed parameter list, defaults and out params).
+Non native classes (blueprints, python classes) use the type of their nearest native ancestor, everything not
+covered by the descriptors still goes through the dynamic getattro/setattro lookup.
+
+generate_typed_bindings() builds the types of all of the loaded native classes in a single pass and can write
+the .pyi stubs of the same classes, generate_typed_stubs() writes only the stubs.
+
+All of the methods must be called with the GIL held.
+
+*/
+class FPythonTypedBindings
+{
+public:
+	static FPythonTypedBindings &Get();
+
+	// set from the [Python] TypedBindings setting
+	bool bEnabled;
+
+	// borrowed reference to the type used for wrapping an object of the class
+	PyTypeObject *GetType(UClass *Class);
+
+	// builds all of the native class types, writing their stubs if StubsFilename is not empty
+	// returns the number of classes, -1 with the python error set on failure
+	int32 Generate(const FString &StubsFilename);
+
+	// writes the stubs of all of the native classes from the reflection data only, without building their types
+	// returns the number of classes, -1 with the python error set on failure
+	int32 GenerateStubs(const FString &StubsFilename);
+
+	PyObject *GetStats();
+
+private:
+	FPythonTypedBindings();
+
+	struct FClassBinding
+	{
+		TWeakObjectPtr<UClass> Class;
+		PyTypeObject *Type = nullptr;
+	};
+
+	PyTypeObject *BuildType(UClass *Class);
+	FString GetStubType(FProperty *Property) const;
+	void WriteStub(FString &Stubs, UClass *Class) const;
+	void GetNativeClasses(TArray<UClass *> &Classes) const;
+	bool SaveStubs(const TArray<UClass *> &Classes, const FString &StubsFilename) const;
+
+	TMap<UClass *, FClassBinding> Types;
+	int32 NumProperties;
+	int32 NumFunctions;
+	double BuildTime;
+};
+
+PyObject *py_unreal_engine_generate_typed_bindings(PyObject *, PyObject *);
+PyObject *py_unreal_engine_generate_typed_stubs(PyObject *, PyObject *);
+PyObject *py_unreal_engine_typed_bindings_stats(PyObject *, PyObject *);
+PyObject *py_unreal_engine_typed_class(PyObject *, PyObject *);
+
+void ue_python_init_typed_bindings(PyObject *);
+
+#endif
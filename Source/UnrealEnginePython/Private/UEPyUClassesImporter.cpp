@@ -1,28 +1,38 @@
 #include "UEPyUClassesImporter.h"
 
+#include "UEPyImporterCache.h"
+
 static PyObject *ue_PyUClassesImporter_getattro(ue_PyUClassesImporter *self, PyObject *attr_name)
 {
-	PyObject *py_attr = PyObject_GenericGetAttr((PyObject *)self, attr_name);
-	if (!py_attr)
+	return FPythonImporterCache::Get().GetAttr(EPythonImporter::Classes, (PyObject *)self, attr_name);
+}
+
+static PyObject *ue_PyUClassesImporter_prefetch(ue_PyUClassesImporter *self, PyObject * args)
+{
+	PyObject *py_names;
+	if (!PyArg_ParseTuple(args, "O:prefetch", &py_names))
 	{
-		if (PyUnicodeOrString_Check(attr_name))
-		{
-			const char *attr = UEPyUnicode_AsUTF8(attr_name);
-			if (attr[0] != '_')
-			{
-				UClass *u_class = FindObject<UClass>(ANY_PACKAGE, UTF8_TO_TCHAR(attr));
-				if (u_class)
-				{
-					// swallow old exception
-					PyErr_Clear();
-					Py_RETURN_UOBJECT(u_class);
-				}
-			}
-		}
+		return nullptr;
 	}
-	return py_attr;
+
+	int32 found = FPythonImporterCache::Get().Prefetch(EPythonImporter::Classes, py_names);
+	if (found < 0)
+		return nullptr;
+
+	return PyLong_FromLong(found);
 }
 
+static PyObject *ue_PyUClassesImporter_dir(ue_PyUClassesImporter *self, PyObject * args)
+{
+	return FPythonImporterCache::Get().Dir(EPythonImporter::Classes, (PyObject *)self);
+}
+
+static PyMethodDef ue_PyUClassesImporter_methods[] = {
+	{ "prefetch", (PyCFunction)ue_PyUClassesImporter_prefetch, METH_VARARGS, "" },
+	{ "__dir__", (PyCFunction)ue_PyUClassesImporter_dir, METH_VARARGS, "" },
+	{ NULL }  /* Sentinel */
+};
+
 static PyTypeObject ue_PyUClassesImporterType = {
 	PyVarObject_HEAD_INIT(NULL, 0)
 	"unreal_engine.UClassesImporter", /* tp_name */
@@ -51,7 +61,7 @@ static PyTypeObject ue_PyUClassesImporterType = {
 	0,                         /* tp_weaklistoffset */
 	0,                         /* tp_iter */
 	0,                         /* tp_iternext */
-	0,             /* tp_methods */
+	ue_PyUClassesImporter_methods,             /* tp_methods */
 	0,
 	0,
 };
@@ -59,6 +69,7 @@ static PyTypeObject ue_PyUClassesImporterType = {
 void ue_python_init_uclassesimporter(PyObject *ue_module)
 {
 	ue_PyUClassesImporterType.tp_new = PyType_GenericNew;
+	ue_PyUClassesImporterType.tp_dictoffset = offsetof(ue_PyUClassesImporter, py_dict);
 
 	if (PyType_Ready(&ue_PyUClassesImporterType) < 0)
 		return;
@@ -70,5 +81,7 @@ void ue_python_init_uclassesimporter(PyObject *ue_module)
 PyObject *py_ue_new_uclassesimporter()
 {
 	ue_PyUClassesImporter *ret = (ue_PyUClassesImporter *)PyObject_New(ue_PyUClassesImporter, &ue_PyUClassesImporterType);
+	ret->py_dict = PyDict_New();
+	FPythonImporterCache::Get().Register(EPythonImporter::Classes, ret->py_dict);
 	return (PyObject *)ret;
 }
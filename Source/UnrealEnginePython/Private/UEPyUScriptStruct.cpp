@@ -2,6 +2,50 @@
 
 #include "UEPyUScriptStruct.h"
 
+#include "Wrappers/UEPyFVector2D.h"
+
+#if ENGINE_MAJOR_VERSION == 5 || (ENGINE_MAJOR_VERSION == 4 && ENGINE_MINOR_VERSION >= 25)
+typedef FProperty ue_PyUScriptStructProperty;
+#else
+typedef UProperty ue_PyUScriptStructProperty;
+#endif
+
+// fields with a typed fast path, everything else goes through ue_py_convert_property/ue_py_convert_pyobject
+enum class EPythonStructFieldKind : uint8
+{
+	Generic,
+	Bool,
+	Int32,
+	Float,
+	Double,
+	Vector,
+	Vector2D,
+	Rotator,
+	Transform,
+	Color,
+	LinearColor,
+};
+
+struct FPythonStructField
+{
+	ue_PyUScriptStructProperty *Property;
+	EPythonStructFieldKind Kind;
+};
+
+// per-UScriptStruct attribute name to property map
+struct FPythonStructFieldCache
+{
+	TWeakObjectPtr<UScriptStruct> Struct;
+	// used to detect recompiled (user defined) structs
+	ue_PyUScriptStructProperty *PropertyLink;
+	int32 StructureSize;
+	// interned attribute name -> index in Fields
+	PyObject *Names;
+	TArray<FPythonStructField> Fields;
+};
+
+static TMap<UScriptStruct *, FPythonStructFieldCache> ue_py_uscriptstruct_field_caches;
+
 
 static PyObject *py_ue_uscriptstruct_get_field(ue_PyUScriptStruct *self, PyObject * args)
 {
@@ -238,8 +282,229 @@ UProperty *ue_struct_get_field_from_name(UScriptStruct *u_struct, char *name)
 	return get_field_from_name(u_struct, name);
 }
 
+static EPythonStructFieldKind ue_py_uscriptstruct_field_kind(ue_PyUScriptStructProperty *property)
+{
+#if ENGINE_MAJOR_VERSION == 5 || (ENGINE_MAJOR_VERSION == 4 && ENGINE_MINOR_VERSION >= 25)
+	if (property->ArrayDim != 1)
+		return EPythonStructFieldKind::Generic;
+
+	if (property->IsA<FBoolProperty>())
+		return EPythonStructFieldKind::Bool;
+	if (property->IsA<FIntProperty>())
+		return EPythonStructFieldKind::Int32;
+	if (property->IsA<FFloatProperty>())
+		return EPythonStructFieldKind::Float;
+	if (property->IsA<FDoubleProperty>())
+		return EPythonStructFieldKind::Double;
+
+	if (FStructProperty *struct_property = CastField<FStructProperty>(property))
+	{
+		if (struct_property->Struct == TBaseStructure<FVector>::Get())
+			return EPythonStructFieldKind::Vector;
+		if (struct_property->Struct == TBaseStructure<FVector2D>::Get())
+			return EPythonStructFieldKind::Vector2D;
+		if (struct_property->Struct == TBaseStructure<FRotator>::Get())
+			return EPythonStructFieldKind::Rotator;
+		if (struct_property->Struct == TBaseStructure<FTransform>::Get())
+			return EPythonStructFieldKind::Transform;
+		if (struct_property->Struct == TBaseStructure<FColor>::Get())
+			return EPythonStructFieldKind::Color;
+		if (struct_property->Struct == TBaseStructure<FLinearColor>::Get())
+			return EPythonStructFieldKind::LinearColor;
+	}
+#endif
+	return EPythonStructFieldKind::Generic;
+}
+
+static void ue_py_uscriptstruct_cache_add(FPythonStructFieldCache &cache, PyObject *py_name, ue_PyUScriptStructProperty *property)
+{
+	FPythonStructField field;
+	field.Property = property;
+	field.Kind = ue_py_uscriptstruct_field_kind(property);
+	PyObject *py_index = PyLong_FromLong(cache.Fields.Add(field));
+	PyDict_SetItem(cache.Names, py_name, py_index);
+	Py_DECREF(py_index);
+}
+
+static FPythonStructFieldCache *ue_py_uscriptstruct_get_field_cache(ue_PyUScriptStruct *self)
+{
+	UScriptStruct *u_struct = self->u_struct;
+	FPythonStructFieldCache *cache = ue_py_uscriptstruct_field_caches.Find(u_struct);
+	if (cache)
+	{
+		if (cache->Struct.Get() == u_struct && cache->PropertyLink == u_struct->PropertyLink && cache->StructureSize == u_struct->GetStructureSize())
+			return cache;
+		// the struct has been recompiled or its address reused, rebuild
+		Py_CLEAR(cache->Names);
+		cache->Fields.Reset();
+	}
+	else
+	{
+		cache = &ue_py_uscriptstruct_field_caches.Add(u_struct);
+	}
+
+	cache->Struct = u_struct;
+	cache->PropertyLink = u_struct->PropertyLink;
+	cache->StructureSize = u_struct->GetStructureSize();
+	cache->Names = PyDict_New();
+
+	for (TFieldIterator<ue_PyUScriptStructProperty> prop(u_struct); prop; ++prop)
+	{
+		PyObject *py_name = PyUnicode_InternFromString(TCHAR_TO_UTF8(*prop->GetName()));
+		// methods and type attributes keep their precedence, those names are resolved by the slow path
+		if (!py_name || PyDict_Contains(cache->Names, py_name) || PyObject_HasAttr((PyObject *)Py_TYPE(self), py_name))
+		{
+			Py_XDECREF(py_name);
+			PyErr_Clear();
+			continue;
+		}
+		ue_py_uscriptstruct_cache_add(*cache, py_name, *prop);
+		Py_DECREF(py_name);
+	}
+
+	return cache;
+}
+
+static FPythonStructField *ue_py_uscriptstruct_find_cached_field(ue_PyUScriptStruct *self, PyObject *attr_name)
+{
+	if (!PyUnicode_CheckExact(attr_name))
+		return nullptr;
+	FPythonStructFieldCache *cache = ue_py_uscriptstruct_get_field_cache(self);
+	// borrowed reference, no exception is raised on missing keys
+	PyObject *py_index = PyDict_GetItem(cache->Names, attr_name);
+	if (!py_index)
+		return nullptr;
+	return &cache->Fields[PyLong_AsLong(py_index)];
+}
+
+static PyObject *ue_py_uscriptstruct_get_cached_field(ue_PyUScriptStruct *self, FPythonStructField *field)
+{
+	uint8 *ptr = self->u_struct_ptr;
+#if ENGINE_MAJOR_VERSION == 5 || (ENGINE_MAJOR_VERSION == 4 && ENGINE_MINOR_VERSION >= 25)
+	FProperty *property = field->Property;
+	switch (field->Kind)
+	{
+	case EPythonStructFieldKind::Bool:
+		return PyBool_FromLong(((FBoolProperty *)property)->GetPropertyValue_InContainer(ptr));
+	case EPythonStructFieldKind::Int32:
+		return PyLong_FromLong(*property->ContainerPtrToValuePtr<int32>(ptr));
+	case EPythonStructFieldKind::Float:
+		return PyFloat_FromDouble(*property->ContainerPtrToValuePtr<float>(ptr));
+	case EPythonStructFieldKind::Double:
+		return PyFloat_FromDouble(*property->ContainerPtrToValuePtr<double>(ptr));
+	case EPythonStructFieldKind::Vector:
+		return py_ue_new_fvector(*property->ContainerPtrToValuePtr<FVector>(ptr));
+	case EPythonStructFieldKind::Vector2D:
+		return py_ue_new_fvector2d(*property->ContainerPtrToValuePtr<FVector2D>(ptr));
+	case EPythonStructFieldKind::Rotator:
+		return py_ue_new_frotator(*property->ContainerPtrToValuePtr<FRotator>(ptr));
+	case EPythonStructFieldKind::Transform:
+		return py_ue_new_ftransform(*property->ContainerPtrToValuePtr<FTransform>(ptr));
+	case EPythonStructFieldKind::Color:
+		return py_ue_new_fcolor(*property->ContainerPtrToValuePtr<FColor>(ptr));
+	case EPythonStructFieldKind::LinearColor:
+		return py_ue_new_flinearcolor(*property->ContainerPtrToValuePtr<FLinearColor>(ptr));
+	default:
+		break;
+	}
+#endif
+	return ue_py_convert_property(field->Property, ptr, 0);
+}
+
+// returns false if the value requires the generic conversion
+static bool ue_py_uscriptstruct_set_cached_field(ue_PyUScriptStruct *self, FPythonStructField *field, PyObject *value)
+{
+#if ENGINE_MAJOR_VERSION == 5 || (ENGINE_MAJOR_VERSION == 4 && ENGINE_MINOR_VERSION >= 25)
+	uint8 *ptr = self->u_struct_ptr;
+	FProperty *property = field->Property;
+	switch (field->Kind)
+	{
+	case EPythonStructFieldKind::Bool:
+		if (!PyBool_Check(value))
+			return false;
+		((FBoolProperty *)property)->SetPropertyValue_InContainer(ptr, value == Py_True);
+		return true;
+	case EPythonStructFieldKind::Int32:
+	{
+		if (!PyLong_CheckExact(value))
+			return false;
+		long int_value = PyLong_AsLong(value);
+		if (int_value == -1 && PyErr_Occurred())
+		{
+			PyErr_Clear();
+			return false;
+		}
+		*property->ContainerPtrToValuePtr<int32>(ptr) = (int32)int_value;
+		return true;
+	}
+	case EPythonStructFieldKind::Float:
+		if (!PyFloat_CheckExact(value))
+			return false;
+		*property->ContainerPtrToValuePtr<float>(ptr) = (float)PyFloat_AS_DOUBLE(value);
+		return true;
+	case EPythonStructFieldKind::Double:
+		if (!PyFloat_CheckExact(value))
+			return false;
+		*property->ContainerPtrToValuePtr<double>(ptr) = PyFloat_AS_DOUBLE(value);
+		return true;
+	case EPythonStructFieldKind::Vector:
+		if (ue_PyFVector *py_vec = py_ue_is_fvector(value))
+		{
+			*property->ContainerPtrToValuePtr<FVector>(ptr) = py_vec->vec;
+			return true;
+		}
+		return false;
+	case EPythonStructFieldKind::Vector2D:
+		if (ue_PyFVector2D *py_vec = py_ue_is_fvector2d(value))
+		{
+			*property->ContainerPtrToValuePtr<FVector2D>(ptr) = py_vec->vec;
+			return true;
+		}
+		return false;
+	case EPythonStructFieldKind::Rotator:
+		if (ue_PyFRotator *py_rot = py_ue_is_frotator(value))
+		{
+			*property->ContainerPtrToValuePtr<FRotator>(ptr) = py_rot->rot;
+			return true;
+		}
+		return false;
+	case EPythonStructFieldKind::Transform:
+		if (ue_PyFTransform *py_transform = py_ue_is_ftransform(value))
+		{
+			*property->ContainerPtrToValuePtr<FTransform>(ptr) = py_transform->transform;
+			return true;
+		}
+		return false;
+	case EPythonStructFieldKind::Color:
+		if (ue_PyFColor *py_color = py_ue_is_fcolor(value))
+		{
+			*property->ContainerPtrToValuePtr<FColor>(ptr) = py_color->color;
+			return true;
+		}
+		return false;
+	case EPythonStructFieldKind::LinearColor:
+		if (ue_PyFLinearColor *py_color = py_ue_is_flinearcolor(value))
+		{
+			*property->ContainerPtrToValuePtr<FLinearColor>(ptr) = py_color->color;
+			return true;
+		}
+		return false;
+	default:
+		break;
+	}
+#endif
+	return false;
+}
+
 static PyObject *ue_PyUScriptStruct_getattro(ue_PyUScriptStruct *self, PyObject *attr_name)
 {
+	// cached fields never collide with type attributes, so they can be resolved before the generic lookup
+	FPythonStructField *field = ue_py_uscriptstruct_find_cached_field(self, attr_name);
+	if (field)
+	{
+		return ue_py_uscriptstruct_get_cached_field(self, field);
+	}
+
 	PyObject *ret = PyObject_GenericGetAttr((PyObject *)self, attr_name);
 	if (!ret)
 	{
@@ -253,6 +518,11 @@ static PyObject *ue_PyUScriptStruct_getattro(ue_PyUScriptStruct *self, PyObject
 			{
 				// swallow previous exception
 				PyErr_Clear();
+				// DisplayName aliases are cached on first use
+				if (PyUnicode_CheckExact(attr_name))
+				{
+					ue_py_uscriptstruct_cache_add(*ue_py_uscriptstruct_get_field_cache(self), attr_name, f_property);
+				}
 				return ue_py_convert_property(f_property, self->u_struct_ptr, 0);
 			}
 #else
@@ -261,6 +531,11 @@ static PyObject *ue_PyUScriptStruct_getattro(ue_PyUScriptStruct *self, PyObject
 			{
 				// swallow previous exception
 				PyErr_Clear();
+				// DisplayName aliases are cached on first use
+				if (PyUnicode_CheckExact(attr_name))
+				{
+					ue_py_uscriptstruct_cache_add(*ue_py_uscriptstruct_get_field_cache(self), attr_name, u_property);
+				}
 				return ue_py_convert_property(u_property, self->u_struct_ptr, 0);
 			}
 #endif
@@ -271,6 +546,17 @@ static PyObject *ue_PyUScriptStruct_getattro(ue_PyUScriptStruct *self, PyObject
 
 static int ue_PyUScriptStruct_setattro(ue_PyUScriptStruct *self, PyObject *attr_name, PyObject *value)
 {
+	FPythonStructField *field = value ? ue_py_uscriptstruct_find_cached_field(self, attr_name) : nullptr;
+	if (field)
+	{
+		if (ue_py_uscriptstruct_set_cached_field(self, field, value) || ue_py_convert_pyobject(value, field->Property, self->u_struct_ptr, 0))
+		{
+			return 0;
+		}
+		PyErr_Format(PyExc_ValueError, "invalid value for property %s", TCHAR_TO_UTF8(*field->Property->GetName()));
+		return -1;
+	}
+
 	// first of all check for Property (FProperty or UProperty)
 	if (PyUnicodeOrString_Check(attr_name))
 	{
@@ -305,16 +591,62 @@ static int ue_PyUScriptStruct_setattro(ue_PyUScriptStruct *self, PyObject *attr_
 
 
 
+// small structs live in u_struct_inline_data, bigger ones get their own allocation
+static uint8 *ue_py_uscriptstruct_alloc(ue_PyUScriptStruct *self, UScriptStruct *u_struct)
+{
+	self->u_struct = u_struct;
+	self->u_struct_owned = 1;
+	self->u_struct_weak = FWeakObjectPtr(u_struct);
+	if (u_struct->GetStructureSize() <= UEPY_USCRIPTSTRUCT_INLINE_SIZE && u_struct->GetMinAlignment() <= UEPY_USCRIPTSTRUCT_INLINE_ALIGNMENT &&
+		IsAligned(self->u_struct_inline_data, u_struct->GetMinAlignment()))
+	{
+		self->u_struct_inline = 1;
+		self->u_struct_ptr = self->u_struct_inline_data;
+	}
+	else
+	{
+		self->u_struct_inline = 0;
+		self->u_struct_ptr = (uint8 *)FMemory::Malloc(u_struct->GetStructureSize(), u_struct->GetMinAlignment());
+	}
+	return self->u_struct_ptr;
+}
+
+static void ue_py_uscriptstruct_release(ue_PyUScriptStruct *self)
+{
+	if (self->u_struct_owned)
+	{
+		// the UScriptStruct could have been garbage collected (e.g. a user defined struct that has been deleted or recompiled)
+		if (self->u_struct_weak.IsValid(true))
+		{
+			self->u_struct->DestroyStruct(self->u_struct_ptr);
+		}
+		if (!self->u_struct_inline)
+		{
+			FMemory::Free(self->u_struct_ptr);
+		}
+	}
+	self->u_struct_ptr = nullptr;
+	self->u_struct_owned = 0;
+	self->u_struct_inline = 0;
+	self->u_struct_weak.Reset();
+}
+
+static void ue_py_uscriptstruct_init_default(ue_PyUScriptStruct *self, UScriptStruct *u_struct)
+{
+	uint8 *struct_data = ue_py_uscriptstruct_alloc(self, u_struct);
+	u_struct->InitializeStruct(struct_data);
+#if WITH_EDITOR
+	u_struct->InitializeDefaultValue(struct_data);
+#endif
+}
+
 // destructor
 static void ue_PyUScriptStruct_dealloc(ue_PyUScriptStruct *self)
 {
 #if defined(UEPY_MEMORY_DEBUG)
 	UE_LOG(LogPython, Warning, TEXT("Destroying ue_PyUScriptStruct %p with size %d"), self, self->u_struct->GetStructureSize());
 #endif
-	if (self->u_struct_owned)
-	{
-		FMemory::Free(self->u_struct_ptr);
-	}
+	ue_py_uscriptstruct_release(self);
 	Py_TYPE(self)->tp_free((PyObject *)self);
 }
 
@@ -370,13 +702,9 @@ static int ue_py_uscriptstruct_init(ue_PyUScriptStruct *self, PyObject *args, Py
 		return -1;
 	}
 
-	self->u_struct = (UScriptStruct *)py_u_obj->ue_object;
-	self->u_struct_ptr = (uint8*)FMemory::Malloc(self->u_struct->GetStructureSize());
-	self->u_struct->InitializeStruct(self->u_struct_ptr);
-#if WITH_EDITOR
-	self->u_struct->InitializeDefaultValue(self->u_struct_ptr);
-#endif
-	self->u_struct_owned = 1;
+	// __init__ can be called again on a live object
+	ue_py_uscriptstruct_release(self);
+	ue_py_uscriptstruct_init_default(self, (UScriptStruct *)py_u_obj->ue_object);
 	return 0;
 }
 
@@ -438,18 +766,17 @@ PyObject *py_ue_new_uscriptstruct(UScriptStruct *u_struct, uint8 *data)
 	ret->u_struct = u_struct;
 	ret->u_struct_ptr = data;
 	ret->u_struct_owned = 0;
+	ret->u_struct_inline = 0;
+	ret->u_struct_weak.Reset();
 	return (PyObject *)ret;
 }
 
 PyObject *py_ue_new_owned_uscriptstruct(UScriptStruct *u_struct, uint8 *data)
 {
 	ue_PyUScriptStruct *ret = (ue_PyUScriptStruct *)PyObject_New(ue_PyUScriptStruct, &ue_PyUScriptStructType);
-	ret->u_struct = u_struct;
-	uint8 *struct_data = (uint8*)FMemory::Malloc(u_struct->GetStructureSize());
-	ret->u_struct->InitializeStruct(struct_data);
-	ret->u_struct->CopyScriptStruct(struct_data, data);
-	ret->u_struct_ptr = struct_data;
-	ret->u_struct_owned = 1;
+	uint8 *struct_data = ue_py_uscriptstruct_alloc(ret, u_struct);
+	u_struct->InitializeStruct(struct_data);
+	u_struct->CopyScriptStruct(struct_data, data);
 	return (PyObject *)ret;
 }
 
@@ -459,21 +786,23 @@ PyObject *py_ue_new_owned_uscriptstruct_zero_copy(UScriptStruct *u_struct, uint8
 	ret->u_struct = u_struct;
 	ret->u_struct_ptr = data;
 	ret->u_struct_owned = 1;
+	ret->u_struct_inline = 0;
+	ret->u_struct_weak = FWeakObjectPtr(u_struct);
 	return (PyObject *)ret;
 }
 
-static PyObject *py_ue_uscriptstruct_clone(ue_PyUScriptStruct *self, PyObject * args)
+PyObject *py_ue_new_owned_uscriptstruct_default(UScriptStruct *u_struct)
 {
 	ue_PyUScriptStruct *ret = (ue_PyUScriptStruct *)PyObject_New(ue_PyUScriptStruct, &ue_PyUScriptStructType);
-	ret->u_struct = self->u_struct;
-	uint8 *struct_data = (uint8*)FMemory::Malloc(self->u_struct->GetStructureSize());
-	ret->u_struct->InitializeStruct(struct_data);
-	ret->u_struct->CopyScriptStruct(struct_data, self->u_struct_ptr);
-	ret->u_struct_ptr = struct_data;
-	ret->u_struct_owned = 1;
+	ue_py_uscriptstruct_init_default(ret, u_struct);
 	return (PyObject *)ret;
 }
 
+static PyObject *py_ue_uscriptstruct_clone(ue_PyUScriptStruct *self, PyObject * args)
+{
+	return py_ue_new_owned_uscriptstruct(self->u_struct, self->u_struct_ptr);
+}
+
 ue_PyUScriptStruct *py_ue_is_uscriptstruct(PyObject *obj)
 {
 	if (!PyObject_IsInstance(obj, (PyObject *)&ue_PyUScriptStructType))
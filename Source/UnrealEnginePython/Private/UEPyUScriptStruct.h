@@ -2,6 +2,15 @@
 
 #include "UEPyModule.h"
 
+// owned structs up to this size are stored inside the python object itself instead of a separate allocation
+#define UEPY_USCRIPTSTRUCT_INLINE_SIZE 128
+// python objects are only guaranteed this alignment (pymalloc uses 16 bytes since 3.8), more aligned structs are never stored inline
+#if PY_VERSION_HEX >= 0x03080000
+#define UEPY_USCRIPTSTRUCT_INLINE_ALIGNMENT 16
+#else
+#define UEPY_USCRIPTSTRUCT_INLINE_ALIGNMENT 8
+#endif
+
 typedef struct
 {
 	PyObject_HEAD
@@ -10,11 +19,19 @@ typedef struct
 	uint8 *u_struct_ptr;
 	// if set, the struct is responsible for freeing memory
 	int u_struct_owned;
+	// if set, u_struct_ptr points to u_struct_inline_data
+	int u_struct_inline;
+	// owned structs are destroyed only if their UScriptStruct still exists
+	FWeakObjectPtr u_struct_weak;
+	alignas(UEPY_USCRIPTSTRUCT_INLINE_ALIGNMENT) uint8 u_struct_inline_data[UEPY_USCRIPTSTRUCT_INLINE_SIZE];
 } ue_PyUScriptStruct;
 
 PyObject *py_ue_new_uscriptstruct(UScriptStruct *, uint8 *);
 PyObject *py_ue_new_owned_uscriptstruct(UScriptStruct *, uint8 *);
+// data must be initialized and allocated with FMemory::Malloc, the new object takes ownership of it
 PyObject *py_ue_new_owned_uscriptstruct_zero_copy(UScriptStruct *, uint8 *);
+// new owned struct initialized with its default values
+PyObject *py_ue_new_owned_uscriptstruct_default(UScriptStruct *);
 ue_PyUScriptStruct *py_ue_is_uscriptstruct(PyObject *);
 
 #if ENGINE_MAJOR_VERSION == 5 || (ENGINE_MAJOR_VERSION == 4 && ENGINE_MINOR_VERSION >= 25)
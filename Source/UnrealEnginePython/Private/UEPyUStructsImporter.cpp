@@ -1,28 +1,38 @@
 #include "UEPyUStructsImporter.h"
 
+#include "UEPyImporterCache.h"
+
 static PyObject *ue_PyUStructsImporter_getattro(ue_PyUStructsImporter *self, PyObject *attr_name)
 {
-	PyObject *py_attr = PyObject_GenericGetAttr((PyObject *)self, attr_name);
-	if (!py_attr)
+	return FPythonImporterCache::Get().GetAttr(EPythonImporter::Structs, (PyObject *)self, attr_name);
+}
+
+static PyObject *ue_PyUStructsImporter_prefetch(ue_PyUStructsImporter *self, PyObject * args)
+{
+	PyObject *py_names;
+	if (!PyArg_ParseTuple(args, "O:prefetch", &py_names))
 	{
-		if (PyUnicodeOrString_Check(attr_name))
-		{
-			const char *attr = UEPyUnicode_AsUTF8(attr_name);
-			if (attr[0] != '_')
-			{
-				UScriptStruct *u_struct = FindObject<UScriptStruct>(ANY_PACKAGE, UTF8_TO_TCHAR(attr));
-				if (u_struct)
-				{
-					// swallow old exception
-					PyErr_Clear();
-					Py_RETURN_UOBJECT(u_struct);
-				}
-			}
-		}
+		return nullptr;
 	}
-	return py_attr;
+
+	int32 found = FPythonImporterCache::Get().Prefetch(EPythonImporter::Structs, py_names);
+	if (found < 0)
+		return nullptr;
+
+	return PyLong_FromLong(found);
 }
 
+static PyObject *ue_PyUStructsImporter_dir(ue_PyUStructsImporter *self, PyObject * args)
+{
+	return FPythonImporterCache::Get().Dir(EPythonImporter::Structs, (PyObject *)self);
+}
+
+static PyMethodDef ue_PyUStructsImporter_methods[] = {
+	{ "prefetch", (PyCFunction)ue_PyUStructsImporter_prefetch, METH_VARARGS, "" },
+	{ "__dir__", (PyCFunction)ue_PyUStructsImporter_dir, METH_VARARGS, "" },
+	{ NULL }  /* Sentinel */
+};
+
 static PyTypeObject ue_PyUStructsImporterType = {
 	PyVarObject_HEAD_INIT(NULL, 0)
 	"unreal_engine.UStructsImporter", /* tp_name */
@@ -51,7 +61,7 @@ static PyTypeObject ue_PyUStructsImporterType = {
 	0,                         /* tp_weaklistoffset */
 	0,                         /* tp_iter */
 	0,                         /* tp_iternext */
-	0,             /* tp_methods */
+	ue_PyUStructsImporter_methods,             /* tp_methods */
 	0,
 	0,
 };
@@ -59,6 +69,7 @@ static PyTypeObject ue_PyUStructsImporterType = {
 void ue_python_init_ustructsimporter(PyObject *ue_module)
 {
 	ue_PyUStructsImporterType.tp_new = PyType_GenericNew;
+	ue_PyUStructsImporterType.tp_dictoffset = offsetof(ue_PyUStructsImporter, py_dict);
 
 	if (PyType_Ready(&ue_PyUStructsImporterType) < 0)
 		return;
@@ -70,5 +81,7 @@ void ue_python_init_ustructsimporter(PyObject *ue_module)
 PyObject *py_ue_new_ustructsimporter()
 {
 	ue_PyUStructsImporter *ret = (ue_PyUStructsImporter *)PyObject_New(ue_PyUStructsImporter, &ue_PyUStructsImporterType);
+	ret->py_dict = PyDict_New();
+	FPythonImporterCache::Get().Register(EPythonImporter::Structs, ret->py_dict);
 	return (PyObject *)ret;
 }
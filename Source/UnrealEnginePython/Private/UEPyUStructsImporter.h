@@ -8,6 +8,8 @@ typedef struct
 {
 	PyObject_HEAD
 		/* Type-specific fields go here. */
+	// resolved objects, see FPythonImporterCache
+	PyObject *py_dict;
 } ue_PyUStructsImporter;
 
 PyObject *py_ue_new_ustructsimporter();
@@ -0,0 +1,423 @@
+// Copyright 20Tab S.r.l.
+
+#include "UEPyViewportCapture.h"
+#include "UEPyEngine.h"
+
+#include "Runtime/Core/Public/Containers/Ticker.h"
+#include "Runtime/Core/Public/Async/Async.h"
+#include "Runtime/Core/Public/HAL/ThreadSafeCounter64.h"
+#include "Runtime/Core/Public/Misc/FileHelper.h"
+#include "Runtime/Core/Public/Misc/Paths.h"
+#include "Runtime/Core/Public/Modules/ModuleManager.h"
+#include "Runtime/Engine/Public/ImageUtils.h"
+#include "Runtime/Engine/Classes/Engine/GameViewportClient.h"
+#if WITH_EDITOR
+#include "Editor.h"
+#endif
+
+/*
+
+Continuous viewport capture: frames are read back on the game thread by a core ticker,
+converted/encoded on the thread pool and stored in a fixed size ring that python drains
+with viewport_capture_pop(). When the ring is full the oldest frame is dropped.
+
+*/
+
+enum class EPythonViewportCaptureSource
+{
+	Game,
+	Editor,
+	PIE,
+};
+
+enum class EPythonViewportCaptureEncode
+{
+	None,
+	Raw,
+	PNG,
+};
+
+struct FPythonViewportCaptureFrame
+{
+	int64 Index = 0;
+	double Time = 0;
+	FIntPoint Size = FIntPoint::ZeroValue;
+#if ENGINE_MAJOR_VERSION == 5 || (ENGINE_MAJOR_VERSION == 4 && ENGINE_MINOR_VERSION >= 25)
+	TArray64<uint8> Data;
+#else
+	TArray<uint8> Data;
+#endif
+	FString Filename;
+};
+
+class FPythonViewportCapture : public TSharedFromThis<FPythonViewportCapture, ESPMode::ThreadSafe>
+{
+public:
+	EPythonViewportCaptureSource Source = EPythonViewportCaptureSource::Game;
+	EPythonViewportPixelFormat Format = EPythonViewportPixelFormat::RGBA8;
+	EPythonViewportCaptureEncode Encode = EPythonViewportCaptureEncode::None;
+	FString OutputDir;
+	int32 RingSize = 8;
+	float Interval = 0;
+	int64 MaxFrames = 0;
+
+	void Start()
+	{
+		Ring.SetNum(RingSize);
+		StartTime = FPlatformTime::Seconds();
+		bRunning = true;
+#if ENGINE_MAJOR_VERSION == 5
+		TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateSP(this, &FPythonViewportCapture::Tick), 0);
+#else
+		TickerHandle = FTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateSP(this, &FPythonViewportCapture::Tick), 0);
+#endif
+	}
+
+	void Stop()
+	{
+		if (TickerHandle.IsValid())
+		{
+#if ENGINE_MAJOR_VERSION == 5
+			FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+#else
+			FTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+#endif
+			TickerHandle.Reset();
+		}
+		bRunning = false;
+	}
+
+	// must be called without the GIL, workers never touch python
+	void WaitForPending()
+	{
+		while (Pending.GetValue() > 0)
+		{
+			FPlatformProcess::Sleep(0.001f);
+		}
+	}
+
+	bool Pop(FPythonViewportCaptureFrame &frame)
+	{
+		FScopeLock lock(&RingLock);
+		if (RingCount == 0)
+			return false;
+		frame = MoveTemp(Ring[RingHead]);
+		RingHead = (RingHead + 1) % RingSize;
+		RingCount--;
+		Popped++;
+		return true;
+	}
+
+	PyObject *GetStats()
+	{
+		int32 queued;
+		{
+			FScopeLock lock(&RingLock);
+			queued = RingCount;
+		}
+
+		PyObject *py_dict = PyDict_New();
+		PyObject *py_running = bRunning ? Py_True : Py_False;
+		PyDict_SetItemString(py_dict, "running", py_running);
+
+		auto set_int = [py_dict](const char *key, int64 value)
+		{
+			PyObject *py_value = PyLong_FromLongLong(value);
+			PyDict_SetItemString(py_dict, key, py_value);
+			Py_DECREF(py_value);
+		};
+
+		set_int("captured", Captured);
+		set_int("dropped", Dropped.GetValue());
+		set_int("encoded", Encoded.GetValue());
+		set_int("failed", Failed.GetValue());
+		set_int("pending", Pending.GetValue());
+		set_int("queued", queued);
+		set_int("popped", Popped);
+		return py_dict;
+	}
+
+private:
+	FViewport *GetViewport() const
+	{
+		switch (Source)
+		{
+#if WITH_EDITOR
+		case EPythonViewportCaptureSource::Editor:
+			return GEditor ? GEditor->GetActiveViewport() : nullptr;
+		case EPythonViewportCaptureSource::PIE:
+			return GEditor ? GEditor->GetPIEViewport() : nullptr;
+#endif
+		default:
+			return GEngine->GameViewport ? GEngine->GameViewport->Viewport : nullptr;
+		}
+	}
+
+	bool Tick(float DeltaTime)
+	{
+		Elapsed += DeltaTime;
+		if (Elapsed < Interval)
+			return true;
+		Elapsed = 0;
+
+		// back pressure: never keep more frames in flight than the ring can hold
+		if (Pending.GetValue() >= RingSize)
+		{
+			Dropped.Increment();
+			return true;
+		}
+
+		FViewport *viewport = GetViewport();
+		if (!viewport)
+			return true;
+
+		TSharedRef<FPythonViewportPixels, ESPMode::ThreadSafe> pixels = MakeShared<FPythonViewportPixels, ESPMode::ThreadSafe>();
+		if (!pixels->Read(viewport, Format))
+		{
+			Failed.Increment();
+			return true;
+		}
+
+		const int64 index = Captured++;
+		const double time = FPlatformTime::Seconds() - StartTime;
+
+		Pending.Increment();
+		TSharedRef<FPythonViewportCapture, ESPMode::ThreadSafe> self = AsShared();
+		Async(EAsyncExecution::ThreadPool, [self, pixels, index, time]()
+		{
+			self->Process(*pixels, index, time);
+			self->Pending.Decrement();
+		});
+
+		if (MaxFrames > 0 && Captured >= MaxFrames)
+		{
+			// returning false unregisters the ticker
+			TickerHandle.Reset();
+			bRunning = false;
+			return false;
+		}
+
+		return true;
+	}
+
+	void Process(const FPythonViewportPixels &pixels, int64 index, double time)
+	{
+		FPythonViewportCaptureFrame frame;
+		frame.Index = index;
+		frame.Time = time;
+		frame.Size = pixels.Size;
+
+		if (Encode == EPythonViewportCaptureEncode::PNG)
+		{
+#if ENGINE_MAJOR_VERSION == 5 || (ENGINE_MAJOR_VERSION == 4 && ENGINE_MINOR_VERSION >= 25)
+			FImageUtils::PNGCompressImageArray(pixels.Size.X, pixels.Size.Y, TArrayView64<const FColor>(pixels.Colors.GetData(), pixels.Colors.Num()), frame.Data);
+#else
+			FImageUtils::CompressImageArray(pixels.Size.X, pixels.Size.Y, pixels.Colors, frame.Data);
+#endif
+			if (frame.Data.Num() == 0)
+			{
+				Failed.Increment();
+				return;
+			}
+		}
+		else
+		{
+			frame.Data.SetNumUninitialized(pixels.GetNumBytes());
+			pixels.CopyTo(frame.Data.GetData());
+		}
+
+		if (Encode != EPythonViewportCaptureEncode::None)
+		{
+			if (!OutputDir.IsEmpty())
+			{
+				FString filename = FPaths::Combine(OutputDir, FString::Printf(TEXT("frame_%06lld.%s"), index, Encode == EPythonViewportCaptureEncode::PNG ? TEXT("png") : TEXT("raw")));
+				if (!FFileHelper::SaveArrayToFile(frame.Data, *filename))
+				{
+					Failed.Increment();
+					return;
+				}
+				frame.Filename = filename;
+				frame.Data.Empty();
+			}
+			Encoded.Increment();
+		}
+
+		Push(MoveTemp(frame));
+	}
+
+	void Push(FPythonViewportCaptureFrame &&frame)
+	{
+		FScopeLock lock(&RingLock);
+		if (RingCount == RingSize)
+		{
+			RingHead = (RingHead + 1) % RingSize;
+			RingCount--;
+			Dropped.Increment();
+		}
+		Ring[(RingHead + RingCount) % RingSize] = MoveTemp(frame);
+		RingCount++;
+	}
+
+#if ENGINE_MAJOR_VERSION == 5
+	FTSTicker::FDelegateHandle TickerHandle;
+#else
+	FDelegateHandle TickerHandle;
+#endif
+	bool bRunning = false;
+	float Elapsed = 0;
+	double StartTime = 0;
+	// only accessed by the game thread
+	int64 Captured = 0;
+	int64 Popped = 0;
+
+	FThreadSafeCounter64 Dropped;
+	FThreadSafeCounter64 Encoded;
+	FThreadSafeCounter64 Failed;
+	FThreadSafeCounter64 Pending;
+
+	FCriticalSection RingLock;
+	TArray<FPythonViewportCaptureFrame> Ring;
+	int32 RingHead = 0;
+	int32 RingCount = 0;
+};
+
+static TSharedPtr<FPythonViewportCapture, ESPMode::ThreadSafe> GPythonViewportCapture;
+
+static void ue_py_viewport_capture_shutdown()
+{
+	if (!GPythonViewportCapture.IsValid())
+		return;
+
+	GPythonViewportCapture->Stop();
+	Py_BEGIN_ALLOW_THREADS;
+	GPythonViewportCapture->WaitForPending();
+	Py_END_ALLOW_THREADS;
+}
+
+void ue_py_viewport_capture_stop_all()
+{
+	if (!GPythonViewportCapture.IsValid())
+		return;
+
+	// the workers never touch python, so there is no need for the GIL here
+	GPythonViewportCapture->Stop();
+	GPythonViewportCapture->WaitForPending();
+	GPythonViewportCapture.Reset();
+}
+
+PyObject *py_unreal_engine_viewport_capture_start(PyObject *self, PyObject * args, PyObject *kwargs)
+{
+	char *source_name = (char *)"game";
+	int ring_size = 8;
+	float interval = 0;
+	char *format_name = (char *)"rgba8";
+	char *encode_name = nullptr;
+	char *output_dir = nullptr;
+	long long max_frames = 0;
+
+	static char *kw_names[] = { (char *)"viewport", (char *)"ring_size", (char *)"interval", (char *)"format", (char *)"encode", (char *)"output_dir", (char *)"max_frames", nullptr };
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "|sifszzL:viewport_capture_start", kw_names, &source_name, &ring_size, &interval, &format_name, &encode_name, &output_dir, &max_frames))
+	{
+		return nullptr;
+	}
+
+	TSharedRef<FPythonViewportCapture, ESPMode::ThreadSafe> capture = MakeShared<FPythonViewportCapture, ESPMode::ThreadSafe>();
+
+	if (!FCStringAnsi::Stricmp(source_name, "game"))
+		capture->Source = EPythonViewportCaptureSource::Game;
+#if WITH_EDITOR
+	else if (!FCStringAnsi::Stricmp(source_name, "editor"))
+		capture->Source = EPythonViewportCaptureSource::Editor;
+	else if (!FCStringAnsi::Stricmp(source_name, "pie"))
+		capture->Source = EPythonViewportCaptureSource::PIE;
+#endif
+	else
+		return PyErr_Format(PyExc_Exception, "unsupported viewport %s", source_name);
+
+	if (ring_size < 1)
+		return PyErr_Format(PyExc_Exception, "ring_size must be at least 1");
+	capture->RingSize = ring_size;
+	capture->Interval = FMath::Max(interval, 0.f);
+	capture->MaxFrames = FMath::Max<int64>(max_frames, 0);
+
+	if (!FPythonViewportPixels::ParseFormat(format_name, capture->Format))
+		return PyErr_Format(PyExc_Exception, "unsupported pixel format %s (expected rgba8, bgra8 or rgba32f)", format_name);
+
+	if (encode_name)
+	{
+		if (!FCStringAnsi::Stricmp(encode_name, "png"))
+			capture->Encode = EPythonViewportCaptureEncode::PNG;
+		else if (!FCStringAnsi::Stricmp(encode_name, "raw"))
+			capture->Encode = EPythonViewportCaptureEncode::Raw;
+		else
+			return PyErr_Format(PyExc_Exception, "unsupported encoding %s (expected png or raw)", encode_name);
+	}
+
+	if (capture->Encode == EPythonViewportCaptureEncode::PNG && capture->Format == EPythonViewportPixelFormat::RGBA32F)
+		return PyErr_Format(PyExc_Exception, "png encoding requires an 8 bit pixel format");
+
+	if (output_dir)
+	{
+		if (capture->Encode == EPythonViewportCaptureEncode::None)
+			return PyErr_Format(PyExc_Exception, "output_dir requires an encoding");
+		capture->OutputDir = UTF8_TO_TCHAR(output_dir);
+		if (!IFileManager::Get().MakeDirectory(*capture->OutputDir, true))
+			return PyErr_Format(PyExc_Exception, "unable to create directory %s", output_dir);
+	}
+
+	// the image wrapper module must be loaded on the game thread before workers can use it
+	if (capture->Encode == EPythonViewportCaptureEncode::PNG)
+		FModuleManager::Get().LoadModule(TEXT("ImageWrapper"));
+
+	ue_py_viewport_capture_shutdown();
+
+	GPythonViewportCapture = capture;
+	capture->Start();
+
+	Py_RETURN_NONE;
+}
+
+PyObject *py_unreal_engine_viewport_capture_pop(PyObject *self, PyObject * args)
+{
+	if (!GPythonViewportCapture.IsValid())
+		Py_RETURN_NONE;
+
+	FPythonViewportCaptureFrame frame;
+	if (!GPythonViewportCapture->Pop(frame))
+		Py_RETURN_NONE;
+
+	PyObject *py_data;
+	if (frame.Filename.IsEmpty())
+		py_data = PyByteArray_FromStringAndSize((char *)frame.Data.GetData(), frame.Data.Num());
+	else
+		py_data = PyUnicode_FromString(TCHAR_TO_UTF8(*frame.Filename));
+
+	if (!py_data)
+		return nullptr;
+
+	return Py_BuildValue("{s:L,s:d,s:i,s:i,s:N}",
+		"index", (long long)frame.Index,
+		"time", frame.Time,
+		"width", frame.Size.X,
+		"height", frame.Size.Y,
+		frame.Filename.IsEmpty() ? "data" : "path", py_data);
+}
+
+PyObject *py_unreal_engine_viewport_capture_stats(PyObject *self, PyObject * args)
+{
+	if (!GPythonViewportCapture.IsValid())
+		Py_RETURN_NONE;
+
+	return GPythonViewportCapture->GetStats();
+}
+
+PyObject *py_unreal_engine_viewport_capture_stop(PyObject *self, PyObject * args)
+{
+	if (!GPythonViewportCapture.IsValid())
+		Py_RETURN_NONE;
+
+	ue_py_viewport_capture_shutdown();
+
+	// the session is kept alive so already captured frames can still be popped
+	return GPythonViewportCapture->GetStats();
+}
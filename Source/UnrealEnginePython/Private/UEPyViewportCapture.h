@@ -0,0 +1,13 @@
+#pragma once
+
+
+
+#include "UEPyModule.h"
+
+PyObject *py_unreal_engine_viewport_capture_start(PyObject *, PyObject *, PyObject *);
+PyObject *py_unreal_engine_viewport_capture_pop(PyObject *, PyObject *);
+PyObject *py_unreal_engine_viewport_capture_stats(PyObject *, PyObject *);
+PyObject *py_unreal_engine_viewport_capture_stop(PyObject *, PyObject *);
+
+// stops the running capture (if any) and waits for its workers, called at module shutdown
+void ue_py_viewport_capture_stop_all();
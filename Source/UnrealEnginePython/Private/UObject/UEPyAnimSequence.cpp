@@ -1,5 +1,10 @@
 #include "UEPyAnimSequence.h"//  BlendSpace ͷļ
 #include "Animation/BlendSpace.h"
+#include "Async/ParallelFor.h"
+#if WITH_EDITOR && ENGINE_MAJOR_VERSION == 5
+#include "Animation/AnimData/IAnimationDataModel.h"
+#include "Animation/AnimData/IAnimationDataController.h"
+#endif
 
 
 PyObject *py_ue_anim_get_skeleton(ue_PyUObject * self, PyObject * args)
@@ -304,6 +309,553 @@ PyObject *py_ue_add_anim_composite_section(ue_PyUObject * self, PyObject * args)
 	return PyLong_FromLong(anim->AddAnimCompositeSection(FName(UTF8_TO_TCHAR(name)), time));
 }
 
+#if ENGINE_MAJOR_VERSION == 5
+// packed raw tracks use 10 floats per bone per key: translation (xyz), rotation (xyzw), scale (xyz)
+#define UEPY_ANIM_KEY_FLOATS 10
+
+// a snapshot of the raw bone tracks of an AnimSequence, it does not reference the UObject so it can be evaluated out of the game thread
+struct FPythonAnimRawTracks
+{
+	TArray<FName> Bones;
+	// NumKeys transforms for each bone (bone major)
+	TArray<FTransform> Keys;
+	int32 NumKeys = 0;
+	double PlayLength = 0;
+
+	bool Gather(UAnimSequence *anim_seq)
+	{
+		const IAnimationDataModel *model = anim_seq->GetDataModel();
+		if (!model)
+			return false;
+
+		NumKeys = model->GetNumberOfKeys();
+		PlayLength = model->GetPlayLength();
+		Bones.Reset();
+		Keys.Reset();
+
+#if ENGINE_MINOR_VERSION >= 2
+		model->GetBoneTrackNames(Bones);
+		Keys.Reserve(Bones.Num() * NumKeys);
+		TArray<FTransform> transforms;
+		for (FName bone : Bones)
+		{
+			transforms.Reset();
+			model->GetBoneTrackTransforms(bone, transforms);
+			for (int32 i = 0; i < NumKeys; i++)
+			{
+				Keys.Add(transforms.Num() > 0 ? transforms[FMath::Min(i, transforms.Num() - 1)] : FTransform::Identity);
+			}
+		}
+#else
+		for (const FBoneAnimationTrack &track : model->GetBoneAnimationTracks())
+		{
+			Bones.Add(track.Name);
+			const FRawAnimSequenceTrack &raw = track.InternalTrackData;
+			// constant tracks store a single key
+			for (int32 i = 0; i < NumKeys; i++)
+			{
+				FTransform transform = FTransform::Identity;
+				if (raw.PosKeys.Num() > 0)
+					transform.SetTranslation(FVector(raw.PosKeys[FMath::Min(i, raw.PosKeys.Num() - 1)]));
+				if (raw.RotKeys.Num() > 0)
+					transform.SetRotation(FQuat(raw.RotKeys[FMath::Min(i, raw.RotKeys.Num() - 1)]));
+				if (raw.ScaleKeys.Num() > 0)
+					transform.SetScale3D(FVector(raw.ScaleKeys[FMath::Min(i, raw.ScaleKeys.Num() - 1)]));
+				Keys.Add(transform);
+			}
+		}
+#endif
+		return true;
+	}
+
+	// linear interpolation between the two nearest keys (like raw data evaluation)
+	FTransform Evaluate(int32 track_index, double time) const
+	{
+		const FTransform *track = Keys.GetData() + track_index * NumKeys;
+		if (NumKeys < 2 || PlayLength <= 0)
+			return NumKeys > 0 ? track[0] : FTransform::Identity;
+
+		const double position = FMath::Clamp(time / PlayLength, 0.0, 1.0) * (NumKeys - 1);
+		const int32 key0 = FMath::Min((int32)position, NumKeys - 1);
+		const int32 key1 = FMath::Min(key0 + 1, NumKeys - 1);
+		const float alpha = (float)(position - key0);
+		if (alpha <= 0 || key0 == key1)
+			return track[key0];
+
+		FTransform transform;
+		transform.Blend(track[key0], track[key1], alpha);
+		return transform;
+	}
+};
+
+static void ue_py_anim_write_transform(float *out, const FTransform &transform)
+{
+	const FVector translation = transform.GetTranslation();
+	const FQuat rotation = transform.GetRotation();
+	const FVector scale = transform.GetScale3D();
+	out[0] = translation.X;
+	out[1] = translation.Y;
+	out[2] = translation.Z;
+	out[3] = rotation.X;
+	out[4] = rotation.Y;
+	out[5] = rotation.Z;
+	out[6] = rotation.W;
+	out[7] = scale.X;
+	out[8] = scale.Y;
+	out[9] = scale.Z;
+}
+
+static bool ue_py_anim_get_names(PyObject *py_names, TArray<FName> &names)
+{
+	PyObject *py_iter = PyObject_GetIter(py_names);
+	if (!py_iter)
+	{
+		PyErr_SetString(PyExc_Exception, "bones is not an iterable of strings");
+		return false;
+	}
+
+	while (PyObject *py_item = PyIter_Next(py_iter))
+	{
+		if (!PyUnicodeOrString_Check(py_item))
+		{
+			Py_DECREF(py_item);
+			Py_DECREF(py_iter);
+			PyErr_SetString(PyExc_Exception, "bones is not an iterable of strings");
+			return false;
+		}
+		names.Add(FName(UTF8_TO_TCHAR(UEPyUnicode_AsUTF8(py_item))));
+		Py_DECREF(py_item);
+	}
+	Py_DECREF(py_iter);
+
+	return !PyErr_Occurred();
+}
+
+// times can be a float32/float64 buffer or an iterable of numbers
+static bool ue_py_anim_get_times(PyObject *py_times, TArray<double> &times)
+{
+	if (PyObject_CheckBuffer(py_times))
+	{
+		Py_buffer py_buf;
+		if (PyObject_GetBuffer(py_times, &py_buf, PyBUF_FORMAT | PyBUF_C_CONTIGUOUS) < 0)
+			return false;
+
+		const char *format = py_buf.format ? py_buf.format : "B";
+		if (*format == '<' || *format == '=' || *format == '@')
+			format++;
+
+		bool success = true;
+		if (*format == 'd' && py_buf.len % sizeof(double) == 0)
+		{
+			times.Append((const double *)py_buf.buf, py_buf.len / sizeof(double));
+		}
+		else if ((*format == 'f' || *format == 'B') && py_buf.len % sizeof(float) == 0)
+		{
+			const float *values = (const float *)py_buf.buf;
+			for (Py_ssize_t i = 0; i < (Py_ssize_t)(py_buf.len / sizeof(float)); i++)
+			{
+				times.Add(values[i]);
+			}
+		}
+		else
+		{
+			PyErr_SetString(PyExc_Exception, "times buffer must contain float32 or float64 values");
+			success = false;
+		}
+		PyBuffer_Release(&py_buf);
+		return success;
+	}
+
+	PyObject *py_iter = PyObject_GetIter(py_times);
+	if (!py_iter)
+	{
+		PyErr_SetString(PyExc_Exception, "times is not a buffer or an iterable of numbers");
+		return false;
+	}
+
+	while (PyObject *py_item = PyIter_Next(py_iter))
+	{
+		if (!PyNumber_Check(py_item))
+		{
+			Py_DECREF(py_item);
+			Py_DECREF(py_iter);
+			PyErr_SetString(PyExc_Exception, "times is not a buffer or an iterable of numbers");
+			return false;
+		}
+		PyObject *py_float = PyNumber_Float(py_item);
+		Py_DECREF(py_item);
+		if (!py_float)
+		{
+			Py_DECREF(py_iter);
+			return false;
+		}
+		times.Add(PyFloat_AsDouble(py_float));
+		Py_DECREF(py_float);
+	}
+	Py_DECREF(py_iter);
+
+	return !PyErr_Occurred();
+}
+
+// a batch sampling job: the tracks snapshot, the requested bones (track index or reference pose) and the output buffer
+struct FPythonAnimSampleJob
+{
+	FPythonAnimRawTracks Tracks;
+	TArray<int32> TrackIndices;
+	TArray<FTransform> RefPoses;
+	TArray<double> Times;
+	float *Output = nullptr;
+
+	bool Setup(UAnimSequence *anim_seq, PyObject *py_bones)
+	{
+		if (!Tracks.Gather(anim_seq))
+		{
+			PyErr_Format(PyExc_Exception, "AnimSequence %s has no raw data", TCHAR_TO_UTF8(*anim_seq->GetName()));
+			return false;
+		}
+
+		TArray<FName> bones;
+		if (py_bones && py_bones != Py_None)
+		{
+			if (!ue_py_anim_get_names(py_bones, bones))
+				return false;
+		}
+		else
+		{
+			bones = Tracks.Bones;
+		}
+
+		USkeleton *skeleton = anim_seq->GetSkeleton();
+		for (FName bone : bones)
+		{
+			int32 track_index = Tracks.Bones.IndexOfByKey(bone);
+			FTransform ref_pose = FTransform::Identity;
+			// bones without a track use the reference pose
+			if (track_index == INDEX_NONE)
+			{
+				int32 bone_index = skeleton ? skeleton->GetReferenceSkeleton().FindBoneIndex(bone) : INDEX_NONE;
+				if (bone_index == INDEX_NONE)
+				{
+					PyErr_Format(PyExc_Exception, "unknown bone %s", TCHAR_TO_UTF8(*bone.ToString()));
+					return false;
+				}
+				ref_pose = skeleton->GetReferenceSkeleton().GetRefBonePose()[bone_index];
+			}
+			TrackIndices.Add(track_index);
+			RefPoses.Add(ref_pose);
+		}
+		return true;
+	}
+
+	Py_ssize_t GetOutputSize() const
+	{
+		return (Py_ssize_t)Times.Num() * TrackIndices.Num() * UEPY_ANIM_KEY_FLOATS * sizeof(float);
+	}
+
+	void Run() const
+	{
+		for (int32 t = 0; t < Times.Num(); t++)
+		{
+			for (int32 b = 0; b < TrackIndices.Num(); b++)
+			{
+				float *out = Output + ((int64)t * TrackIndices.Num() + b) * UEPY_ANIM_KEY_FLOATS;
+				ue_py_anim_write_transform(out, TrackIndices[b] == INDEX_NONE ? RefPoses[b] : Tracks.Evaluate(TrackIndices[b], Times[t]));
+			}
+		}
+	}
+};
+
+PyObject *py_ue_anim_sequence_get_raw_animation_buffer(ue_PyUObject * self, PyObject * args)
+{
+	ue_py_check(self);
+
+	UAnimSequence *anim_seq = ue_py_check_type<UAnimSequence>(self);
+	if (!anim_seq)
+		return PyErr_Format(PyExc_Exception, "UObject is not a UAnimSequence.");
+
+	FPythonAnimRawTracks tracks;
+	if (!tracks.Gather(anim_seq))
+		return PyErr_Format(PyExc_Exception, "AnimSequence has no raw data");
+
+	PyObject *py_data = PyByteArray_FromStringAndSize(nullptr, (Py_ssize_t)tracks.NumKeys * tracks.Bones.Num() * UEPY_ANIM_KEY_FLOATS * sizeof(float));
+	float *data = (float *)PyByteArray_AsString(py_data);
+	// key major layout (keys x bones x 10)
+	for (int32 b = 0; b < tracks.Bones.Num(); b++)
+	{
+		for (int32 k = 0; k < tracks.NumKeys; k++)
+		{
+			ue_py_anim_write_transform(data + ((int64)k * tracks.Bones.Num() + b) * UEPY_ANIM_KEY_FLOATS, tracks.Keys[b * tracks.NumKeys + k]);
+		}
+	}
+
+	PyObject *py_bones = PyList_New(0);
+	for (FName bone : tracks.Bones)
+	{
+		PyObject *py_name = PyUnicode_FromString(TCHAR_TO_UTF8(*bone.ToString()));
+		PyList_Append(py_bones, py_name);
+		Py_DECREF(py_name);
+	}
+
+	PyObject *py_dict = PyDict_New();
+	PyDict_SetItemString(py_dict, "data", py_data);
+	Py_DECREF(py_data);
+	PyDict_SetItemString(py_dict, "bones", py_bones);
+	Py_DECREF(py_bones);
+	PyObject *py_value = PyLong_FromLong(tracks.NumKeys);
+	PyDict_SetItemString(py_dict, "num_keys", py_value);
+	Py_DECREF(py_value);
+	py_value = PyFloat_FromDouble(tracks.PlayLength);
+	PyDict_SetItemString(py_dict, "play_length", py_value);
+	Py_DECREF(py_value);
+
+	return py_dict;
+}
+
+PyObject *py_ue_anim_sequence_set_raw_animation_buffer(ue_PyUObject * self, PyObject * args, PyObject * kwargs)
+{
+	ue_py_check(self);
+
+	PyObject *py_data;
+	PyObject *py_bones = nullptr;
+	PyObject *py_replace = nullptr;
+
+	static char *kw_names[] = { (char *)"data", (char *)"bones", (char *)"replace", nullptr };
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O|OO:set_raw_animation_buffer", kw_names, &py_data, &py_bones, &py_replace))
+		return nullptr;
+
+	UAnimSequence *anim_seq = ue_py_check_type<UAnimSequence>(self);
+	if (!anim_seq)
+		return PyErr_Format(PyExc_Exception, "UObject is not a UAnimSequence.");
+
+	const bool bReplace = py_replace && PyObject_IsTrue(py_replace);
+
+	TArray<FName> bones;
+	if (py_bones && py_bones != Py_None)
+	{
+		if (!ue_py_anim_get_names(py_bones, bones))
+			return nullptr;
+	}
+	else
+	{
+		FPythonAnimRawTracks tracks;
+		if (!tracks.Gather(anim_seq))
+			return PyErr_Format(PyExc_Exception, "AnimSequence has no raw data");
+		bones = tracks.Bones;
+	}
+
+	if (bones.Num() == 0)
+		return PyErr_Format(PyExc_Exception, "no bones specified");
+
+	Py_buffer py_buf;
+	if (PyObject_GetBuffer(py_data, &py_buf, PyBUF_SIMPLE) < 0)
+		return PyErr_Format(PyExc_Exception, "data does not support the buffer protocol");
+
+	const Py_ssize_t key_size = (Py_ssize_t)bones.Num() * UEPY_ANIM_KEY_FLOATS * sizeof(float);
+	if (py_buf.len == 0 || py_buf.len % key_size != 0)
+	{
+		PyBuffer_Release(&py_buf);
+		return PyErr_Format(PyExc_Exception, "data size must be a multiple of %d bytes (%d bones x %d floats)", (int)key_size, bones.Num(), UEPY_ANIM_KEY_FLOATS);
+	}
+
+	// every track must be valid before touching the asset, a failure in the middle would leave it half written
+	USkeleton *skeleton = anim_seq->GetSkeleton();
+	if (!skeleton)
+	{
+		PyBuffer_Release(&py_buf);
+		return PyErr_Format(PyExc_Exception, "AnimSequence has no skeleton");
+	}
+	for (FName bone : bones)
+	{
+		if (skeleton->GetReferenceSkeleton().FindBoneIndex(bone) == INDEX_NONE)
+		{
+			PyBuffer_Release(&py_buf);
+			return PyErr_Format(PyExc_Exception, "unable to add track for bone %s", TCHAR_TO_UTF8(*bone.ToString()));
+		}
+	}
+
+	const int32 num_keys = (int32)(py_buf.len / key_size);
+	const float *data = (const float *)py_buf.buf;
+	// an animation needs at least one frame (two keys), a single key is held for the whole frame
+	const int32 num_track_keys = FMath::Max(num_keys, 2);
+
+	// split in per-bone keys before touching the asset
+	TArray<TArray<FVector3f>> pos_keys;
+	TArray<TArray<FQuat4f>> rot_keys;
+	TArray<TArray<FVector3f>> scale_keys;
+	pos_keys.SetNum(bones.Num());
+	rot_keys.SetNum(bones.Num());
+	scale_keys.SetNum(bones.Num());
+	for (int32 b = 0; b < bones.Num(); b++)
+	{
+		pos_keys[b].SetNumUninitialized(num_track_keys);
+		rot_keys[b].SetNumUninitialized(num_track_keys);
+		scale_keys[b].SetNumUninitialized(num_track_keys);
+		for (int32 k = 0; k < num_track_keys; k++)
+		{
+			const float *key = data + ((int64)FMath::Min(k, num_keys - 1) * bones.Num() + b) * UEPY_ANIM_KEY_FLOATS;
+			pos_keys[b][k] = FVector3f(key[0], key[1], key[2]);
+			rot_keys[b][k] = FQuat4f(key[3], key[4], key[5], key[6]).GetNormalized();
+			scale_keys[b][k] = FVector3f(key[7], key[8], key[9]);
+		}
+	}
+	PyBuffer_Release(&py_buf);
+
+	anim_seq->Modify();
+
+	IAnimationDataController &controller = anim_seq->GetController();
+	// a single bracket generates a single model notification (and a single recompression)
+	controller.OpenBracket(FText::FromString("Python set_raw_animation_buffer"), false);
+
+	if (bReplace)
+	{
+		controller.RemoveAllBoneTracks(false);
+	}
+
+	if (anim_seq->GetDataModel()->GetNumberOfKeys() != num_track_keys)
+	{
+#if ENGINE_MINOR_VERSION >= 2
+		controller.SetNumberOfFrames(FFrameNumber(num_track_keys - 1), false);
+#else
+		controller.SetPlayLength(anim_seq->GetDataModel()->GetFrameRate().AsSeconds(FFrameNumber(num_track_keys - 1)), false);
+#endif
+	}
+
+	for (int32 b = 0; b < bones.Num(); b++)
+	{
+		if (!anim_seq->GetDataModel()->IsValidBoneTrackName(bones[b]))
+		{
+#if ENGINE_MINOR_VERSION >= 2
+			controller.AddBoneCurve(bones[b], false);
+#else
+			controller.AddBoneTrack(bones[b], false);
+#endif
+		}
+		controller.SetBoneTrackKeys(bones[b], pos_keys[b], rot_keys[b], scale_keys[b], false);
+	}
+
+	controller.CloseBracket(false);
+
+	anim_seq->MarkPackageDirty();
+
+	Py_RETURN_NONE;
+}
+
+PyObject *py_ue_anim_sequence_sample_bone_transforms(ue_PyUObject * self, PyObject * args, PyObject * kwargs)
+{
+	ue_py_check(self);
+
+	PyObject *py_times;
+	PyObject *py_bones = nullptr;
+
+	static char *kw_names[] = { (char *)"times", (char *)"bones", nullptr };
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O|O:sample_bone_transforms", kw_names, &py_times, &py_bones))
+		return nullptr;
+
+	UAnimSequence *anim_seq = ue_py_check_type<UAnimSequence>(self);
+	if (!anim_seq)
+		return PyErr_Format(PyExc_Exception, "UObject is not a UAnimSequence.");
+
+	FPythonAnimSampleJob job;
+	if (!ue_py_anim_get_times(py_times, job.Times))
+		return nullptr;
+	if (!job.Setup(anim_seq, py_bones))
+		return nullptr;
+
+	PyObject *py_output = PyByteArray_FromStringAndSize(nullptr, job.GetOutputSize());
+	job.Output = (float *)PyByteArray_AsString(py_output);
+
+	Py_BEGIN_ALLOW_THREADS;
+	job.Run();
+	Py_END_ALLOW_THREADS;
+
+	return py_output;
+}
+
+PyObject *py_unreal_engine_sample_anim_sequences(PyObject * self, PyObject * args, PyObject * kwargs)
+{
+	PyObject *py_anims;
+	PyObject *py_times;
+	PyObject *py_bones = nullptr;
+	PyObject *py_parallel = nullptr;
+
+	static char *kw_names[] = { (char *)"anims", (char *)"times", (char *)"bones", (char *)"parallel", nullptr };
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OO|OO:sample_anim_sequences", kw_names, &py_anims, &py_times, &py_bones, &py_parallel))
+		return nullptr;
+
+	TArray<UAnimSequence *> anims;
+	PyObject *py_iter = PyObject_GetIter(py_anims);
+	if (!py_iter)
+		return PyErr_Format(PyExc_Exception, "argument is not an iterable of UAnimSequence");
+	while (PyObject *py_item = PyIter_Next(py_iter))
+	{
+		UAnimSequence *anim_seq = ue_py_check_type<UAnimSequence>(py_item);
+		Py_DECREF(py_item);
+		if (!anim_seq)
+		{
+			Py_DECREF(py_iter);
+			return PyErr_Format(PyExc_Exception, "argument is not an iterable of UAnimSequence");
+		}
+		anims.Add(anim_seq);
+	}
+	Py_DECREF(py_iter);
+
+	// times can be shared by all of the clips, or a sequence with a times buffer per clip
+	bool bPerClipTimes = false;
+	if ((PyList_Check(py_times) || PyTuple_Check(py_times)) && PySequence_Size(py_times) == anims.Num() && anims.Num() > 0)
+	{
+		PyObject *py_first = PySequence_GetItem(py_times, 0);
+		bPerClipTimes = !PyNumber_Check(py_first);
+		Py_DECREF(py_first);
+	}
+
+	TArray<FPythonAnimSampleJob> jobs;
+	jobs.SetNum(anims.Num());
+	for (int32 i = 0; i < anims.Num(); i++)
+	{
+		if (bPerClipTimes)
+		{
+			PyObject *py_clip_times = PySequence_GetItem(py_times, i);
+			bool times_ok = ue_py_anim_get_times(py_clip_times, jobs[i].Times);
+			Py_DECREF(py_clip_times);
+			if (!times_ok)
+				return nullptr;
+		}
+		else if (i == 0)
+		{
+			if (!ue_py_anim_get_times(py_times, jobs[i].Times))
+				return nullptr;
+		}
+		else
+		{
+			jobs[i].Times = jobs[0].Times;
+		}
+
+		if (!jobs[i].Setup(anims[i], py_bones))
+			return nullptr;
+	}
+
+	PyObject *py_list = PyList_New(jobs.Num());
+	for (int32 i = 0; i < jobs.Num(); i++)
+	{
+		PyObject *py_output = PyByteArray_FromStringAndSize(nullptr, jobs[i].GetOutputSize());
+		jobs[i].Output = (float *)PyByteArray_AsString(py_output);
+		PyList_SetItem(py_list, i, py_output);
+	}
+
+	const bool bForceSingleThread = py_parallel && !PyObject_IsTrue(py_parallel);
+
+	// the jobs only reference their own snapshots and output buffers
+	Py_BEGIN_ALLOW_THREADS;
+	ParallelFor(jobs.Num(), [&](int32 Index)
+	{
+		jobs[Index].Run();
+	}, bForceSingleThread);
+	Py_END_ALLOW_THREADS;
+
+	return py_list;
+}
+#endif
+
 #endif
 #endif
 
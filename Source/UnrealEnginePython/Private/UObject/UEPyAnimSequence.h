@@ -18,6 +18,12 @@ PyObject *py_ue_add_anim_composite_section(ue_PyUObject *, PyObject *);
 PyObject *py_ue_anim_sequence_update_compressed_track_map_from_raw(ue_PyUObject *, PyObject *);
 PyObject *py_ue_anim_sequence_apply_raw_anim_changes(ue_PyUObject *, PyObject *);
 PyObject *py_ue_anim_add_key_to_sequence(ue_PyUObject *, PyObject *);
+#if ENGINE_MAJOR_VERSION == 5
+PyObject *py_ue_anim_sequence_get_raw_animation_buffer(ue_PyUObject *, PyObject *);
+PyObject *py_ue_anim_sequence_set_raw_animation_buffer(ue_PyUObject *, PyObject *, PyObject *);
+PyObject *py_ue_anim_sequence_sample_bone_transforms(ue_PyUObject *, PyObject *, PyObject *);
+PyObject *py_unreal_engine_sample_anim_sequences(PyObject *, PyObject *, PyObject *);
+#endif
 #endif
 PyObject *py_ue_anim_set_skeleton(ue_PyUObject *, PyObject *);
 PyObject *py_ue_anim_get_bone_transform(ue_PyUObject *, PyObject *);
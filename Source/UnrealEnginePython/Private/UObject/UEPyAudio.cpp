@@ -2,6 +2,9 @@
 
 #include "Sound/SoundWaveProcedural.h"
 #include "Kismet/GameplayStatics.h"
+#include "Runtime/Core/Public/Containers/Ticker.h"
+
+#include <atomic>
 
 PyObject *py_ue_queue_audio(ue_PyUObject *self, PyObject * args)
 {
@@ -70,25 +73,109 @@ PyObject *py_ue_reset_audio(ue_PyUObject *self, PyObject * args)
 	Py_RETURN_NONE;
 }
 
+#if ENGINE_MAJOR_VERSION == 5
+// read-only buffer protocol exporter keeping an FSharedBuffer alive for the lifetime of its views
+typedef struct
+{
+	PyObject_HEAD
+	/* Type-specific fields go here. */
+	FSharedBuffer buffer;
+} ue_PyFSharedBuffer;
+
+static void ue_py_fshared_buffer_dealloc(ue_PyFSharedBuffer *self)
+{
+	self->buffer.~FSharedBuffer();
+	Py_TYPE(self)->tp_free((PyObject *)self);
+}
+
+static int ue_py_fshared_buffer_getbuffer(ue_PyFSharedBuffer *self, Py_buffer *view, int flags)
+{
+	return PyBuffer_FillInfo(view, (PyObject *)self, (void *)self->buffer.GetData(), (Py_ssize_t)self->buffer.GetSize(), 1, flags);
+}
+
+static PyBufferProcs ue_PyFSharedBuffer_as_buffer = {
+	(getbufferproc)ue_py_fshared_buffer_getbuffer,
+	nullptr,
+};
+
+static PyTypeObject ue_PyFSharedBufferType = {
+	PyVarObject_HEAD_INIT(NULL, 0)
+	"unreal_engine.FSharedBuffer", /* tp_name */
+	sizeof(ue_PyFSharedBuffer), /* tp_basicsize */
+	0,                         /* tp_itemsize */
+	(destructor)ue_py_fshared_buffer_dealloc,       /* tp_dealloc */
+	0,                         /* tp_print */
+	0,                         /* tp_getattr */
+	0,                         /* tp_setattr */
+	0,                         /* tp_reserved */
+	0,                         /* tp_repr */
+	0,                         /* tp_as_number */
+	0,                         /* tp_as_sequence */
+	0,                         /* tp_as_mapping */
+	0,                         /* tp_hash  */
+	0,                         /* tp_call */
+	0,                         /* tp_str */
+	0,                         /* tp_getattro */
+	0,                         /* tp_setattro */
+	&ue_PyFSharedBuffer_as_buffer, /* tp_as_buffer */
+	Py_TPFLAGS_DEFAULT,        /* tp_flags */
+	"Unreal Engine FSharedBuffer", /* tp_doc */
+};
+
+#if WITH_EDITORONLY_DATA
+static PyObject *py_ue_new_fshared_buffer_view(FSharedBuffer buffer)
+{
+	ue_PyFSharedBuffer *ret = (ue_PyFSharedBuffer *)PyObject_New(ue_PyFSharedBuffer, &ue_PyFSharedBufferType);
+	if (!ret)
+		return nullptr;
+	new (&ret->buffer) FSharedBuffer(MoveTemp(buffer));
+	PyObject *py_view = PyMemoryView_FromObject((PyObject *)ret);
+	Py_DECREF(ret);
+	return py_view;
+}
+#endif
+#endif
+
+void ue_python_init_fshared_buffer(PyObject *ue_module)
+{
+#if ENGINE_MAJOR_VERSION == 5
+	if (PyType_Ready(&ue_PyFSharedBufferType) < 0)
+		return;
+
+	Py_INCREF(&ue_PyFSharedBufferType);
+	PyModule_AddObject(ue_module, "FSharedBuffer", (PyObject *)&ue_PyFSharedBufferType);
+#endif
+}
+
 PyObject *py_ue_sound_get_data(ue_PyUObject *self, PyObject * args)
 {
 	ue_py_check(self);
 
+	PyObject *py_as_view = nullptr;
+	if (!PyArg_ParseTuple(args, "|O:sound_get_data", &py_as_view))
+	{
+		return NULL;
+	}
+
 #if WITH_EDITORONLY_DATA
 	USoundWave *sound = ue_py_check_type<USoundWave>(self);
 	if (!sound)
 		return PyErr_Format(PyExc_Exception, "UObject is not a USoundWave.");
 
-	USoundWave::FEditorAudioBulkData raw_data = sound->RawData;
+	USoundWave::FEditorAudioBulkData &raw_data = sound->RawData;
+
+	FSharedBuffer Buffer;
+	Py_BEGIN_ALLOW_THREADS;
+	Buffer = raw_data.GetPayload().Get();
+	Py_END_ALLOW_THREADS;
+
+	// a memoryview sharing the payload memory, no copy is made
+	if (py_as_view && PyObject_IsTrue(py_as_view))
+		return py_ue_new_fshared_buffer_view(MoveTemp(Buffer));
 
-	FSharedBuffer Buffer = raw_data.GetPayload().Get();
-	//char *data = (char *)raw_data.Lock(LOCK_READ_ONLY);
-	int32 data_size = raw_data.GetPayloadSize();
-	PyObject *py_data = PyBytes_FromStringAndSize((const char*)Buffer.GetData(), data_size);
-	//raw_data.Unlock();
-	return py_data;
+	return PyBytes_FromStringAndSize((const char*)Buffer.GetData(), Buffer.GetSize());
 #else
-	return nullptr;
+	return PyErr_Format(PyExc_Exception, "sound data is only available in the editor");
 #endif
 }
 
@@ -105,21 +192,26 @@ PyObject *py_ue_sound_set_data(ue_PyUObject *self, PyObject * args)
 
 	USoundWave *sound = ue_py_check_type<USoundWave>(self);
 	if (!sound)
+	{
+		PyBuffer_Release(&sound_buffer);
 		return PyErr_Format(PyExc_Exception, "UObject is not a USoundWave.");
+	}
 
 	sound->FreeResources();
 	sound->InvalidateCompressedData();
 
 #if WITH_EDITORONLY_DATA
+	// the bulk data must own its payload, so make the only copy here (without the GIL)
+	// and hand it over already owned
 	FSharedBuffer Buffer;
-	Buffer = FSharedBuffer::MakeView(sound_buffer.buf, sound_buffer.len, Buffer);
-	sound->RawData.UpdatePayload(Buffer);
-	//sound->RawData.Lock(LOCK_READ_WRITE);
-	//void *data = sound->RawData.Realloc(sound_buffer.len);
-	//FMemory::Memcpy(data, sound_buffer.buf, sound_buffer.len);
-	//sound->RawData.Unlock();
+	Py_BEGIN_ALLOW_THREADS;
+	Buffer = FSharedBuffer::Clone(sound_buffer.buf, sound_buffer.len);
+	Py_END_ALLOW_THREADS;
+	sound->RawData.UpdatePayload(MoveTemp(Buffer));
 #endif
 
+	PyBuffer_Release(&sound_buffer);
+
 	Py_RETURN_NONE;
 }
 
@@ -159,4 +251,395 @@ PyObject *py_ue_play_sound_at_location(ue_PyUObject *self, PyObject * args)
 	UGameplayStatics::PlaySoundAtLocation(self->ue_object, sound_object, location->vec, volume, pitch, start);
 
 	Py_RETURN_NONE;
-}
\ No newline at end of file
+}
+
+/*
+
+Pull-mode procedural audio: python (or a python callback) fills a lock-free single producer/single consumer
+byte ring, the audio render thread drains it from the USoundWaveProcedural underflow delegate.
+The audio thread never touches python, so it never waits for the GIL.
+
+*/
+
+class FPythonAudioRing
+{
+public:
+	explicit FPythonAudioRing(uint32 InCapacity)
+	{
+		const uint32 Capacity = FMath::RoundUpToPowerOfTwo(FMath::Max<uint32>(InCapacity, 2));
+		Data.SetNumZeroed(Capacity);
+		Mask = Capacity - 1;
+	}
+
+	uint32 GetCapacity() const { return Mask + 1; }
+
+	uint32 Num() const
+	{
+		return (uint32)(Tail.load(std::memory_order_acquire) - Head.load(std::memory_order_acquire));
+	}
+
+	// producer side, contiguous free region starting at the write position
+	uint32 GetWriteRegion(uint8 *&Ptr)
+	{
+		const uint64 WritePos = Tail.load(std::memory_order_relaxed);
+		const uint32 Free = GetCapacity() - (uint32)(WritePos - Head.load(std::memory_order_acquire));
+		const uint32 Offset = (uint32)WritePos & Mask;
+		Ptr = Data.GetData() + Offset;
+		return FMath::Min(Free, GetCapacity() - Offset);
+	}
+
+	void CommitWrite(uint32 Size)
+	{
+		Tail.store(Tail.load(std::memory_order_relaxed) + Size, std::memory_order_release);
+	}
+
+	uint32 Write(const uint8 *Src, uint32 Size)
+	{
+		uint32 Written = 0;
+		while (Written < Size)
+		{
+			uint8 *Ptr;
+			const uint32 Region = FMath::Min(GetWriteRegion(Ptr), Size - Written);
+			if (Region == 0)
+				break;
+			FMemory::Memcpy(Ptr, Src + Written, Region);
+			CommitWrite(Region);
+			Written += Region;
+		}
+		return Written;
+	}
+
+	// consumer side, contiguous readable region starting at the read position
+	uint32 GetReadRegion(const uint8 *&Ptr)
+	{
+		const uint64 ReadPos = Head.load(std::memory_order_relaxed);
+		const uint32 Available = (uint32)(Tail.load(std::memory_order_acquire) - ReadPos);
+		const uint32 Offset = (uint32)ReadPos & Mask;
+		Ptr = Data.GetData() + Offset;
+		return FMath::Min(Available, GetCapacity() - Offset);
+	}
+
+	void CommitRead(uint32 Size)
+	{
+		Head.store(Head.load(std::memory_order_relaxed) + Size, std::memory_order_release);
+	}
+
+private:
+	TArray<uint8> Data;
+	uint32 Mask;
+	// read position, only written by the consumer
+	std::atomic<uint64> Head{ 0 };
+	// write position, only written by the producer
+	std::atomic<uint64> Tail{ 0 };
+};
+
+class FPythonProceduralAudioStream : public TSharedFromThis<FPythonProceduralAudioStream, ESPMode::ThreadSafe>
+{
+public:
+	FPythonProceduralAudioStream(uint32 Capacity) : Ring(Capacity)
+	{
+	}
+
+	FPythonAudioRing Ring;
+	PyObject *py_callable = nullptr;
+
+	// bytes requested by the device and not yet offered to the python callback
+	std::atomic<int64> Demand{ 0 };
+	// total bytes requested by the device
+	std::atomic<int64> Requested{ 0 };
+	std::atomic<int64> Consumed{ 0 };
+	std::atomic<int64> Underruns{ 0 };
+	std::atomic<int64> UnderrunBytes{ 0 };
+
+#if ENGINE_MAJOR_VERSION == 5
+	FTSTicker::FDelegateHandle TickerHandle;
+#else
+	FDelegateHandle TickerHandle;
+#endif
+
+	// audio render thread
+	void OnUnderflow(USoundWaveProcedural *InSoundWave, int32 SamplesRequired)
+	{
+		const uint32 BytesRequired = SamplesRequired * sizeof(int16);
+		uint32 BytesQueued = 0;
+		while (BytesQueued < BytesRequired)
+		{
+			const uint8 *Ptr;
+			// only hand out whole samples
+			const uint32 Region = FMath::Min(Ring.GetReadRegion(Ptr), BytesRequired - BytesQueued) & ~(uint32)(sizeof(int16) - 1);
+			if (Region == 0)
+				break;
+			InSoundWave->QueueAudio(Ptr, Region);
+			Ring.CommitRead(Region);
+			BytesQueued += Region;
+		}
+
+		Demand += BytesRequired;
+		Requested += BytesRequired;
+		Consumed += BytesQueued;
+		if (BytesQueued < BytesRequired)
+		{
+			Underruns++;
+			UnderrunBytes += BytesRequired - BytesQueued;
+		}
+	}
+
+	// game thread, offers the device demand to the python callback as writable views over the ring
+	bool Tick(float DeltaTime)
+	{
+		int64 Missing = Demand.exchange(0);
+		if (Missing <= 0)
+			return true;
+
+		FScopePythonGIL gil;
+		while (Missing > 0)
+		{
+			uint8 *Ptr;
+			const uint32 Region = (uint32)FMath::Min<int64>(Ring.GetWriteRegion(Ptr), Missing);
+			if (Region == 0)
+				break;
+
+			PyObject *py_view = PyMemoryView_FromMemory((char *)Ptr, Region, PyBUF_WRITE);
+			if (!py_view)
+			{
+				unreal_engine_py_log_error();
+				break;
+			}
+
+			PyObject *ret = PyObject_CallFunctionObjArgs(py_callable, py_view, nullptr);
+			// the view must not outlive this call
+			PyObject *py_released = PyObject_CallMethod(py_view, (char *)"release", nullptr);
+			if (!py_released)
+				PyErr_Clear();
+			Py_XDECREF(py_released);
+			Py_DECREF(py_view);
+			if (!ret)
+			{
+				unreal_engine_py_log_error();
+				break;
+			}
+
+			uint32 Written = Region;
+			if (ret != Py_None)
+			{
+				Written = (uint32)FMath::Clamp<long long>(PyLong_AsLongLong(ret), 0, Region);
+				if (PyErr_Occurred())
+				{
+					unreal_engine_py_log_error();
+					Written = 0;
+				}
+			}
+			Py_DECREF(ret);
+
+			Ring.CommitWrite(Written);
+			Missing -= Written;
+			if (Written < Region)
+				break;
+		}
+		return true;
+	}
+};
+
+// The underflow delegate is bound once per sound to its hook and never unbound (the audio render thread checks
+// IsBound() before executing it), streams are attached and detached under the hook lock instead.
+class FPythonProceduralAudioHook : public TSharedFromThis<FPythonProceduralAudioHook, ESPMode::ThreadSafe>
+{
+public:
+	// audio render thread
+	void OnUnderflow(USoundWaveProcedural *InSoundWave, int32 SamplesRequired)
+	{
+		FScopeLock lock(&Lock);
+		if (Stream.IsValid())
+			Stream->OnUnderflow(InSoundWave, SamplesRequired);
+	}
+
+	// returns the previous stream, so it is released out of the lock
+	TSharedPtr<FPythonProceduralAudioStream, ESPMode::ThreadSafe> SetStream(TSharedPtr<FPythonProceduralAudioStream, ESPMode::ThreadSafe> NewStream)
+	{
+		FScopeLock lock(&Lock);
+		TSharedPtr<FPythonProceduralAudioStream, ESPMode::ThreadSafe> OldStream = Stream;
+		Stream = NewStream;
+		return OldStream;
+	}
+
+	// game thread only
+	TSharedPtr<FPythonProceduralAudioStream, ESPMode::ThreadSafe> Stream;
+
+private:
+	FCriticalSection Lock;
+};
+
+static TMap<TWeakObjectPtr<USoundWaveProcedural>, TSharedPtr<FPythonProceduralAudioHook, ESPMode::ThreadSafe>> ue_py_procedural_audio_hooks;
+
+// game thread, with the GIL held
+static void ue_py_procedural_audio_release_stream(TSharedPtr<FPythonProceduralAudioStream, ESPMode::ThreadSafe> stream)
+{
+	if (!stream.IsValid())
+		return;
+
+	if (stream->TickerHandle.IsValid())
+	{
+#if ENGINE_MAJOR_VERSION == 5
+		FTSTicker::GetCoreTicker().RemoveTicker(stream->TickerHandle);
+#else
+		FTicker::GetCoreTicker().RemoveTicker(stream->TickerHandle);
+#endif
+		stream->TickerHandle.Reset();
+	}
+
+	Py_CLEAR(stream->py_callable);
+}
+
+static void ue_py_procedural_audio_stop(USoundWaveProcedural *sound_wave_procedural)
+{
+	TSharedPtr<FPythonProceduralAudioHook, ESPMode::ThreadSafe> *hook = ue_py_procedural_audio_hooks.Find(sound_wave_procedural);
+	if (!hook)
+		return;
+
+	ue_py_procedural_audio_release_stream((*hook)->SetStream(nullptr));
+}
+
+// drops the hooks (and streams) of sounds that have been garbage collected
+static void ue_py_procedural_audio_purge()
+{
+	FScopePythonGIL gil;
+	for (auto It = ue_py_procedural_audio_hooks.CreateIterator(); It; ++It)
+	{
+		if (!It.Key().IsValid())
+		{
+			ue_py_procedural_audio_release_stream(It.Value()->SetStream(nullptr));
+			It.RemoveCurrent();
+		}
+	}
+}
+
+static FPythonProceduralAudioStream *ue_py_procedural_audio_get_stream(ue_PyUObject *self)
+{
+	USoundWaveProcedural *sound_wave_procedural = ue_py_check_type<USoundWaveProcedural>(self);
+	if (!sound_wave_procedural)
+	{
+		PyErr_Format(PyExc_Exception, "UObject is not a USoundWaveProcedural.");
+		return nullptr;
+	}
+
+	TSharedPtr<FPythonProceduralAudioHook, ESPMode::ThreadSafe> *hook = ue_py_procedural_audio_hooks.Find(sound_wave_procedural);
+	if (!hook || !(*hook)->Stream.IsValid())
+	{
+		PyErr_Format(PyExc_Exception, "procedural audio stream not started, call procedural_audio_start() first");
+		return nullptr;
+	}
+	return (*hook)->Stream.Get();
+}
+
+PyObject *py_ue_procedural_audio_start(ue_PyUObject *self, PyObject * args, PyObject *kwargs)
+{
+	ue_py_check(self);
+
+	int capacity = 65536;
+	PyObject *py_callable = nullptr;
+	int prefill = 0;
+
+	static char *kw_names[] = { (char *)"capacity", (char *)"callback", (char *)"prefill", nullptr };
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "|iOi:procedural_audio_start", kw_names, &capacity, &py_callable, &prefill))
+	{
+		return nullptr;
+	}
+
+	USoundWaveProcedural *sound_wave_procedural = ue_py_check_type<USoundWaveProcedural>(self);
+	if (!sound_wave_procedural)
+		return PyErr_Format(PyExc_Exception, "UObject is not a USoundWaveProcedural.");
+
+	if (capacity <= 0)
+		return PyErr_Format(PyExc_Exception, "capacity must be greater than 0");
+
+	if (py_callable == Py_None)
+		py_callable = nullptr;
+
+	if (py_callable && !PyCallable_Check(py_callable))
+		return PyErr_Format(PyExc_Exception, "argument is not callable");
+
+	static FDelegateHandle purge_handle;
+	if (!purge_handle.IsValid())
+	{
+		purge_handle = FCoreUObjectDelegates::GetPostGarbageCollect().AddStatic(&ue_py_procedural_audio_purge);
+	}
+
+	TSharedRef<FPythonProceduralAudioStream, ESPMode::ThreadSafe> stream = MakeShared<FPythonProceduralAudioStream, ESPMode::ThreadSafe>((uint32)capacity);
+	stream->Demand = FMath::Clamp(prefill, 0, (int32)stream->Ring.GetCapacity());
+
+	if (py_callable)
+	{
+		stream->py_callable = py_callable;
+		Py_INCREF(stream->py_callable);
+#if ENGINE_MAJOR_VERSION == 5
+		stream->TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateSP(stream, &FPythonProceduralAudioStream::Tick), 0);
+#else
+		stream->TickerHandle = FTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateSP(stream, &FPythonProceduralAudioStream::Tick), 0);
+#endif
+	}
+
+	TSharedPtr<FPythonProceduralAudioHook, ESPMode::ThreadSafe> &hook = ue_py_procedural_audio_hooks.FindOrAdd(sound_wave_procedural);
+	if (!hook.IsValid())
+	{
+		hook = MakeShared<FPythonProceduralAudioHook, ESPMode::ThreadSafe>();
+		sound_wave_procedural->OnSoundWaveProceduralUnderflow = FOnSoundWaveProceduralUnderflow::CreateSP(hook.ToSharedRef(), &FPythonProceduralAudioHook::OnUnderflow);
+	}
+	ue_py_procedural_audio_release_stream(hook->SetStream(stream));
+
+	return PyLong_FromUnsignedLong(stream->Ring.GetCapacity());
+}
+
+PyObject *py_ue_procedural_audio_write(ue_PyUObject *self, PyObject * args)
+{
+	ue_py_check(self);
+
+	Py_buffer sound_buffer;
+	if (!PyArg_ParseTuple(args, "y*:procedural_audio_write", &sound_buffer))
+	{
+		return NULL;
+	}
+
+	FPythonProceduralAudioStream *stream = ue_py_procedural_audio_get_stream(self);
+	if (!stream)
+	{
+		PyBuffer_Release(&sound_buffer);
+		return nullptr;
+	}
+
+	// never blocks, returns how many bytes fitted in the ring
+	uint32 written = stream->Ring.Write((const uint8 *)sound_buffer.buf, (uint32)sound_buffer.len);
+	PyBuffer_Release(&sound_buffer);
+
+	return PyLong_FromUnsignedLong(written);
+}
+
+PyObject *py_ue_procedural_audio_stats(ue_PyUObject *self, PyObject * args)
+{
+	ue_py_check(self);
+
+	FPythonProceduralAudioStream *stream = ue_py_procedural_audio_get_stream(self);
+	if (!stream)
+		return nullptr;
+
+	return Py_BuildValue("{s:I,s:I,s:L,s:L,s:L,s:L,s:L}",
+		"capacity", stream->Ring.GetCapacity(),
+		"available", stream->Ring.Num(),
+		"requested", (long long)stream->Requested.load(),
+		"pending", (long long)stream->Demand.load(),
+		"consumed", (long long)stream->Consumed.load(),
+		"underruns", (long long)stream->Underruns.load(),
+		"underrun_bytes", (long long)stream->UnderrunBytes.load());
+}
+
+PyObject *py_ue_procedural_audio_stop(ue_PyUObject *self, PyObject * args)
+{
+	ue_py_check(self);
+
+	USoundWaveProcedural *sound_wave_procedural = ue_py_check_type<USoundWaveProcedural>(self);
+	if (!sound_wave_procedural)
+		return PyErr_Format(PyExc_Exception, "UObject is not a USoundWaveProcedural.");
+
+	ue_py_procedural_audio_stop(sound_wave_procedural);
+
+	Py_RETURN_NONE;
+}
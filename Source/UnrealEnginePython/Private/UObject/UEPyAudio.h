@@ -9,4 +9,10 @@ PyObject *py_ue_play_sound_at_location(ue_PyUObject *, PyObject *);
 PyObject *py_ue_sound_get_data(ue_PyUObject *self, PyObject * args);
 PyObject *py_ue_sound_set_data(ue_PyUObject *self, PyObject * args);
 PyObject *py_ue_get_available_audio_byte_count(ue_PyUObject *, PyObject *);
-PyObject *py_ue_reset_audio(ue_PyUObject *, PyObject *);
\ No newline at end of file
+PyObject *py_ue_reset_audio(ue_PyUObject *, PyObject *);
+PyObject *py_ue_procedural_audio_start(ue_PyUObject *, PyObject *, PyObject *);
+PyObject *py_ue_procedural_audio_write(ue_PyUObject *, PyObject *);
+PyObject *py_ue_procedural_audio_stats(ue_PyUObject *, PyObject *);
+PyObject *py_ue_procedural_audio_stop(ue_PyUObject *, PyObject *);
+
+void ue_python_init_fshared_buffer(PyObject *);
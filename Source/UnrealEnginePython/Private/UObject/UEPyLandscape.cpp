@@ -6,6 +6,9 @@
 #include "Wrappers/UEPyFRawMesh.h"
 #include "Runtime/Landscape/Classes/LandscapeProxy.h"
 #include "Runtime/Landscape/Classes/LandscapeInfo.h"
+#include "Runtime/Landscape/Classes/Landscape.h"
+#include "Runtime/Landscape/Classes/LandscapeLayerInfoObject.h"
+#include "Runtime/Landscape/Public/LandscapeEdit.h"
 #include "GameFramework/GameModeBase.h"
 
 PyObject* py_ue_create_landscape_info(ue_PyUObject* self, PyObject* args)
@@ -53,14 +56,20 @@ PyObject* py_ue_landscape_import(ue_PyUObject* self, PyObject* args)
 
 	ALandscapeProxy* landscape = ue_py_check_type<ALandscapeProxy>(self);
 	if (!landscape)
+	{
+		PyBuffer_Release(&heightmap_buffer);
 		return PyErr_Format(PyExc_Exception, "uobject is not a ULandscapeProxy");
+	}
 
 	int quads_per_component = sections_per_component * section_size;
 	int size_x = component_x * quads_per_component + 1;
 	int size_y = component_y * quads_per_component + 1;
 
 	if (heightmap_buffer.len < (Py_ssize_t)(size_x * size_y * sizeof(uint16)))
+	{
+		PyBuffer_Release(&heightmap_buffer);
 		return PyErr_Format(PyExc_Exception, "not enough heightmap data, expecting %lu bytes", size_x * size_y * sizeof(uint16));
+	}
 
 	uint16* data = (uint16*)heightmap_buffer.buf;
 
@@ -70,17 +79,14 @@ PyObject* py_ue_landscape_import(ue_PyUObject* self, PyObject* args)
 	landscape->Import(FGuid::NewGuid(), 0, 0, size_x - 1, size_y - 1, sections_per_component, section_size, data, nullptr, infos, (ELandscapeImportAlphamapType)layer_type);
 #else
 	TMap<FGuid, TArray<uint16>> HeightDataPerLayers;
-	TArray<uint16> HeightData;
-	for (uint32 i = 0; i < (heightmap_buffer.len / sizeof(uint16)); i++)
-	{
-		HeightData.Add(data[i]);
-	}
-	HeightDataPerLayers.Add(FGuid(), HeightData);
+	HeightDataPerLayers.Add(FGuid(), TArray<uint16>(data, size_x * size_y));
 	TMap<FGuid, TArray<FLandscapeImportLayerInfo>> MaterialLayersInfo;
 	MaterialLayersInfo.Add(FGuid(), infos);
 	landscape->Import(FGuid::NewGuid(), 0, 0, size_x - 1, size_y - 1, sections_per_component, section_size, HeightDataPerLayers, nullptr, MaterialLayersInfo, (ELandscapeImportAlphamapType)layer_type);
 #endif
 
+	PyBuffer_Release(&heightmap_buffer);
+
 	Py_RETURN_NONE;
 }
 
@@ -108,4 +114,292 @@ PyObject* py_ue_landscape_export_to_raw_mesh(ue_PyUObject* self, PyObject* args)
 	return py_ue_new_fraw_mesh(raw_mesh);
 #endif
 }
+
+/*
+
+Region access goes through FLandscapeEditDataInterface, so only the components overlapping the rect are
+updated. Coordinates are landscape vertex coordinates (both corners included).
+With a tile_size the rect is processed in tiles, flushing the edit interface texture cache after each one,
+so memory stays bounded even on 8k+ landscapes.
+
+*/
+static ULandscapeInfo* ue_py_landscape_region_info(ue_PyUObject* self)
+{
+	ALandscapeProxy* landscape = ue_py_check_type<ALandscapeProxy>(self);
+	if (!landscape)
+	{
+		PyErr_Format(PyExc_Exception, "uobject is not a ULandscapeProxy");
+		return nullptr;
+	}
+
+	ULandscapeInfo* info = landscape->GetLandscapeInfo();
+	if (!info)
+	{
+		PyErr_Format(PyExc_Exception, "landscape has no ULandscapeInfo");
+		return nullptr;
+	}
+	return info;
+}
+
+static bool ue_py_landscape_check_region(int32 x1, int32 y1, int32 x2, int32 y2, int32 tile_size)
+{
+	if (x2 < x1 || y2 < y1)
+	{
+		PyErr_Format(PyExc_Exception, "invalid region (%d, %d) - (%d, %d)", x1, y1, x2, y2);
+		return false;
+	}
+	if (tile_size < 0)
+	{
+		PyErr_Format(PyExc_Exception, "tile_size must not be negative");
+		return false;
+	}
+	return true;
+}
+
+static void ue_py_landscape_for_each_tile(FLandscapeEditDataInterface& edit, int32 x1, int32 y1, int32 x2, int32 y2, int32 tile_size, TFunctionRef<void(int32, int32, int32, int32)> callback)
+{
+	if (tile_size <= 0)
+	{
+		callback(x1, y1, x2, y2);
+		return;
+	}
+
+	for (int32 tile_y = y1; tile_y <= y2; tile_y += tile_size)
+	{
+		for (int32 tile_x = x1; tile_x <= x2; tile_x += tile_size)
+		{
+			callback(tile_x, tile_y, FMath::Min(tile_x + tile_size - 1, x2), FMath::Min(tile_y + tile_size - 1, y2));
+			edit.Flush();
+		}
+	}
+}
+
+#if ENGINE_MAJOR_VERSION == 5
+// landscapes with edit layers are written through one of their layers, then the final content is regenerated
+struct FPythonScopedLandscapeEditLayer
+{
+	FPythonScopedLandscapeEditLayer(ULandscapeInfo* info, int32 edit_layer)
+	{
+		ALandscape* landscape = info->LandscapeActor.Get();
+		if (landscape && landscape->HasLayersContent())
+		{
+			const FLandscapeLayer* layer = landscape->GetLayer(edit_layer);
+			if (layer)
+			{
+				Scope = MakeUnique<FScopedSetLandscapeEditingLayer>(landscape, layer->Guid, [landscape]()
+					{
+						landscape->RequestLayersContentUpdate(ELandscapeLayerUpdateMode::Update_All);
+					});
+			}
+		}
+	}
+
+	TUniquePtr<FScopedSetLandscapeEditingLayer> Scope;
+};
+#endif
+
+// on landscapes with edit layers, edit_layer must be the index of one of them
+static bool ue_py_landscape_check_edit_layer(ULandscapeInfo* info, int32 edit_layer)
+{
+#if ENGINE_MAJOR_VERSION == 5
+	ALandscape* landscape = info->LandscapeActor.Get();
+	if (landscape && landscape->HasLayersContent() && !landscape->GetLayer(edit_layer))
+	{
+		PyErr_Format(PyExc_Exception, "invalid edit layer %d, the landscape has %d edit layers", edit_layer, landscape->GetLayerCount());
+		return false;
+	}
+#endif
+	return true;
+}
+
+PyObject* py_ue_landscape_get_extent(ue_PyUObject* self, PyObject* args)
+{
+
+	ue_py_check(self);
+
+	ULandscapeInfo* info = ue_py_landscape_region_info(self);
+	if (!info)
+		return nullptr;
+
+	int32 min_x, min_y, max_x, max_y;
+	if (!info->GetLandscapeExtent(min_x, min_y, max_x, max_y))
+		Py_RETURN_NONE;
+
+	return Py_BuildValue((char*)"(iiii)", min_x, min_y, max_x, max_y);
+}
+
+PyObject* py_ue_landscape_get_heights(ue_PyUObject* self, PyObject* args, PyObject* kwargs)
+{
+
+	ue_py_check(self);
+
+	int x1, y1, x2, y2;
+	int tile_size = 0;
+	static char* kw_names[] = { (char*)"x1", (char*)"y1", (char*)"x2", (char*)"y2", (char*)"tile_size", nullptr };
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "iiii|i:landscape_get_heights", kw_names, &x1, &y1, &x2, &y2, &tile_size))
+		return nullptr;
+
+	ULandscapeInfo* info = ue_py_landscape_region_info(self);
+	if (!info)
+		return nullptr;
+
+	if (!ue_py_landscape_check_region(x1, y1, x2, y2, tile_size))
+		return nullptr;
+
+	const int32 stride = x2 - x1 + 1;
+	const int32 rows = y2 - y1 + 1;
+	PyObject* py_buf = PyByteArray_FromStringAndSize(nullptr, (Py_ssize_t)stride * rows * sizeof(uint16));
+	uint16* data = (uint16*)PyByteArray_AsString(py_buf);
+	// vertices not covered by a component are left to 0
+	FMemory::Memzero(data, (SIZE_T)stride * rows * sizeof(uint16));
+
+	FLandscapeEditDataInterface edit(info);
+	ue_py_landscape_for_each_tile(edit, x1, y1, x2, y2, tile_size, [&](int32 tx1, int32 ty1, int32 tx2, int32 ty2)
+		{
+			edit.GetHeightDataFast(tx1, ty1, tx2, ty2, data + (ty1 - y1) * stride + (tx1 - x1), stride);
+		});
+
+	return py_buf;
+}
+
+PyObject* py_ue_landscape_set_heights(ue_PyUObject* self, PyObject* args, PyObject* kwargs)
+{
+
+	ue_py_check(self);
+
+	int x1, y1, x2, y2;
+	Py_buffer py_buf;
+	int tile_size = 0;
+	int edit_layer = 0;
+	static char* kw_names[] = { (char*)"x1", (char*)"y1", (char*)"x2", (char*)"y2", (char*)"data", (char*)"tile_size", (char*)"edit_layer", nullptr };
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "iiiiy*|ii:landscape_set_heights", kw_names, &x1, &y1, &x2, &y2, &py_buf, &tile_size, &edit_layer))
+		return nullptr;
+
+	ULandscapeInfo* info = ue_py_landscape_region_info(self);
+	if (!info || !ue_py_landscape_check_region(x1, y1, x2, y2, tile_size) || !ue_py_landscape_check_edit_layer(info, edit_layer))
+	{
+		PyBuffer_Release(&py_buf);
+		return nullptr;
+	}
+
+	const int32 stride = x2 - x1 + 1;
+	const int32 rows = y2 - y1 + 1;
+	if (py_buf.len < (Py_ssize_t)stride * rows * (Py_ssize_t)sizeof(uint16))
+	{
+		PyBuffer_Release(&py_buf);
+		return PyErr_Format(PyExc_Exception, "not enough heightmap data, expecting %lld bytes", (long long)stride * rows * sizeof(uint16));
+	}
+
+	const uint16* data = (const uint16*)py_buf.buf;
+
+	{
+#if ENGINE_MAJOR_VERSION == 5
+		FPythonScopedLandscapeEditLayer scoped_layer(info, edit_layer);
+#endif
+		FLandscapeEditDataInterface edit(info);
+		ue_py_landscape_for_each_tile(edit, x1, y1, x2, y2, tile_size, [&](int32 tx1, int32 ty1, int32 tx2, int32 ty2)
+			{
+				edit.SetHeightData(tx1, ty1, tx2, ty2, data + (ty1 - y1) * stride + (tx1 - x1), stride, true);
+			});
+	}
+
+	PyBuffer_Release(&py_buf);
+
+	Py_RETURN_NONE;
+}
+
+PyObject* py_ue_landscape_get_weights(ue_PyUObject* self, PyObject* args, PyObject* kwargs)
+{
+
+	ue_py_check(self);
+
+	char* layer_name;
+	int x1, y1, x2, y2;
+	int tile_size = 0;
+	static char* kw_names[] = { (char*)"layer", (char*)"x1", (char*)"y1", (char*)"x2", (char*)"y2", (char*)"tile_size", nullptr };
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "siiii|i:landscape_get_weights", kw_names, &layer_name, &x1, &y1, &x2, &y2, &tile_size))
+		return nullptr;
+
+	ULandscapeInfo* info = ue_py_landscape_region_info(self);
+	if (!info)
+		return nullptr;
+
+	if (!ue_py_landscape_check_region(x1, y1, x2, y2, tile_size))
+		return nullptr;
+
+	ULandscapeLayerInfoObject* layer_info = info->GetLayerInfoByName(FName(UTF8_TO_TCHAR(layer_name)));
+	if (!layer_info)
+		return PyErr_Format(PyExc_Exception, "unable to find landscape paint layer %s", layer_name);
+
+	const int32 stride = x2 - x1 + 1;
+	const int32 rows = y2 - y1 + 1;
+	PyObject* py_buf = PyByteArray_FromStringAndSize(nullptr, (Py_ssize_t)stride * rows);
+	uint8* data = (uint8*)PyByteArray_AsString(py_buf);
+	FMemory::Memzero(data, (SIZE_T)stride * rows);
+
+	FLandscapeEditDataInterface edit(info);
+	ue_py_landscape_for_each_tile(edit, x1, y1, x2, y2, tile_size, [&](int32 tx1, int32 ty1, int32 tx2, int32 ty2)
+		{
+			edit.GetWeightDataFast(layer_info, tx1, ty1, tx2, ty2, data + (ty1 - y1) * stride + (tx1 - x1), stride);
+		});
+
+	return py_buf;
+}
+
+PyObject* py_ue_landscape_set_weights(ue_PyUObject* self, PyObject* args, PyObject* kwargs)
+{
+
+	ue_py_check(self);
+
+	char* layer_name;
+	int x1, y1, x2, y2;
+	Py_buffer py_buf;
+	int tile_size = 0;
+	int edit_layer = 0;
+	PyObject* py_weight_adjust = nullptr;
+	static char* kw_names[] = { (char*)"layer", (char*)"x1", (char*)"y1", (char*)"x2", (char*)"y2", (char*)"data", (char*)"tile_size", (char*)"edit_layer", (char*)"weight_adjust", nullptr };
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "siiiiy*|iiO:landscape_set_weights", kw_names, &layer_name, &x1, &y1, &x2, &y2, &py_buf, &tile_size, &edit_layer, &py_weight_adjust))
+		return nullptr;
+
+	ULandscapeInfo* info = ue_py_landscape_region_info(self);
+	if (!info || !ue_py_landscape_check_region(x1, y1, x2, y2, tile_size) || !ue_py_landscape_check_edit_layer(info, edit_layer))
+	{
+		PyBuffer_Release(&py_buf);
+		return nullptr;
+	}
+
+	ULandscapeLayerInfoObject* layer_info = info->GetLayerInfoByName(FName(UTF8_TO_TCHAR(layer_name)));
+	if (!layer_info)
+	{
+		PyBuffer_Release(&py_buf);
+		return PyErr_Format(PyExc_Exception, "unable to find landscape paint layer %s", layer_name);
+	}
+
+	const int32 stride = x2 - x1 + 1;
+	const int32 rows = y2 - y1 + 1;
+	if (py_buf.len < (Py_ssize_t)stride * rows)
+	{
+		PyBuffer_Release(&py_buf);
+		return PyErr_Format(PyExc_Exception, "not enough weightmap data, expecting %lld bytes", (long long)stride * rows);
+	}
+
+	// by default the other layers are adjusted so the total weight stays 255
+	const bool bWeightAdjust = !py_weight_adjust || PyObject_IsTrue(py_weight_adjust);
+	const uint8* data = (const uint8*)py_buf.buf;
+
+	{
+#if ENGINE_MAJOR_VERSION == 5
+		FPythonScopedLandscapeEditLayer scoped_layer(info, edit_layer);
+#endif
+		FLandscapeEditDataInterface edit(info);
+		ue_py_landscape_for_each_tile(edit, x1, y1, x2, y2, tile_size, [&](int32 tx1, int32 ty1, int32 tx2, int32 ty2)
+			{
+				edit.SetAlphaData(layer_info, tx1, ty1, tx2, ty2, data + (ty1 - y1) * stride + (tx1 - x1), stride, ELandscapeLayerPaintingRestriction::None, bWeightAdjust);
+			});
+	}
+
+	PyBuffer_Release(&py_buf);
+
+	Py_RETURN_NONE;
+}
 #endif
@@ -9,4 +9,9 @@ PyObject *py_ue_create_landscape_info(ue_PyUObject *self, PyObject *);
 PyObject *py_ue_get_landscape_info(ue_PyUObject *self, PyObject *);
 PyObject *py_ue_landscape_import(ue_PyUObject *self, PyObject *);
 PyObject *py_ue_landscape_export_to_raw_mesh(ue_PyUObject *self, PyObject *);
+PyObject *py_ue_landscape_get_extent(ue_PyUObject *self, PyObject *);
+PyObject *py_ue_landscape_get_heights(ue_PyUObject *self, PyObject *, PyObject *);
+PyObject *py_ue_landscape_set_heights(ue_PyUObject *self, PyObject *, PyObject *);
+PyObject *py_ue_landscape_get_weights(ue_PyUObject *self, PyObject *, PyObject *);
+PyObject *py_ue_landscape_set_weights(ue_PyUObject *self, PyObject *, PyObject *);
 #endif
\ No newline at end of file
@@ -30,6 +30,13 @@
 #include "Sections/MovieSceneBoolSection.h"
 #include "Sections/MovieScene3DTransformSection.h"
 #include "Sections/MovieSceneVectorSection.h"
+#if ENGINE_MAJOR_VERSION == 5 || (ENGINE_MAJOR_VERSION == 4 && ENGINE_MINOR_VERSION >= 20)
+#include "Channels/MovieSceneFloatChannel.h"
+#include "Channels/MovieSceneBoolChannel.h"
+#endif
+#if ENGINE_MAJOR_VERSION == 5
+#include "Channels/MovieSceneDoubleChannel.h"
+#endif
 #include "Runtime/MovieScene/Public/MovieSceneFolder.h"
 #include "Runtime/MovieScene/Public/MovieSceneSpawnable.h"
 #include "Runtime/MovieScene/Public/MovieScenePossessable.h"
@@ -1414,6 +1421,588 @@ PyObject *py_ue_sequencer_section_add_key(ue_PyUObject *self, PyObject * args)
 	return PyErr_Format(PyExc_Exception, "unsupported section type: %s", TCHAR_TO_UTF8(*section->GetClass()->GetName()));
 }
 
+#if WITH_EDITOR
+#if ENGINE_MAJOR_VERSION == 5 || (ENGINE_MAJOR_VERSION == 4 && ENGINE_MINOR_VERSION >= 20)
+// read a float32/float64 buffer (or an iterable of numbers) as doubles
+// untyped bytes and bytearray are packed float64 values, uint8 values are accepted (when allowed) only
+// from an explicitly typed buffer, like memoryview.cast('B'), array.array('B') or a numpy uint8 array
+static bool ue_py_sequencer_get_doubles(PyObject *py_obj, TArray<double> &values, const char *name, bool allow_uint8 = false)
+{
+	if (PyObject_CheckBuffer(py_obj))
+	{
+		Py_buffer py_buf;
+		if (PyObject_GetBuffer(py_obj, &py_buf, PyBUF_FORMAT | PyBUF_C_CONTIGUOUS) < 0)
+			return false;
+
+		const char *format = py_buf.format ? py_buf.format : "B";
+		if (*format == '<' || *format == '=' || *format == '@')
+			format++;
+		if (PyBytes_Check(py_obj) || PyByteArray_Check(py_obj))
+			format = "d";
+
+		bool success = true;
+		if (*format == 'd' && format[1] == 0)
+		{
+			if (py_buf.len % sizeof(double) == 0)
+			{
+				values.Append((const double *)py_buf.buf, py_buf.len / sizeof(double));
+			}
+			else
+			{
+				PyErr_Format(PyExc_Exception, "%s buffer size is not a multiple of the float64 size", name);
+				success = false;
+			}
+		}
+		else if (*format == 'f' && format[1] == 0)
+		{
+			const float *data = (const float *)py_buf.buf;
+			values.Reserve(values.Num() + py_buf.len / sizeof(float));
+			for (Py_ssize_t i = 0; i < (Py_ssize_t)(py_buf.len / sizeof(float)); i++)
+			{
+				values.Add(data[i]);
+			}
+		}
+		else if (allow_uint8 && (*format == 'B' || *format == '?') && format[1] == 0)
+		{
+			const uint8 *data = (const uint8 *)py_buf.buf;
+			values.Reserve(values.Num() + py_buf.len);
+			for (Py_ssize_t i = 0; i < py_buf.len; i++)
+			{
+				values.Add(data[i]);
+			}
+		}
+		else
+		{
+			if (allow_uint8)
+				PyErr_Format(PyExc_Exception, "%s buffer must contain float32, float64 or uint8 values", name);
+			else
+				PyErr_Format(PyExc_Exception, "%s buffer must contain float32 or float64 values", name);
+			success = false;
+		}
+		PyBuffer_Release(&py_buf);
+		return success;
+	}
+
+	PyObject *py_iter = PyObject_GetIter(py_obj);
+	if (!py_iter)
+	{
+		PyErr_Format(PyExc_Exception, "%s is not a buffer or an iterable of numbers", name);
+		return false;
+	}
+
+	while (PyObject *py_item = PyIter_Next(py_iter))
+	{
+		PyObject *py_float = PyNumber_Check(py_item) ? PyNumber_Float(py_item) : nullptr;
+		Py_DECREF(py_item);
+		if (!py_float)
+		{
+			Py_DECREF(py_iter);
+			PyErr_Clear();
+			PyErr_Format(PyExc_Exception, "%s is not a buffer or an iterable of numbers", name);
+			return false;
+		}
+		values.Add(PyFloat_AsDouble(py_float));
+		Py_DECREF(py_float);
+	}
+	Py_DECREF(py_iter);
+
+	return !PyErr_Occurred();
+}
+
+static bool ue_py_sequencer_setup_key_value(FMovieSceneTangentData &tangent, TEnumAsByte<ERichCurveInterpMode> &interp_mode, TEnumAsByte<ERichCurveTangentMode> &tangent_mode, uint8 interpolation, const float *tangents)
+{
+	switch ((EMovieSceneKeyInterpolation)interpolation)
+	{
+	case(EMovieSceneKeyInterpolation::Auto):
+		interp_mode = RCIM_Cubic;
+		tangent_mode = RCTM_Auto;
+		break;
+	case(EMovieSceneKeyInterpolation::User):
+		interp_mode = RCIM_Cubic;
+		tangent_mode = RCTM_User;
+		break;
+	case(EMovieSceneKeyInterpolation::Break):
+		interp_mode = RCIM_Cubic;
+		tangent_mode = RCTM_Break;
+		break;
+	case(EMovieSceneKeyInterpolation::Linear):
+		interp_mode = RCIM_Linear;
+		tangent_mode = RCTM_Auto;
+		break;
+	case(EMovieSceneKeyInterpolation::Constant):
+		interp_mode = RCIM_Constant;
+		tangent_mode = RCTM_Auto;
+		break;
+	default:
+		return false;
+	}
+
+	if (tangents)
+	{
+		tangent.ArriveTangent = tangents[0];
+		tangent.LeaveTangent = tangents[1];
+	}
+	return true;
+}
+
+static uint8 ue_py_sequencer_get_key_interpolation(ERichCurveInterpMode interp_mode, ERichCurveTangentMode tangent_mode)
+{
+	if (interp_mode == RCIM_Linear)
+		return (uint8)EMovieSceneKeyInterpolation::Linear;
+	if (interp_mode == RCIM_Constant)
+		return (uint8)EMovieSceneKeyInterpolation::Constant;
+	if (tangent_mode == RCTM_User)
+		return (uint8)EMovieSceneKeyInterpolation::User;
+	if (tangent_mode == RCTM_Break)
+		return (uint8)EMovieSceneKeyInterpolation::Break;
+	return (uint8)EMovieSceneKeyInterpolation::Auto;
+}
+
+// merge the new (sorted) keys with the current ones (new keys win on the same frame)
+template<typename ValueType>
+static void ue_py_sequencer_merge_keys(TArrayView<const FFrameNumber> old_times, TArrayView<const ValueType> old_values, const TArray<FFrameNumber> &new_times, const TArray<ValueType> &new_values, TArray<FFrameNumber> &times, TArray<ValueType> &values)
+{
+	times.Reserve(old_times.Num() + new_times.Num());
+	values.Reserve(old_times.Num() + new_times.Num());
+
+	int32 old_index = 0;
+	int32 new_index = 0;
+	while (old_index < old_times.Num() || new_index < new_times.Num())
+	{
+		if (new_index >= new_times.Num() || (old_index < old_times.Num() && old_times[old_index] < new_times[new_index]))
+		{
+			times.Add(old_times[old_index]);
+			values.Add(old_values[old_index]);
+			old_index++;
+		}
+		else
+		{
+			if (old_index < old_times.Num() && old_times[old_index] == new_times[new_index])
+			{
+				old_index++;
+			}
+			times.Add(new_times[new_index]);
+			values.Add(new_values[new_index]);
+			new_index++;
+		}
+	}
+}
+
+// float and double channels share the same key structure
+template<typename ChannelType, typename ValueType>
+static bool ue_py_sequencer_channel_add_keys(ChannelType *channel, const TArray<FFrameNumber> &frames, const TArray<int32> &order, const TArray<double> &values, int32 channel_index, int32 num_channels, const TArray<double> &interpolations, const float *tangents)
+{
+	TArray<FFrameNumber> new_times;
+	TArray<ValueType> new_values;
+	new_times.Reserve(order.Num());
+	new_values.Reserve(order.Num());
+
+	for (int32 key_index : order)
+	{
+		ValueType value((decltype(ValueType::Value))values[key_index * num_channels + channel_index]);
+		const uint8 interpolation = (uint8)interpolations[interpolations.Num() > 1 ? key_index : 0];
+		if (!ue_py_sequencer_setup_key_value(value.Tangent, value.InterpMode, value.TangentMode, interpolation, tangents ? tangents + (key_index * num_channels + channel_index) * 2 : nullptr))
+		{
+			PyErr_Format(PyExc_Exception, "unsupported interpolation %d", interpolation);
+			return false;
+		}
+		new_times.Add(frames[key_index]);
+		new_values.Add(value);
+	}
+
+	TArray<FFrameNumber> times;
+	TArray<ValueType> merged_values;
+	auto channel_data = channel->GetData();
+	ue_py_sequencer_merge_keys<ValueType>(channel_data.GetTimes(), channel_data.GetValues(), new_times, new_values, times, merged_values);
+
+	channel->Set(MoveTemp(times), MoveTemp(merged_values));
+	channel->AutoSetTangents();
+	return true;
+}
+
+static void ue_py_sequencer_channel_add_bool_keys(FMovieSceneBoolChannel *channel, const TArray<FFrameNumber> &frames, const TArray<int32> &order, const TArray<double> &values, int32 channel_index, int32 num_channels)
+{
+	TArray<FFrameNumber> new_times;
+	TArray<bool> new_values;
+	for (int32 key_index : order)
+	{
+		new_times.Add(frames[key_index]);
+		new_values.Add(values[key_index * num_channels + channel_index] != 0);
+	}
+
+	TArray<FFrameNumber> times;
+	TArray<bool> merged_values;
+	TMovieSceneChannelData<bool> channel_data = channel->GetData();
+	ue_py_sequencer_merge_keys<bool>(channel_data.GetTimes(), channel_data.GetValues(), new_times, new_values, times, merged_values);
+
+	// keys are already sorted, so each AddKey is an append
+	channel_data.Reset();
+	for (int32 i = 0; i < times.Num(); i++)
+	{
+		channel_data.AddKey(times[i], merged_values[i]);
+	}
+}
+
+PyObject *py_ue_sequencer_section_add_keys(ue_PyUObject *self, PyObject * args, PyObject * kwargs)
+{
+	ue_py_check(self);
+
+	PyObject *py_times;
+	PyObject *py_values;
+	PyObject *py_interpolation = nullptr;
+	PyObject *py_tangents = nullptr;
+	int channel_filter = -1;
+
+	static char *kw_names[] = { (char *)"times", (char *)"values", (char *)"interpolation", (char *)"tangents", (char *)"channel", nullptr };
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OO|OOi:sequencer_section_add_keys", kw_names, &py_times, &py_values, &py_interpolation, &py_tangents, &channel_filter))
+	{
+		return nullptr;
+	}
+
+	UMovieSceneSection *section = ue_py_check_type<UMovieSceneSection>(self);
+	if (!section)
+		return PyErr_Format(PyExc_Exception, "uobject is not a MovieSceneSection");
+
+	UMovieSceneTrack *Track = section->GetTypedOuter<UMovieSceneTrack>();
+	if (!Track)
+		return PyErr_Format(PyExc_Exception, "unable to retrieve track from section");
+	UMovieScene *MovieScene = Track->GetTypedOuter<UMovieScene>();
+	if (!MovieScene)
+		return PyErr_Format(PyExc_Exception, "unable to retrieve scene from section");
+
+	// channels are keyed in channel proxy order (e.g. translation, rotation and scale xyz for a transform section)
+	FMovieSceneChannelProxy &proxy = section->GetChannelProxy();
+#if ENGINE_MAJOR_VERSION == 5
+	TArrayView<FMovieSceneDoubleChannel *> double_channels = proxy.GetChannels<FMovieSceneDoubleChannel>();
+#endif
+	TArrayView<FMovieSceneFloatChannel *> float_channels = proxy.GetChannels<FMovieSceneFloatChannel>();
+	TArrayView<FMovieSceneBoolChannel *> bool_channels = proxy.GetChannels<FMovieSceneBoolChannel>();
+
+	int32 num_channels = 0;
+#if ENGINE_MAJOR_VERSION == 5
+	if (double_channels.Num() > 0)
+		num_channels = double_channels.Num();
+	else
+#endif
+	if (float_channels.Num() > 0)
+		num_channels = float_channels.Num();
+	else if (bool_channels.Num() > 0)
+		num_channels = bool_channels.Num();
+	else
+		return PyErr_Format(PyExc_Exception, "unsupported section type: %s", TCHAR_TO_UTF8(*section->GetClass()->GetName()));
+
+	if (channel_filter >= num_channels)
+		return PyErr_Format(PyExc_Exception, "invalid channel index, must be between 0 and %d", num_channels - 1);
+
+	const int32 values_per_key = channel_filter >= 0 ? 1 : num_channels;
+
+	TArray<double> times;
+	if (!ue_py_sequencer_get_doubles(py_times, times, "times"))
+		return nullptr;
+
+	TArray<double> values;
+	if (!ue_py_sequencer_get_doubles(py_values, values, "values"))
+		return nullptr;
+
+	if (values.Num() != times.Num() * values_per_key)
+		return PyErr_Format(PyExc_Exception, "expected %d values (%d keys x %d channels), got %d", times.Num() * values_per_key, times.Num(), values_per_key, values.Num());
+
+	TArray<double> interpolations;
+	if (!py_interpolation || py_interpolation == Py_None)
+	{
+		interpolations.Add((double)EMovieSceneKeyInterpolation::Auto);
+	}
+	else if (PyNumber_Check(py_interpolation))
+	{
+		PyObject *py_float = PyNumber_Float(py_interpolation);
+		if (!py_float)
+			return nullptr;
+		interpolations.Add(PyFloat_AsDouble(py_float));
+		Py_DECREF(py_float);
+		if (PyErr_Occurred())
+			return nullptr;
+	}
+	else
+	{
+		if (!ue_py_sequencer_get_doubles(py_interpolation, interpolations, "interpolation", true))
+			return nullptr;
+		if (interpolations.Num() != times.Num())
+			return PyErr_Format(PyExc_Exception, "interpolation must contain a value for each key");
+	}
+
+	// the values are cast to uint8 while adding the keys
+	for (double interpolation : interpolations)
+	{
+		if (!(interpolation >= 0 && interpolation <= 255) || interpolation != FMath::FloorToDouble(interpolation))
+			return PyErr_Format(PyExc_Exception, "unsupported interpolation %f", interpolation);
+	}
+
+	// optional (arrive, leave) float32 tangents for each value
+	TArray<double> tangents_doubles;
+	TArray<float> tangents;
+	if (py_tangents && py_tangents != Py_None)
+	{
+		if (!ue_py_sequencer_get_doubles(py_tangents, tangents_doubles, "tangents"))
+			return nullptr;
+		if (tangents_doubles.Num() != values.Num() * 2)
+			return PyErr_Format(PyExc_Exception, "tangents must contain an (arrive, leave) pair for each value");
+		tangents.Reserve(tangents_doubles.Num());
+		for (double tangent : tangents_doubles)
+		{
+			tangents.Add((float)tangent);
+		}
+	}
+
+	TArray<FFrameNumber> frames;
+	frames.Reserve(times.Num());
+	bool bSorted = true;
+	for (int32 i = 0; i < times.Num(); i++)
+	{
+		frames.Add(MovieScene->GetTickResolution().AsFrameNumber(times[i]));
+		if (i > 0 && frames[i] < frames[i - 1])
+			bSorted = false;
+	}
+
+	// sort the keys once (stable, so the last key on the same frame wins), then drop duplicated frames
+	TArray<int32> order;
+	order.Reserve(frames.Num());
+	for (int32 i = 0; i < frames.Num(); i++)
+	{
+		order.Add(i);
+	}
+	if (!bSorted)
+	{
+		order.StableSort([&frames](int32 A, int32 B) { return frames[A] < frames[B]; });
+	}
+	TArray<int32> unique_order;
+	unique_order.Reserve(order.Num());
+	for (int32 i = 0; i < order.Num(); i++)
+	{
+		if (i + 1 < order.Num() && frames[order[i]] == frames[order[i + 1]])
+			continue;
+		unique_order.Add(order[i]);
+	}
+
+	section->Modify();
+
+	for (int32 channel_index = 0; channel_index < num_channels; channel_index++)
+	{
+		if (channel_filter >= 0 && channel_index != channel_filter)
+			continue;
+
+		const int32 value_index = channel_filter >= 0 ? 0 : channel_index;
+		bool success = true;
+#if ENGINE_MAJOR_VERSION == 5
+		if (double_channels.Num() > 0)
+			success = ue_py_sequencer_channel_add_keys<FMovieSceneDoubleChannel, FMovieSceneDoubleValue>(double_channels[channel_index], frames, unique_order, values, value_index, values_per_key, interpolations, tangents.Num() > 0 ? tangents.GetData() : nullptr);
+		else
+#endif
+		if (float_channels.Num() > 0)
+			success = ue_py_sequencer_channel_add_keys<FMovieSceneFloatChannel, FMovieSceneFloatValue>(float_channels[channel_index], frames, unique_order, values, value_index, values_per_key, interpolations, tangents.Num() > 0 ? tangents.GetData() : nullptr);
+		else
+			ue_py_sequencer_channel_add_bool_keys(bool_channels[channel_index], frames, unique_order, values, value_index, values_per_key);
+
+		if (!success)
+			return nullptr;
+	}
+
+	return PyLong_FromLong(unique_order.Num());
+}
+
+// exposes the bytearray as a typed memoryview (so it can be passed back to sequencer_section_add_keys), steals the reference
+static PyObject *ue_py_sequencer_typed_buffer(PyObject *py_bytearray, const char *format)
+{
+#if PY_MAJOR_VERSION >= 3
+	PyObject *py_view = PyMemoryView_FromObject(py_bytearray);
+	Py_DECREF(py_bytearray);
+	if (!py_view)
+		return nullptr;
+	PyObject *py_typed = PyObject_CallMethod(py_view, (char *)"cast", (char *)"s", format);
+	Py_DECREF(py_view);
+	return py_typed;
+#else
+	return py_bytearray;
+#endif
+}
+
+template<typename ValueType>
+static PyObject *ue_py_sequencer_channel_keys_to_python(FFrameRate tick_resolution, TArrayView<const FFrameNumber> times, TArrayView<const ValueType> values, TFunction<double(const ValueType &)> get_value, TFunction<void(const ValueType &, uint8 &, float *)> get_key_info)
+{
+	PyObject *py_frames = PyByteArray_FromStringAndSize(nullptr, times.Num() * sizeof(int32));
+	PyObject *py_times = PyByteArray_FromStringAndSize(nullptr, times.Num() * sizeof(double));
+	PyObject *py_values = PyByteArray_FromStringAndSize(nullptr, times.Num() * sizeof(double));
+	int32 *frames_data = (int32 *)PyByteArray_AsString(py_frames);
+	double *times_data = (double *)PyByteArray_AsString(py_times);
+	double *values_data = (double *)PyByteArray_AsString(py_values);
+
+	PyObject *py_interpolations = nullptr;
+	PyObject *py_tangents = nullptr;
+	uint8 *interpolations_data = nullptr;
+	float *tangents_data = nullptr;
+	if (get_key_info)
+	{
+		py_interpolations = PyByteArray_FromStringAndSize(nullptr, times.Num());
+		py_tangents = PyByteArray_FromStringAndSize(nullptr, times.Num() * sizeof(float) * 2);
+		interpolations_data = (uint8 *)PyByteArray_AsString(py_interpolations);
+		tangents_data = (float *)PyByteArray_AsString(py_tangents);
+	}
+
+	for (int32 i = 0; i < times.Num(); i++)
+	{
+		frames_data[i] = times[i].Value;
+		times_data[i] = tick_resolution.AsSeconds(times[i]);
+		values_data[i] = get_value(values[i]);
+		if (get_key_info)
+		{
+			get_key_info(values[i], interpolations_data[i], tangents_data + i * 2);
+		}
+	}
+
+	py_frames = ue_py_sequencer_typed_buffer(py_frames, "i");
+	py_times = ue_py_sequencer_typed_buffer(py_times, "d");
+	py_values = ue_py_sequencer_typed_buffer(py_values, "d");
+	if (py_interpolations)
+	{
+		py_interpolations = ue_py_sequencer_typed_buffer(py_interpolations, "B");
+		py_tangents = ue_py_sequencer_typed_buffer(py_tangents, "f");
+	}
+	if (!py_frames || !py_times || !py_values || (get_key_info && (!py_interpolations || !py_tangents)))
+	{
+		Py_XDECREF(py_frames);
+		Py_XDECREF(py_times);
+		Py_XDECREF(py_values);
+		Py_XDECREF(py_interpolations);
+		Py_XDECREF(py_tangents);
+		return nullptr;
+	}
+
+	PyObject *py_dict = PyDict_New();
+	PyDict_SetItemString(py_dict, "frames", py_frames);
+	Py_DECREF(py_frames);
+	PyDict_SetItemString(py_dict, "times", py_times);
+	Py_DECREF(py_times);
+	PyDict_SetItemString(py_dict, "values", py_values);
+	Py_DECREF(py_values);
+	if (py_interpolations)
+	{
+		PyDict_SetItemString(py_dict, "interpolation", py_interpolations);
+		Py_DECREF(py_interpolations);
+		PyDict_SetItemString(py_dict, "tangents", py_tangents);
+		Py_DECREF(py_tangents);
+	}
+	return py_dict;
+}
+
+PyObject *py_ue_sequencer_section_get_keys(ue_PyUObject *self, PyObject * args)
+{
+	ue_py_check(self);
+
+	int channel_filter = -1;
+	if (!PyArg_ParseTuple(args, "|i:sequencer_section_get_keys", &channel_filter))
+	{
+		return nullptr;
+	}
+
+	UMovieSceneSection *section = ue_py_check_type<UMovieSceneSection>(self);
+	if (!section)
+		return PyErr_Format(PyExc_Exception, "uobject is not a MovieSceneSection");
+
+	UMovieSceneTrack *Track = section->GetTypedOuter<UMovieSceneTrack>();
+	if (!Track)
+		return PyErr_Format(PyExc_Exception, "unable to retrieve track from section");
+	UMovieScene *MovieScene = Track->GetTypedOuter<UMovieScene>();
+	if (!MovieScene)
+		return PyErr_Format(PyExc_Exception, "unable to retrieve scene from section");
+
+	FFrameRate tick_resolution = MovieScene->GetTickResolution();
+	FMovieSceneChannelProxy &proxy = section->GetChannelProxy();
+
+	PyObject *py_list = PyList_New(0);
+
+#if ENGINE_MAJOR_VERSION == 5
+	TArrayView<FMovieSceneDoubleChannel *> double_channels = proxy.GetChannels<FMovieSceneDoubleChannel>();
+	if (double_channels.Num() > 0)
+	{
+		for (FMovieSceneDoubleChannel *channel : double_channels)
+		{
+			TMovieSceneChannelData<FMovieSceneDoubleValue> data = channel->GetData();
+			PyObject *py_keys = ue_py_sequencer_channel_keys_to_python<FMovieSceneDoubleValue>(tick_resolution, data.GetTimes(), data.GetValues(),
+				[](const FMovieSceneDoubleValue &value) { return value.Value; },
+				[](const FMovieSceneDoubleValue &value, uint8 &interpolation, float *tangents)
+			{
+				interpolation = ue_py_sequencer_get_key_interpolation(value.InterpMode, value.TangentMode);
+				tangents[0] = value.Tangent.ArriveTangent;
+				tangents[1] = value.Tangent.LeaveTangent;
+			});
+			if (!py_keys)
+			{
+				Py_DECREF(py_list);
+				return nullptr;
+			}
+			PyList_Append(py_list, py_keys);
+			Py_DECREF(py_keys);
+		}
+	}
+	else
+#endif
+	{
+		TArrayView<FMovieSceneFloatChannel *> float_channels = proxy.GetChannels<FMovieSceneFloatChannel>();
+		for (FMovieSceneFloatChannel *channel : float_channels)
+		{
+			TMovieSceneChannelData<FMovieSceneFloatValue> data = channel->GetData();
+			PyObject *py_keys = ue_py_sequencer_channel_keys_to_python<FMovieSceneFloatValue>(tick_resolution, data.GetTimes(), data.GetValues(),
+				[](const FMovieSceneFloatValue &value) { return (double)value.Value; },
+				[](const FMovieSceneFloatValue &value, uint8 &interpolation, float *tangents)
+			{
+				interpolation = ue_py_sequencer_get_key_interpolation(value.InterpMode, value.TangentMode);
+				tangents[0] = value.Tangent.ArriveTangent;
+				tangents[1] = value.Tangent.LeaveTangent;
+			});
+			if (!py_keys)
+			{
+				Py_DECREF(py_list);
+				return nullptr;
+			}
+			PyList_Append(py_list, py_keys);
+			Py_DECREF(py_keys);
+		}
+
+		if (float_channels.Num() == 0)
+		{
+			for (FMovieSceneBoolChannel *channel : proxy.GetChannels<FMovieSceneBoolChannel>())
+			{
+				TMovieSceneChannelData<bool> data = channel->GetData();
+				PyObject *py_keys = ue_py_sequencer_channel_keys_to_python<bool>(tick_resolution, data.GetTimes(), data.GetValues(),
+					[](const bool &value) { return value ? 1.0 : 0.0; }, nullptr);
+				if (!py_keys)
+				{
+					Py_DECREF(py_list);
+					return nullptr;
+				}
+				PyList_Append(py_list, py_keys);
+				Py_DECREF(py_keys);
+			}
+		}
+	}
+
+	if (channel_filter >= 0)
+	{
+		if (channel_filter >= PyList_Size(py_list))
+		{
+			Py_DECREF(py_list);
+			return PyErr_Format(PyExc_Exception, "invalid channel index");
+		}
+		PyObject *py_keys = PyList_GetItem(py_list, channel_filter);
+		Py_INCREF(py_keys);
+		Py_DECREF(py_list);
+		return py_keys;
+	}
+
+	return py_list;
+}
+#endif
+#endif
+
 PyObject *py_ue_sequencer_add_camera_cut_track(ue_PyUObject *self, PyObject * args)
 {
 
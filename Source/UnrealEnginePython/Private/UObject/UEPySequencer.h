@@ -21,6 +21,10 @@ PyObject *py_ue_sequencer_set_display_name(ue_PyUObject *, PyObject *);
 PyObject *py_ue_sequencer_get_display_name(ue_PyUObject *, PyObject *);
 PyObject *py_ue_sequencer_changed(ue_PyUObject *, PyObject *);
 PyObject *py_ue_sequencer_section_add_key(ue_PyUObject *, PyObject *);
+#if ENGINE_MAJOR_VERSION == 5 || (ENGINE_MAJOR_VERSION == 4 && ENGINE_MINOR_VERSION >= 20)
+PyObject *py_ue_sequencer_section_add_keys(ue_PyUObject *, PyObject *, PyObject *);
+PyObject *py_ue_sequencer_section_get_keys(ue_PyUObject *, PyObject *);
+#endif
 
 PyObject *py_ue_sequencer_add_camera_cut_track(ue_PyUObject *, PyObject *);
 
@@ -1,6 +1,7 @@
 #include "UEPySkeletal.h"
 
 #include "Runtime/Engine/Public/ComponentReregisterContext.h"
+#include "Async/ParallelFor.h"
 #if WITH_EDITOR
 #include "Developer/MeshUtilities/Public/MeshUtilities.h"
 #include "Wrappers/UEPyFMorphTargetDelta.h"
@@ -329,6 +330,412 @@ PyObject *py_ue_skeletal_mesh_get_soft_vertices(ue_PyUObject *self, PyObject * a
 
 	return py_list;
 }
+
+#if ENGINE_MAJOR_VERSION == 5
+#define UEPY_SKIN_WEIGHT_SCALE 65535.f
+typedef uint16 FPythonSkinWeight;
+#else
+#define UEPY_SKIN_WEIGHT_SCALE 255.f
+typedef uint8 FPythonSkinWeight;
+#endif
+
+// packed vertex buffers layout (number of components per vertex and component size)
+struct FPythonSoftVerticesBuffer
+{
+	const char *name;
+	int32 components;
+	int32 component_size;
+};
+
+static const FPythonSoftVerticesBuffer ue_py_soft_vertices_buffers[] = {
+	{ "position", 3, sizeof(float) },
+	{ "normal", 3, sizeof(float) },
+	{ "tangent", 3, sizeof(float) },
+	{ "binormal", 3, sizeof(float) },
+	{ "uv", MAX_TEXCOORDS * 2, sizeof(float) },
+	{ "color", 4, sizeof(uint8) },
+	{ "bone_index", MAX_TOTAL_INFLUENCES, sizeof(uint16) },
+	{ "bone_weight", MAX_TOTAL_INFLUENCES, sizeof(float) },
+};
+
+enum class EPythonSoftVerticesBuffer : int32
+{
+	Position,
+	Normal,
+	Tangent,
+	Binormal,
+	UV,
+	Color,
+	BoneIndex,
+	BoneWeight,
+	Num,
+};
+
+// get the bytes of a packed buffer from a dict, returns the number of vertices (-1 on error, -2 if the buffer is not in the dict)
+static int32 ue_py_soft_vertices_get_buffer(PyObject *py_dict, EPythonSoftVerticesBuffer buffer, Py_buffer *py_buf)
+{
+	const FPythonSoftVerticesBuffer &layout = ue_py_soft_vertices_buffers[(int32)buffer];
+	PyObject *py_value = PyDict_GetItemString(py_dict, layout.name);
+	if (!py_value || py_value == Py_None)
+		return -2;
+
+	if (PyObject_GetBuffer(py_value, py_buf, PyBUF_SIMPLE) < 0)
+	{
+		PyErr_Clear();
+		PyErr_Format(PyExc_Exception, "%s does not support the buffer protocol", layout.name);
+		return -1;
+	}
+
+	Py_ssize_t vertex_size = layout.components * layout.component_size;
+	if (py_buf->len % vertex_size != 0)
+	{
+		PyBuffer_Release(py_buf);
+		PyErr_Format(PyExc_Exception, "%s buffer size must be a multiple of %d", layout.name, (int)vertex_size);
+		return -1;
+	}
+
+	return (int32)(py_buf->len / vertex_size);
+}
+
+// fill soft vertices from a dict of packed buffers, missing buffers leave the current values untouched
+static bool ue_py_soft_vertices_from_buffers(PyObject *py_dict, TArray<FSoftSkinVertex> &soft_vertices, TArray<float> *weights = nullptr)
+{
+	if (!PyDict_Check(py_dict))
+	{
+		PyErr_SetString(PyExc_Exception, "argument is not a dict of buffers");
+		return false;
+	}
+
+	Py_buffer py_bufs[(int32)EPythonSoftVerticesBuffer::Num];
+	bool has_buf[(int32)EPythonSoftVerticesBuffer::Num];
+	int32 num_vertices = -1;
+	bool success = true;
+
+	for (int32 i = 0; i < (int32)EPythonSoftVerticesBuffer::Num; i++)
+	{
+		has_buf[i] = false;
+	}
+
+	for (int32 i = 0; i < (int32)EPythonSoftVerticesBuffer::Num; i++)
+	{
+		int32 buffer_vertices = ue_py_soft_vertices_get_buffer(py_dict, (EPythonSoftVerticesBuffer)i, &py_bufs[i]);
+		if (buffer_vertices == -2)
+			continue;
+		if (buffer_vertices < 0)
+		{
+			success = false;
+			break;
+		}
+		has_buf[i] = true;
+		if (num_vertices >= 0 && buffer_vertices != num_vertices)
+		{
+			PyErr_Format(PyExc_Exception, "%s buffer has %d vertices, expected %d", ue_py_soft_vertices_buffers[i].name, buffer_vertices, num_vertices);
+			success = false;
+			break;
+		}
+		num_vertices = buffer_vertices;
+	}
+
+	if (success && num_vertices < 0)
+	{
+		PyErr_SetString(PyExc_Exception, "no vertex buffer specified");
+		success = false;
+	}
+
+	if (success && num_vertices != soft_vertices.Num())
+	{
+		if (!has_buf[(int32)EPythonSoftVerticesBuffer::Position])
+		{
+			PyErr_Format(PyExc_Exception, "the number of vertices changed (%d -> %d), position buffer is required", soft_vertices.Num(), num_vertices);
+			success = false;
+		}
+		else
+		{
+			// new vertices start from a unit normal and a single full influence on the first bone
+			soft_vertices.Empty(num_vertices);
+			soft_vertices.AddZeroed(num_vertices);
+			for (FSoftSkinVertex &vertex : soft_vertices)
+			{
+				vertex.TangentZ.Z = 1;
+				vertex.Color = FColor::White;
+				vertex.InfluenceWeights[0] = (FPythonSkinWeight)UEPY_SKIN_WEIGHT_SCALE;
+			}
+		}
+	}
+
+	if (success)
+	{
+		if (weights)
+		{
+			weights->SetNumUninitialized(num_vertices * MAX_TOTAL_INFLUENCES);
+		}
+
+		const float *positions = has_buf[(int32)EPythonSoftVerticesBuffer::Position] ? (const float *)py_bufs[(int32)EPythonSoftVerticesBuffer::Position].buf : nullptr;
+		const float *normals = has_buf[(int32)EPythonSoftVerticesBuffer::Normal] ? (const float *)py_bufs[(int32)EPythonSoftVerticesBuffer::Normal].buf : nullptr;
+		const float *tangents = has_buf[(int32)EPythonSoftVerticesBuffer::Tangent] ? (const float *)py_bufs[(int32)EPythonSoftVerticesBuffer::Tangent].buf : nullptr;
+		const float *binormals = has_buf[(int32)EPythonSoftVerticesBuffer::Binormal] ? (const float *)py_bufs[(int32)EPythonSoftVerticesBuffer::Binormal].buf : nullptr;
+		const float *uvs = has_buf[(int32)EPythonSoftVerticesBuffer::UV] ? (const float *)py_bufs[(int32)EPythonSoftVerticesBuffer::UV].buf : nullptr;
+		const uint8 *colors = has_buf[(int32)EPythonSoftVerticesBuffer::Color] ? (const uint8 *)py_bufs[(int32)EPythonSoftVerticesBuffer::Color].buf : nullptr;
+		const uint16 *bone_indices = has_buf[(int32)EPythonSoftVerticesBuffer::BoneIndex] ? (const uint16 *)py_bufs[(int32)EPythonSoftVerticesBuffer::BoneIndex].buf : nullptr;
+		const float *bone_weights = has_buf[(int32)EPythonSoftVerticesBuffer::BoneWeight] ? (const float *)py_bufs[(int32)EPythonSoftVerticesBuffer::BoneWeight].buf : nullptr;
+
+		for (int32 v = 0; v < num_vertices; v++)
+		{
+			FSoftSkinVertex &vertex = soft_vertices[v];
+			if (positions)
+			{
+				vertex.Position.X = positions[v * 3];
+				vertex.Position.Y = positions[v * 3 + 1];
+				vertex.Position.Z = positions[v * 3 + 2];
+			}
+			if (normals)
+			{
+				vertex.TangentZ.X = normals[v * 3];
+				vertex.TangentZ.Y = normals[v * 3 + 1];
+				vertex.TangentZ.Z = normals[v * 3 + 2];
+			}
+			if (tangents)
+			{
+				vertex.TangentX.X = tangents[v * 3];
+				vertex.TangentX.Y = tangents[v * 3 + 1];
+				vertex.TangentX.Z = tangents[v * 3 + 2];
+			}
+			if (binormals)
+			{
+				vertex.TangentY.X = binormals[v * 3];
+				vertex.TangentY.Y = binormals[v * 3 + 1];
+				vertex.TangentY.Z = binormals[v * 3 + 2];
+			}
+			if (uvs)
+			{
+				for (int32 i = 0; i < MAX_TEXCOORDS; i++)
+				{
+					vertex.UVs[i].X = uvs[(v * MAX_TEXCOORDS + i) * 2];
+					vertex.UVs[i].Y = uvs[(v * MAX_TEXCOORDS + i) * 2 + 1];
+				}
+			}
+			if (colors)
+			{
+				vertex.Color = FColor(colors[v * 4], colors[v * 4 + 1], colors[v * 4 + 2], colors[v * 4 + 3]);
+			}
+			for (int32 i = 0; i < MAX_TOTAL_INFLUENCES; i++)
+			{
+				if (bone_indices)
+				{
+					vertex.InfluenceBones[i] = bone_indices[v * MAX_TOTAL_INFLUENCES + i];
+				}
+				if (bone_weights)
+				{
+					vertex.InfluenceWeights[i] = (FPythonSkinWeight)FMath::Clamp(FMath::RoundToInt(bone_weights[v * MAX_TOTAL_INFLUENCES + i] * UEPY_SKIN_WEIGHT_SCALE), 0, (int32)UEPY_SKIN_WEIGHT_SCALE);
+				}
+				if (weights)
+				{
+					(*weights)[v * MAX_TOTAL_INFLUENCES + i] = bone_weights ? bone_weights[v * MAX_TOTAL_INFLUENCES + i] : vertex.InfluenceWeights[i] / UEPY_SKIN_WEIGHT_SCALE;
+				}
+			}
+		}
+	}
+
+	for (int32 i = 0; i < (int32)EPythonSoftVerticesBuffer::Num; i++)
+	{
+		if (has_buf[i])
+		{
+			PyBuffer_Release(&py_bufs[i]);
+		}
+	}
+
+	return success;
+}
+
+PyObject *py_ue_skeletal_mesh_get_soft_vertices_buffers(ue_PyUObject *self, PyObject * args)
+{
+	ue_py_check(self);
+
+	int lod_index = 0;
+	int section_index = 0;
+	if (!PyArg_ParseTuple(args, "|ii:skeletal_mesh_get_soft_vertices_buffers", &lod_index, &section_index))
+		return nullptr;
+
+	USkeletalMesh *mesh = ue_py_check_type<USkeletalMesh>(self);
+	if (!mesh)
+		return PyErr_Format(PyExc_Exception, "uobject is not a USkeletalMesh");
+
+#if !(ENGINE_MAJOR_VERSION == 5 || (ENGINE_MAJOR_VERSION == 4 && ENGINE_MINOR_VERSION >= 19))
+	FSkeletalMeshResource *resource = mesh->GetImportedResource();
+#else
+	FSkeletalMeshModel *resource = mesh->GetImportedModel();
+#endif
+
+	if (lod_index < 0 || lod_index >= resource->LODModels.Num())
+		return PyErr_Format(PyExc_Exception, "invalid LOD index, must be between 0 and %d", resource->LODModels.Num() - 1);
+
+#if !(ENGINE_MAJOR_VERSION == 5 || (ENGINE_MAJOR_VERSION == 4 && ENGINE_MINOR_VERSION >= 19))
+	FStaticLODModel &model = resource->LODModels[lod_index];
+#else
+	FSkeletalMeshLODModel &model = resource->LODModels[lod_index];
+#endif
+
+	if (section_index < 0 || section_index >= model.Sections.Num())
+		return PyErr_Format(PyExc_Exception, "invalid Section index, must be between 0 and %d", model.Sections.Num() - 1);
+
+	const TArray<FSoftSkinVertex> &soft_vertices = model.Sections[section_index].SoftVertices;
+	const int32 num_vertices = soft_vertices.Num();
+
+	PyObject *py_bufs[(int32)EPythonSoftVerticesBuffer::Num];
+	for (int32 i = 0; i < (int32)EPythonSoftVerticesBuffer::Num; i++)
+	{
+		py_bufs[i] = PyByteArray_FromStringAndSize(nullptr, (Py_ssize_t)num_vertices * ue_py_soft_vertices_buffers[i].components * ue_py_soft_vertices_buffers[i].component_size);
+	}
+
+	float *positions = (float *)PyByteArray_AsString(py_bufs[(int32)EPythonSoftVerticesBuffer::Position]);
+	float *normals = (float *)PyByteArray_AsString(py_bufs[(int32)EPythonSoftVerticesBuffer::Normal]);
+	float *tangents = (float *)PyByteArray_AsString(py_bufs[(int32)EPythonSoftVerticesBuffer::Tangent]);
+	float *binormals = (float *)PyByteArray_AsString(py_bufs[(int32)EPythonSoftVerticesBuffer::Binormal]);
+	float *uvs = (float *)PyByteArray_AsString(py_bufs[(int32)EPythonSoftVerticesBuffer::UV]);
+	uint8 *colors = (uint8 *)PyByteArray_AsString(py_bufs[(int32)EPythonSoftVerticesBuffer::Color]);
+	uint16 *bone_indices = (uint16 *)PyByteArray_AsString(py_bufs[(int32)EPythonSoftVerticesBuffer::BoneIndex]);
+	float *bone_weights = (float *)PyByteArray_AsString(py_bufs[(int32)EPythonSoftVerticesBuffer::BoneWeight]);
+
+	for (int32 v = 0; v < num_vertices; v++)
+	{
+		const FSoftSkinVertex &vertex = soft_vertices[v];
+		positions[v * 3] = vertex.Position.X;
+		positions[v * 3 + 1] = vertex.Position.Y;
+		positions[v * 3 + 2] = vertex.Position.Z;
+		normals[v * 3] = vertex.TangentZ.X;
+		normals[v * 3 + 1] = vertex.TangentZ.Y;
+		normals[v * 3 + 2] = vertex.TangentZ.Z;
+		tangents[v * 3] = vertex.TangentX.X;
+		tangents[v * 3 + 1] = vertex.TangentX.Y;
+		tangents[v * 3 + 2] = vertex.TangentX.Z;
+		binormals[v * 3] = vertex.TangentY.X;
+		binormals[v * 3 + 1] = vertex.TangentY.Y;
+		binormals[v * 3 + 2] = vertex.TangentY.Z;
+		for (int32 i = 0; i < MAX_TEXCOORDS; i++)
+		{
+			uvs[(v * MAX_TEXCOORDS + i) * 2] = vertex.UVs[i].X;
+			uvs[(v * MAX_TEXCOORDS + i) * 2 + 1] = vertex.UVs[i].Y;
+		}
+		colors[v * 4] = vertex.Color.R;
+		colors[v * 4 + 1] = vertex.Color.G;
+		colors[v * 4 + 2] = vertex.Color.B;
+		colors[v * 4 + 3] = vertex.Color.A;
+		for (int32 i = 0; i < MAX_TOTAL_INFLUENCES; i++)
+		{
+			bone_indices[v * MAX_TOTAL_INFLUENCES + i] = vertex.InfluenceBones[i];
+			bone_weights[v * MAX_TOTAL_INFLUENCES + i] = vertex.InfluenceWeights[i] / UEPY_SKIN_WEIGHT_SCALE;
+		}
+	}
+
+	PyObject *py_dict = PyDict_New();
+	for (int32 i = 0; i < (int32)EPythonSoftVerticesBuffer::Num; i++)
+	{
+		PyDict_SetItemString(py_dict, ue_py_soft_vertices_buffers[i].name, py_bufs[i]);
+		Py_DECREF(py_bufs[i]);
+	}
+
+	// the bone map allows converting bone indices to skeleton bones
+	PyObject *py_bone_map = PyByteArray_FromStringAndSize((const char *)model.Sections[section_index].BoneMap.GetData(), model.Sections[section_index].BoneMap.Num() * sizeof(FBoneIndexType));
+	PyDict_SetItemString(py_dict, "bone_map", py_bone_map);
+	Py_DECREF(py_bone_map);
+
+	PyObject *py_num = PyLong_FromLong(num_vertices);
+	PyDict_SetItemString(py_dict, "num_vertices", py_num);
+	Py_DECREF(py_num);
+	py_num = PyLong_FromLong(MAX_TEXCOORDS);
+	PyDict_SetItemString(py_dict, "num_uvs", py_num);
+	Py_DECREF(py_num);
+	py_num = PyLong_FromLong(MAX_TOTAL_INFLUENCES);
+	PyDict_SetItemString(py_dict, "num_influences", py_num);
+	Py_DECREF(py_num);
+
+	return py_dict;
+}
+
+PyObject *py_ue_skeletal_mesh_set_soft_vertices_buffers(ue_PyUObject *self, PyObject * args)
+{
+	ue_py_check(self);
+
+	PyObject *py_buffers;
+	int lod_index = 0;
+	int section_index = 0;
+	if (!PyArg_ParseTuple(args, "O|ii:skeletal_mesh_set_soft_vertices_buffers", &py_buffers, &lod_index, &section_index))
+		return nullptr;
+
+	USkeletalMesh *mesh = ue_py_check_type<USkeletalMesh>(self);
+	if (!mesh)
+		return PyErr_Format(PyExc_Exception, "uobject is not a USkeletalMesh");
+
+#if !(ENGINE_MAJOR_VERSION == 5 || (ENGINE_MAJOR_VERSION == 4 && ENGINE_MINOR_VERSION >= 19))
+	FSkeletalMeshResource *resource = mesh->GetImportedResource();
+#else
+	FSkeletalMeshModel *resource = mesh->GetImportedModel();
+#endif
+
+	if (lod_index < 0 || lod_index >= resource->LODModels.Num())
+		return PyErr_Format(PyExc_Exception, "invalid LOD index, must be between 0 and %d", resource->LODModels.Num() - 1);
+
+#if !(ENGINE_MAJOR_VERSION == 5 || (ENGINE_MAJOR_VERSION == 4 && ENGINE_MINOR_VERSION >= 19))
+	FStaticLODModel &model = resource->LODModels[lod_index];
+#else
+	FSkeletalMeshLODModel &model = resource->LODModels[lod_index];
+#endif
+
+	// a list of dicts updates multiple sections (starting from 0) with a single rebuild
+	TArray<TPair<int32, PyObject *>> sections;
+	if (PyList_Check(py_buffers) || PyTuple_Check(py_buffers))
+	{
+		for (Py_ssize_t i = 0; i < PySequence_Size(py_buffers); i++)
+		{
+			PyObject *py_item = PySequence_GetItem(py_buffers, i);
+			Py_DECREF(py_item);
+			if (py_item == Py_None)
+				continue;
+			sections.Add(TPair<int32, PyObject *>(i, py_item));
+		}
+	}
+	else
+	{
+		sections.Add(TPair<int32, PyObject *>(section_index, py_buffers));
+	}
+
+	// build the new vertices before touching the mesh
+	TArray<TArray<FSoftSkinVertex>> new_vertices;
+	for (TPair<int32, PyObject *> &section : sections)
+	{
+		if (section.Key < 0 || section.Key >= model.Sections.Num())
+			return PyErr_Format(PyExc_Exception, "invalid Section index, must be between 0 and %d", model.Sections.Num() - 1);
+
+		TArray<FSoftSkinVertex> soft_vertices = model.Sections[section.Key].SoftVertices;
+		if (!ue_py_soft_vertices_from_buffers(section.Value, soft_vertices))
+			return nullptr;
+		new_vertices.Add(MoveTemp(soft_vertices));
+	}
+
+	// temporarily disable all USkinnedMeshComponent's
+	TComponentReregisterContext<USkinnedMeshComponent> ReregisterContext;
+
+	mesh->ReleaseResources();
+	mesh->ReleaseResourcesFence.Wait();
+
+	for (int32 i = 0; i < sections.Num(); i++)
+	{
+		FSkelMeshSection &section = model.Sections[sections[i].Key];
+		section.SoftVertices = MoveTemp(new_vertices[i]);
+		section.NumVertices = section.SoftVertices.Num();
+		section.CalcMaxBoneInfluences();
+	}
+
+	mesh->GetRefBasesInvMatrix().Empty();
+	mesh->CalculateInvRefMatrices();
+
+	mesh->PostEditChange();
+
+	mesh->InitResources();
+	mesh->MarkPackageDirty();
+
+	Py_RETURN_NONE;
+}
 #endif
 
 PyObject *py_ue_skeletal_mesh_get_lod(ue_PyUObject *self, PyObject * args)
@@ -905,6 +1312,72 @@ PyObject *py_ue_skeletal_mesh_build_lod(ue_PyUObject *self, PyObject * args, PyO
 	if (lod_index < 0 || lod_index > resource->LODModels.Num())
 		return PyErr_Format(PyExc_Exception, "invalid LOD index, must be between 0 and %d", resource->LODModels.Num());
 
+	TArray<FSoftSkinVertex> soft_vertices;
+	TArray<float> weights;
+	TArray<uint16> material_indices;
+	TArray<uint32> smoothing_groups;
+
+	// a dict of packed buffers (as returned by skeletal_mesh_get_soft_vertices_buffers)
+	if (PyDict_Check(py_ss_vertex))
+	{
+		if (!ue_py_soft_vertices_from_buffers(py_ss_vertex, soft_vertices, &weights))
+			return nullptr;
+
+		material_indices.AddZeroed(soft_vertices.Num());
+		smoothing_groups.AddZeroed(soft_vertices.Num());
+
+		const char *per_vertex_names[] = { "material_index", "smoothing_group" };
+		for (int32 i = 0; i < 2; i++)
+		{
+			PyObject *py_value = PyDict_GetItemString(py_ss_vertex, per_vertex_names[i]);
+			if (!py_value || py_value == Py_None)
+				continue;
+			Py_buffer py_buf;
+			if (PyObject_GetBuffer(py_value, &py_buf, PyBUF_SIMPLE) < 0)
+				return PyErr_Format(PyExc_Exception, "%s does not support the buffer protocol", per_vertex_names[i]);
+			const Py_ssize_t expected_len = i == 0 ? material_indices.Num() * sizeof(uint16) : smoothing_groups.Num() * sizeof(uint32);
+			if (py_buf.len != expected_len)
+			{
+				PyBuffer_Release(&py_buf);
+				return PyErr_Format(PyExc_Exception, "%s buffer must be %d bytes", per_vertex_names[i], (int)expected_len);
+			}
+			FMemory::Memcpy(i == 0 ? (void *)material_indices.GetData() : (void *)smoothing_groups.GetData(), py_buf.buf, py_buf.len);
+			PyBuffer_Release(&py_buf);
+		}
+	}
+	else
+	{
+		PyObject *py_iter = PyObject_GetIter(py_ss_vertex);
+		if (!py_iter)
+		{
+			return PyErr_Format(PyExc_Exception, "argument is not an iterable of FSoftSkinVertex");
+		}
+
+		while (PyObject *py_item = PyIter_Next(py_iter))
+		{
+			ue_PyFSoftSkinVertex *ss_vertex = py_ue_is_fsoft_skin_vertex(py_item);
+			if (!ss_vertex)
+			{
+				Py_DECREF(py_item);
+				Py_DECREF(py_iter);
+				return PyErr_Format(PyExc_Exception, "argument is not an iterable of FSoftSkinVertex");
+			}
+			soft_vertices.Add(ss_vertex->ss_vertex);
+			for (int32 i = 0; i < MAX_TOTAL_INFLUENCES; i++)
+			{
+				weights.Add(ss_vertex->ss_vertex.InfluenceWeights[i] / 255.f);
+			}
+			material_indices.Add(ss_vertex->material_index);
+			smoothing_groups.Add(ss_vertex->smoothing_group);
+			Py_DECREF(py_item);
+		}
+
+		Py_DECREF(py_iter);
+	}
+
+	if (soft_vertices.Num() % 3 != 0)
+		return PyErr_Format(PyExc_Exception, "invalid number of FSoftSkinVertex, must be a multiple of 3");
+
 	mesh->PreEditChange(nullptr);
 
 	if (lod_index == resource->LODModels.Num())
@@ -956,14 +1429,6 @@ PyObject *py_ue_skeletal_mesh_build_lod(ue_PyUObject *self, PyObject * args, PyO
 
 	IMeshUtilities & MeshUtilities = FModuleManager::Get().LoadModuleChecked<IMeshUtilities>("MeshUtilities");
 
-	PyObject *py_iter = PyObject_GetIter(py_ss_vertex);
-	if (!py_iter)
-	{
-		return PyErr_Format(PyExc_Exception, "argument is not an iterable of FSoftSkinVertex");
-	}
-
-	TArray<FSoftSkinVertex> soft_vertices;
-
 #if ENGINE_MAJOR_VERSION == 5
 	TArray<FVector3f> points;
 #else
@@ -989,18 +1454,11 @@ PyObject *py_ue_skeletal_mesh_build_lod(ue_PyUObject *self, PyObject * args, PyO
 	TArray<FVector> tangentsY;
 	TArray<FVector> tangentsZ;
 #endif
-	TArray<uint16> material_indices;
-	TArray<uint32> smoothing_groups;
 
-	while (PyObject *py_item = PyIter_Next(py_iter))
+	for (int32 v = 0; v < soft_vertices.Num(); v++)
 	{
-		ue_PyFSoftSkinVertex *ss_vertex = py_ue_is_fsoft_skin_vertex(py_item);
-		if (!ss_vertex)
-		{
-			Py_DECREF(py_iter);
-			return PyErr_Format(PyExc_Exception, "argument is not an iterable of FSoftSkinVertex");
-		}
-		int32 vertex_index = points.Add(ss_vertex->ss_vertex.Position);
+		const FSoftSkinVertex &ss_vertex = soft_vertices[v];
+		int32 vertex_index = points.Add(ss_vertex.Position);
 
 		points_to_map.Add(vertex_index);
 
@@ -1010,10 +1468,10 @@ PyObject *py_ue_skeletal_mesh_build_lod(ue_PyUObject *self, PyObject * args, PyO
 		FMeshWedge wedge;
 #endif
 		wedge.iVertex = vertex_index;
-		wedge.Color = ss_vertex->ss_vertex.Color;
+		wedge.Color = ss_vertex.Color;
 		for (int32 i = 0; i < MAX_TEXCOORDS; i++)
 		{
-			wedge.UVs[i] = ss_vertex->ss_vertex.UVs[i];
+			wedge.UVs[i] = ss_vertex.UVs[i];
 		}
 		int32 wedge_index = wedges.Add(wedge);
 
@@ -1025,24 +1483,16 @@ PyObject *py_ue_skeletal_mesh_build_lod(ue_PyUObject *self, PyObject * args, PyO
 			FVertInfluence influence;
 #endif
 			influence.VertIndex = wedge_index;
-			influence.BoneIndex = ss_vertex->ss_vertex.InfluenceBones[i];
-			influence.Weight = ss_vertex->ss_vertex.InfluenceWeights[i] / 255.f;
+			influence.BoneIndex = ss_vertex.InfluenceBones[i];
+			influence.Weight = weights[v * MAX_TOTAL_INFLUENCES + i];
 			influences.Add(influence);
 		}
 
-		tangentsX.Add(ss_vertex->ss_vertex.TangentX);
-		tangentsY.Add(ss_vertex->ss_vertex.TangentY);
-		tangentsZ.Add(ss_vertex->ss_vertex.TangentZ);
-
-		material_indices.Add(ss_vertex->material_index);
-		smoothing_groups.Add(ss_vertex->smoothing_group);
+		tangentsX.Add(ss_vertex.TangentX);
+		tangentsY.Add(ss_vertex.TangentY);
+		tangentsZ.Add(ss_vertex.TangentZ);
 	}
 
-	Py_DECREF(py_iter);
-
-	if (wedges.Num() % 3 != 0)
-		return PyErr_Format(PyExc_Exception, "invalid number of FSoftSkinVertex, must be a multiple of 3");
-
 	for (int32 i = 0; i < wedges.Num(); i += 3)
 	{
 #if ENGINE_MAJOR_VERSION == 5 || (ENGINE_MAJOR_VERSION == 4 && ENGINE_MINOR_VERSION > 20)
@@ -1249,6 +1699,319 @@ PyObject *py_ue_morph_target_get_deltas(ue_PyUObject *self, PyObject * args)
 	return py_list;
 }
 
+// sparse morph target deltas as packed buffers: indices (uint32), position and tangent (3 x float32)
+struct FPythonMorphDeltasBuffers
+{
+	Py_buffer Indices;
+	Py_buffer Positions;
+	Py_buffer Tangents;
+	bool bHasIndices = false;
+	bool bHasPositions = false;
+	bool bHasTangents = false;
+	int32 Num = 0;
+
+	~FPythonMorphDeltasBuffers()
+	{
+		Release();
+	}
+
+	bool Acquire(PyObject *py_dict)
+	{
+		if (!PyDict_Check(py_dict))
+		{
+			PyErr_SetString(PyExc_Exception, "morph target deltas must be a dict of buffers");
+			return false;
+		}
+
+		PyObject *py_positions = PyDict_GetItemString(py_dict, "position");
+		if (!py_positions || PyObject_GetBuffer(py_positions, &Positions, PyBUF_SIMPLE) < 0)
+		{
+			PyErr_Clear();
+			PyErr_SetString(PyExc_Exception, "position buffer is required");
+			return false;
+		}
+		bHasPositions = true;
+
+		if (Positions.len % (sizeof(float) * 3) != 0)
+		{
+			PyErr_SetString(PyExc_Exception, "position buffer size must be a multiple of 12 (3 x float32)");
+			return false;
+		}
+		Num = (int32)(Positions.len / (sizeof(float) * 3));
+
+		PyObject *py_tangents = PyDict_GetItemString(py_dict, "tangent");
+		if (py_tangents && py_tangents != Py_None)
+		{
+			if (PyObject_GetBuffer(py_tangents, &Tangents, PyBUF_SIMPLE) < 0)
+				return false;
+			bHasTangents = true;
+			if (Tangents.len != Positions.len)
+			{
+				PyErr_SetString(PyExc_Exception, "tangent buffer must have the same size of the position buffer");
+				return false;
+			}
+		}
+
+		// without indices the buffers are dense (one delta per vertex)
+		PyObject *py_indices = PyDict_GetItemString(py_dict, "indices");
+		if (py_indices && py_indices != Py_None)
+		{
+			if (PyObject_GetBuffer(py_indices, &Indices, PyBUF_SIMPLE) < 0)
+				return false;
+			bHasIndices = true;
+			if (Indices.len != (Py_ssize_t)Num * (Py_ssize_t)sizeof(uint32))
+			{
+				PyErr_SetString(PyExc_Exception, "indices buffer must contain a uint32 for each delta");
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	void Release()
+	{
+		if (bHasIndices)
+			PyBuffer_Release(&Indices);
+		if (bHasPositions)
+			PyBuffer_Release(&Positions);
+		if (bHasTangents)
+			PyBuffer_Release(&Tangents);
+		bHasIndices = bHasPositions = bHasTangents = false;
+	}
+
+	// does not touch python objects, so it can run without the GIL; returns the first invalid vertex index (or -1)
+	int64 Build(TArray<FMorphTargetDelta> &deltas, uint32 num_vertices, float threshold) const
+	{
+		const uint32 *indices = bHasIndices ? (const uint32 *)Indices.buf : nullptr;
+		const float *positions = (const float *)Positions.buf;
+		const float *tangents = bHasTangents ? (const float *)Tangents.buf : nullptr;
+		const float threshold_squared = threshold * threshold;
+
+		deltas.Reset(Num);
+		for (int32 i = 0; i < Num; i++)
+		{
+			const uint32 index = indices ? indices[i] : (uint32)i;
+			if (index >= num_vertices)
+				return index;
+
+			FMorphTargetDelta delta;
+			delta.SourceIdx = index;
+#if ENGINE_MAJOR_VERSION == 5
+			delta.PositionDelta = FVector3f(positions[i * 3], positions[i * 3 + 1], positions[i * 3 + 2]);
+			delta.TangentZDelta = tangents ? FVector3f(tangents[i * 3], tangents[i * 3 + 1], tangents[i * 3 + 2]) : FVector3f::ZeroVector;
+#else
+			delta.PositionDelta = FVector(positions[i * 3], positions[i * 3 + 1], positions[i * 3 + 2]);
+			delta.TangentZDelta = tangents ? FVector(tangents[i * 3], tangents[i * 3 + 1], tangents[i * 3 + 2]) : FVector::ZeroVector;
+#endif
+			// sparsification: skip vertices that do not move
+			if (threshold > 0 && delta.PositionDelta.SizeSquared() < threshold_squared && delta.TangentZDelta.SizeSquared() < threshold_squared)
+				continue;
+			deltas.Add(delta);
+		}
+		return -1;
+	}
+};
+
+static bool ue_py_morph_target_build_deltas(TArray<FPythonMorphDeltasBuffers> &buffers, TArray<TArray<FMorphTargetDelta>> &deltas, uint32 num_vertices, float threshold)
+{
+	deltas.SetNum(buffers.Num());
+	TArray<int64> errors;
+	errors.SetNum(buffers.Num());
+
+	Py_BEGIN_ALLOW_THREADS;
+	ParallelFor(buffers.Num(), [&](int32 Index)
+	{
+		errors[Index] = buffers[Index].Build(deltas[Index], num_vertices, threshold);
+	});
+	Py_END_ALLOW_THREADS;
+
+	for (int64 error : errors)
+	{
+		if (error >= 0)
+		{
+			PyErr_Format(PyExc_Exception, "invalid vertex index %lld, the LOD has %u vertices", error, num_vertices);
+			return false;
+		}
+	}
+	return true;
+}
+
+PyObject *py_ue_morph_target_populate_deltas_buffer(ue_PyUObject *self, PyObject * args, PyObject * kwargs)
+{
+	ue_py_check(self);
+
+	PyObject *py_deltas;
+	int lod_index = 0;
+	float threshold = 0;
+
+	static char *kw_names[] = { (char *)"deltas", (char *)"lod", (char *)"threshold", nullptr };
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O|if:morph_target_populate_deltas_buffer", kw_names, &py_deltas, &lod_index, &threshold))
+	{
+		return nullptr;
+	}
+
+	UMorphTarget *morph = ue_py_check_type<UMorphTarget>(self);
+	if (!morph)
+		return PyErr_Format(PyExc_Exception, "uobject is not a MorphTarget");
+
+	if (!morph->BaseSkelMesh)
+		return PyErr_Format(PyExc_Exception, "MorphTarget has no base SkeletalMesh");
+
+	FSkeletalMeshModel *model = morph->BaseSkelMesh->GetImportedModel();
+	if (lod_index < 0 || lod_index >= model->LODModels.Num())
+		return PyErr_Format(PyExc_Exception, "invalid LOD index");
+
+	TArray<FPythonMorphDeltasBuffers> buffers;
+	buffers.SetNum(1);
+	if (!buffers[0].Acquire(py_deltas))
+		return nullptr;
+
+	TArray<TArray<FMorphTargetDelta>> deltas;
+	if (!ue_py_morph_target_build_deltas(buffers, deltas, model->LODModels[lod_index].NumVertices, threshold))
+		return nullptr;
+	buffers.Empty();
+
+	morph->PopulateDeltas(deltas[0], lod_index, model->LODModels[lod_index].Sections);
+
+	if (morph->HasValidData())
+	{
+		Py_RETURN_TRUE;
+	}
+
+	Py_RETURN_FALSE;
+}
+
+PyObject *py_ue_morph_target_get_deltas_buffer(ue_PyUObject *self, PyObject * args)
+{
+	ue_py_check(self);
+
+	int lod_index = 0;
+
+	if (!PyArg_ParseTuple(args, "|i:morph_target_get_deltas_buffer", &lod_index))
+	{
+		return nullptr;
+	}
+
+	UMorphTarget *morph = ue_py_check_type<UMorphTarget>(self);
+	if (!morph)
+		return PyErr_Format(PyExc_Exception, "uobject is not a MorphTarget");
+
+#if ENGINE_MAJOR_VERSION == 5
+	const TArray<FMorphTargetLODModel> &lod_models = morph->GetMorphLODModels();
+#else
+	const TArray<FMorphTargetLODModel> &lod_models = morph->MorphLODModels;
+#endif
+	if (lod_index < 0 || lod_index >= lod_models.Num())
+		return PyErr_Format(PyExc_Exception, "invalid LOD index");
+
+	const TArray<FMorphTargetDelta> &vertices = lod_models[lod_index].Vertices;
+
+	PyObject *py_indices = PyByteArray_FromStringAndSize(nullptr, vertices.Num() * sizeof(uint32));
+	PyObject *py_positions = PyByteArray_FromStringAndSize(nullptr, vertices.Num() * sizeof(float) * 3);
+	PyObject *py_tangents = PyByteArray_FromStringAndSize(nullptr, vertices.Num() * sizeof(float) * 3);
+	uint32 *indices = (uint32 *)PyByteArray_AsString(py_indices);
+	float *positions = (float *)PyByteArray_AsString(py_positions);
+	float *tangents = (float *)PyByteArray_AsString(py_tangents);
+
+	for (int32 i = 0; i < vertices.Num(); i++)
+	{
+		const FMorphTargetDelta &delta = vertices[i];
+		indices[i] = delta.SourceIdx;
+		positions[i * 3] = delta.PositionDelta.X;
+		positions[i * 3 + 1] = delta.PositionDelta.Y;
+		positions[i * 3 + 2] = delta.PositionDelta.Z;
+		tangents[i * 3] = delta.TangentZDelta.X;
+		tangents[i * 3 + 1] = delta.TangentZDelta.Y;
+		tangents[i * 3 + 2] = delta.TangentZDelta.Z;
+	}
+
+	PyObject *py_dict = PyDict_New();
+	PyDict_SetItemString(py_dict, "indices", py_indices);
+	Py_DECREF(py_indices);
+	PyDict_SetItemString(py_dict, "position", py_positions);
+	Py_DECREF(py_positions);
+	PyDict_SetItemString(py_dict, "tangent", py_tangents);
+	Py_DECREF(py_tangents);
+
+	return py_dict;
+}
+
+PyObject *py_ue_skeletal_mesh_add_morph_targets(ue_PyUObject *self, PyObject * args, PyObject * kwargs)
+{
+	ue_py_check(self);
+
+	PyObject *py_morphs;
+	int lod_index = 0;
+	float threshold = 0;
+
+	static char *kw_names[] = { (char *)"morphs", (char *)"lod", (char *)"threshold", nullptr };
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O|if:skeletal_mesh_add_morph_targets", kw_names, &py_morphs, &lod_index, &threshold))
+	{
+		return nullptr;
+	}
+
+	USkeletalMesh *mesh = ue_py_check_type<USkeletalMesh>(self);
+	if (!mesh)
+		return PyErr_Format(PyExc_Exception, "uobject is not a SkeletalMesh");
+
+	if (!PyDict_Check(py_morphs))
+		return PyErr_Format(PyExc_Exception, "argument is not a dict of morph target names and deltas buffers");
+
+	FSkeletalMeshModel *model = mesh->GetImportedModel();
+	if (lod_index < 0 || lod_index >= model->LODModels.Num())
+		return PyErr_Format(PyExc_Exception, "invalid LOD index");
+
+	TArray<FName> names;
+	TArray<FPythonMorphDeltasBuffers> buffers;
+	buffers.SetNum(PyDict_Size(py_morphs));
+
+	PyObject *py_key;
+	PyObject *py_value;
+	Py_ssize_t pos = 0;
+	while (PyDict_Next(py_morphs, &pos, &py_key, &py_value))
+	{
+		if (!PyUnicodeOrString_Check(py_key))
+			return PyErr_Format(PyExc_Exception, "morph target names must be strings");
+		if (!buffers[names.Num()].Acquire(py_value))
+			return nullptr;
+		names.Add(FName(UTF8_TO_TCHAR(UEPyUnicode_AsUTF8(py_key))));
+	}
+
+	// convert (and sparsify) all of the morph targets in parallel
+	TArray<TArray<FMorphTargetDelta>> deltas;
+	if (!ue_py_morph_target_build_deltas(buffers, deltas, model->LODModels[lod_index].NumVertices, threshold))
+		return nullptr;
+	buffers.Empty();
+
+	mesh->PreEditChange(nullptr);
+
+	PyObject *py_list = PyList_New(0);
+	for (int32 i = 0; i < names.Num(); i++)
+	{
+		UMorphTarget *morph = mesh->FindMorphTarget(names[i]);
+		if (!morph)
+		{
+			morph = NewObject<UMorphTarget>(mesh, names[i]);
+			morph->BaseSkelMesh = mesh;
+		}
+		morph->PopulateDeltas(deltas[i], lod_index, model->LODModels[lod_index].Sections);
+		// render data is rebuilt only once after all of the morph targets are registered
+		mesh->RegisterMorphTarget(morph, false);
+
+		PyObject *py_morph = (PyObject *)ue_get_python_uobject(morph);
+		if (py_morph)
+			PyList_Append(py_list, py_morph);
+	}
+
+	mesh->InitMorphTargetsAndRebuildRenderData();
+
+	mesh->PostEditChange();
+	mesh->MarkPackageDirty();
+
+	return py_list;
+}
+
 PyObject *py_ue_skeletal_mesh_to_import_vertex_map(ue_PyUObject *self, PyObject * args)
 {
 	ue_py_check(self);
@@ -16,6 +16,8 @@ PyObject *py_ue_skeleton_add_bone(ue_PyUObject *, PyObject *);
 
 PyObject *py_ue_skeletal_mesh_set_soft_vertices(ue_PyUObject *, PyObject *);
 PyObject *py_ue_skeletal_mesh_get_soft_vertices(ue_PyUObject *, PyObject *);
+PyObject *py_ue_skeletal_mesh_set_soft_vertices_buffers(ue_PyUObject *, PyObject *);
+PyObject *py_ue_skeletal_mesh_get_soft_vertices_buffers(ue_PyUObject *, PyObject *);
 PyObject *py_ue_skeletal_mesh_set_skeleton(ue_PyUObject *, PyObject *);
 PyObject *py_ue_skeletal_mesh_get_lod(ue_PyUObject *, PyObject *);
 PyObject *py_ue_skeletal_mesh_get_raw_indices(ue_PyUObject *, PyObject *);
@@ -35,4 +37,7 @@ PyObject *py_ue_skeletal_mesh_register_morph_target(ue_PyUObject *, PyObject *);
 
 PyObject *py_ue_morph_target_populate_deltas(ue_PyUObject *, PyObject *);
 PyObject *py_ue_morph_target_get_deltas(ue_PyUObject *, PyObject *);
+PyObject *py_ue_morph_target_populate_deltas_buffer(ue_PyUObject *, PyObject *, PyObject *);
+PyObject *py_ue_morph_target_get_deltas_buffer(ue_PyUObject *, PyObject *);
+PyObject *py_ue_skeletal_mesh_add_morph_targets(ue_PyUObject *, PyObject *, PyObject *);
 PyObject *py_ue_skeletal_mesh_to_import_vertex_map(ue_PyUObject *, PyObject *);
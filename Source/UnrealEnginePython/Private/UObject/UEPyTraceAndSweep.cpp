@@ -2,8 +2,10 @@
 
 #include "Kismet/KismetSystemLibrary.h"
 #include "Wrappers/UEPyFHitResult.h"
+#include "Wrappers/UEPyFMathArrays.h"
 #include "Kismet/GameplayStatics.h"
 #include "Engine/World.h"
+#include "Async/ParallelFor.h"
 
 PyObject *py_ue_line_trace_single_by_channel(ue_PyUObject * self, PyObject * args)
 {
@@ -165,3 +167,589 @@ PyObject *py_ue_draw_debug_line(ue_PyUObject * self, PyObject * args)
 
 	Py_RETURN_NONE;
 }
+
+bool ue_py_get_packed_vectors(PyObject *py_obj, TArray<FVector> &vectors)
+{
+	// FVectorArray exports a structure of arrays, not packed xyz triplets
+	if (py_ue_fvector_array_get(py_obj, vectors))
+		return true;
+
+	Py_buffer py_buf;
+	if (PyObject_GetBuffer(py_obj, &py_buf, PyBUF_FORMAT) < 0)
+	{
+		PyErr_Clear();
+		PyErr_SetString(PyExc_Exception, "argument does not support the buffer protocol");
+		return false;
+	}
+
+	// untyped buffers (bytes, bytearray) contain packed float64 values, typed ones must be float32 or float64
+	const char *format = py_buf.format;
+	if (format && (format[0] == '<' || format[0] == '=' || format[0] == '@'))
+		format++;
+	if (!format || PyBytes_Check(py_obj) || PyByteArray_Check(py_obj))
+		format = "d";
+	bool is_double = format[0] == 'd' && format[1] == 0;
+	bool is_float = format[0] == 'f' && format[1] == 0;
+	if (!is_double && !is_float)
+	{
+		PyBuffer_Release(&py_buf);
+		PyErr_SetString(PyExc_Exception, "buffer must contain float32 or float64 values");
+		return false;
+	}
+
+	Py_ssize_t vector_size = (is_double ? sizeof(double) : sizeof(float)) * 3;
+	if (py_buf.len % vector_size != 0)
+	{
+		PyBuffer_Release(&py_buf);
+		PyErr_Format(PyExc_Exception, "buffer size must be a multiple of %d", (int)vector_size);
+		return false;
+	}
+
+	int32 num = (int32)(py_buf.len / vector_size);
+	vectors.SetNumUninitialized(num);
+	if (is_double)
+	{
+		const double *data = (const double *)py_buf.buf;
+		for (int32 i = 0; i < num; i++)
+		{
+			vectors[i] = FVector(data[i * 3], data[i * 3 + 1], data[i * 3 + 2]);
+		}
+	}
+	else
+	{
+		const float *data = (const float *)py_buf.buf;
+		for (int32 i = 0; i < num; i++)
+		{
+			vectors[i] = FVector(data[i * 3], data[i * 3 + 1], data[i * 3 + 2]);
+		}
+	}
+
+	PyBuffer_Release(&py_buf);
+	return true;
+}
+
+// new reference to a python buffer with a copy of the data, typed (memoryview.cast) on python 3 so it can be passed back
+static PyObject *ue_py_trace_results_buffer(const void *data, Py_ssize_t len, const char *format)
+{
+	PyObject *py_bytearray = PyByteArray_FromStringAndSize((const char *)data, len);
+#if PY_MAJOR_VERSION >= 3
+	if (!py_bytearray)
+		return nullptr;
+	PyObject *py_view = PyMemoryView_FromObject(py_bytearray);
+	Py_DECREF(py_bytearray);
+	if (!py_view)
+		return nullptr;
+	PyObject *py_typed = PyObject_CallMethod(py_view, (char *)"cast", (char *)"s", format);
+	Py_DECREF(py_view);
+	return py_typed;
+#else
+	return py_bytearray;
+#endif
+}
+
+// packed results of a batch of traces/sweeps/overlaps
+struct FPythonBatchTraceResults
+{
+	TArray<uint8> Hits;
+	TArray<float> Distances;
+	TArray<float> Locations;
+	TArray<float> Normals;
+	TArray<TWeakObjectPtr<AActor>> Actors;
+
+	void Init(int32 Num)
+	{
+		Hits.SetNumZeroed(Num);
+		Distances.SetNumZeroed(Num);
+		Locations.SetNumZeroed(Num * 3);
+		Normals.SetNumZeroed(Num * 3);
+		Actors.SetNum(Num);
+	}
+
+	void SetHit(int32 Index, const FHitResult &Hit)
+	{
+		Hits[Index] = Hit.bBlockingHit ? 1 : 0;
+		Distances[Index] = Hit.Distance;
+		Locations[Index * 3] = Hit.ImpactPoint.X;
+		Locations[Index * 3 + 1] = Hit.ImpactPoint.Y;
+		Locations[Index * 3 + 2] = Hit.ImpactPoint.Z;
+		Normals[Index * 3] = Hit.ImpactNormal.X;
+		Normals[Index * 3 + 1] = Hit.ImpactNormal.Y;
+		Normals[Index * 3 + 2] = Hit.ImpactNormal.Z;
+		Actors[Index] = Hit.GetActor();
+	}
+
+	void SetOverlap(int32 Index, const FVector &Position, const TArray<FOverlapResult> &Overlaps)
+	{
+		Locations[Index * 3] = Position.X;
+		Locations[Index * 3 + 1] = Position.Y;
+		Locations[Index * 3 + 2] = Position.Z;
+		// the first blocking overlap wins, otherwise the first one
+		for (const FOverlapResult &Overlap : Overlaps)
+		{
+			if (Overlap.bBlockingHit || !Hits[Index])
+			{
+				Hits[Index] = 1;
+				Actors[Index] = Overlap.GetActor();
+				if (Overlap.bBlockingHit)
+					break;
+			}
+		}
+	}
+
+	// returns a dict of packed arrays: hit (uint8), distance (float32), location (3 x float32), normal (3 x float32),
+	// actor_index (int32, -1 for no actor) and the list of the hit actors
+	PyObject *ToPython() const
+	{
+		PyObject *py_actors = PyList_New(0);
+		TMap<AActor *, int32> actors_map;
+		TArray<int32> actor_indices;
+		actor_indices.SetNumUninitialized(Actors.Num());
+		for (int32 i = 0; i < Actors.Num(); i++)
+		{
+			AActor *actor = Actors[i].Get();
+			if (!actor)
+			{
+				actor_indices[i] = -1;
+				continue;
+			}
+			int32 *actor_index = actors_map.Find(actor);
+			if (actor_index)
+			{
+				actor_indices[i] = *actor_index;
+				continue;
+			}
+			ue_PyUObject *py_actor = ue_get_python_uobject(actor);
+			if (!py_actor)
+			{
+				actor_indices[i] = -1;
+				continue;
+			}
+			actor_indices[i] = actors_map.Add(actor, PyList_Size(py_actors));
+			PyList_Append(py_actors, (PyObject *)py_actor);
+		}
+
+		PyObject *py_dict = PyDict_New();
+		const char *keys[] = { "hit", "distance", "location", "normal", "actor_index" };
+		PyObject *py_values[] = {
+			ue_py_trace_results_buffer(Hits.GetData(), Hits.Num(), "B"),
+			ue_py_trace_results_buffer(Distances.GetData(), Distances.Num() * sizeof(float), "f"),
+			ue_py_trace_results_buffer(Locations.GetData(), Locations.Num() * sizeof(float), "f"),
+			ue_py_trace_results_buffer(Normals.GetData(), Normals.Num() * sizeof(float), "f"),
+			ue_py_trace_results_buffer(actor_indices.GetData(), actor_indices.Num() * sizeof(int32), "i"),
+		};
+		bool bFailed = false;
+		for (int32 i = 0; i < 5; i++)
+		{
+			if (!py_values[i])
+			{
+				bFailed = true;
+				continue;
+			}
+			PyDict_SetItemString(py_dict, keys[i], py_values[i]);
+			Py_DECREF(py_values[i]);
+		}
+		if (bFailed)
+		{
+			Py_DECREF(py_dict);
+			Py_DECREF(py_actors);
+			return nullptr;
+		}
+		PyDict_SetItemString(py_dict, "actors", py_actors);
+		Py_DECREF(py_actors);
+		return py_dict;
+	}
+};
+
+// collects the results of world async traces, the python callback is called when all of them are completed
+class FPythonBatchTraceAsync : public TSharedFromThis<FPythonBatchTraceAsync>
+{
+public:
+	FPythonBatchTraceAsync(UWorld *InWorld, PyObject *InCallable, int32 Num) : World(InWorld), Remaining(Num), py_callable(InCallable)
+	{
+		Py_INCREF(py_callable);
+		Results.Init(Num);
+	}
+
+	~FPythonBatchTraceAsync()
+	{
+		FScopePythonGIL gil;
+		Py_XDECREF(py_callable);
+	}
+
+	void OnTraceCompleted(const FTraceHandle &Handle, FTraceDatum &Datum)
+	{
+		for (const FHitResult &Hit : Datum.OutHits)
+		{
+			if (Hit.bBlockingHit)
+			{
+				Results.SetHit(Datum.UserData, Hit);
+				break;
+			}
+		}
+		Done();
+	}
+
+	void OnOverlapCompleted(const FTraceHandle &Handle, FOverlapDatum &Datum)
+	{
+		Results.SetOverlap(Datum.UserData, Datum.Pos, Datum.OutOverlaps);
+		Done();
+	}
+
+	void Done()
+	{
+		if (--Remaining > 0)
+			return;
+
+		// keep this alive until the end of the function
+		TSharedRef<FPythonBatchTraceAsync> Self = AsShared();
+		Pending.Remove(Self);
+
+		FScopePythonGIL gil;
+		PyObject *ret = PyObject_CallFunction(py_callable, (char *)"N", Results.ToPython());
+		if (!ret)
+		{
+			unreal_engine_py_log_error();
+			return;
+		}
+		Py_DECREF(ret);
+	}
+
+	static void AddPending(TSharedRef<FPythonBatchTraceAsync> Batch)
+	{
+		static FDelegateHandle WorldCleanupHandle;
+		if (!WorldCleanupHandle.IsValid())
+		{
+			WorldCleanupHandle = FWorldDelegates::OnWorldCleanup.AddStatic(&FPythonBatchTraceAsync::OnWorldCleanup);
+		}
+		Pending.Add(Batch);
+	}
+
+	// the traces of a world being cleaned up will never complete, drop them (and their python callables)
+	static void OnWorldCleanup(UWorld *CleanedWorld, bool bSessionEnded, bool bCleanupResources)
+	{
+		Pending.RemoveAll([CleanedWorld](const TSharedRef<FPythonBatchTraceAsync> &Batch)
+		{
+			return !Batch->World.IsValid() || Batch->World.Get() == CleanedWorld;
+		});
+	}
+
+	// the world delegates only keep weak references
+	static TArray<TSharedRef<FPythonBatchTraceAsync>> Pending;
+
+	FPythonBatchTraceResults Results;
+
+private:
+	TWeakObjectPtr<UWorld> World;
+	int32 Remaining;
+	PyObject *py_callable;
+};
+
+TArray<TSharedRef<FPythonBatchTraceAsync>> FPythonBatchTraceAsync::Pending;
+
+static bool ue_py_batch_trace_setup(PyObject *py_ignore_actors, PyObject *py_trace_complex, FCollisionQueryParams &params)
+{
+	params.bTraceComplex = py_trace_complex && PyObject_IsTrue(py_trace_complex);
+
+	if (!py_ignore_actors || py_ignore_actors == Py_None)
+		return true;
+
+	PyObject *py_iter = PyObject_GetIter(py_ignore_actors);
+	if (!py_iter)
+	{
+		PyErr_SetString(PyExc_Exception, "ignore_actors is not an iterable");
+		return false;
+	}
+	while (PyObject *py_item = PyIter_Next(py_iter))
+	{
+		AActor *actor = ue_py_check_type<AActor>(py_item);
+		Py_DECREF(py_item);
+		if (!actor)
+		{
+			Py_DECREF(py_iter);
+			PyErr_SetString(PyExc_Exception, "ignore_actors must contain only actors");
+			return false;
+		}
+		params.AddIgnoredActor(actor);
+	}
+	Py_DECREF(py_iter);
+	return true;
+}
+
+static bool ue_py_batch_trace_get_shape(float radius, float half_height, PyObject *py_box_extent, FCollisionShape &shape)
+{
+	if (py_box_extent && py_box_extent != Py_None)
+	{
+		ue_PyFVector *extent = py_ue_is_fvector(py_box_extent);
+		if (!extent)
+		{
+			PyErr_SetString(PyExc_Exception, "box_extent must be a FVector");
+			return false;
+		}
+		shape = FCollisionShape::MakeBox(extent->vec);
+	}
+	else if (half_height > 0)
+	{
+		shape = FCollisionShape::MakeCapsule(radius, half_height);
+	}
+	else
+	{
+		shape = FCollisionShape::MakeSphere(radius);
+	}
+	return true;
+}
+
+PyObject *py_ue_line_trace_batch_by_channel(ue_PyUObject * self, PyObject * args, PyObject *kwargs)
+{
+	ue_py_check(self);
+
+	PyObject *py_starts;
+	PyObject *py_ends;
+	int channel;
+	PyObject *py_trace_complex = nullptr;
+	PyObject *py_ignore_actors = nullptr;
+	PyObject *py_parallel = nullptr;
+	PyObject *py_callback = nullptr;
+
+	static char *kw_names[] = { (char *)"starts", (char *)"ends", (char *)"channel", (char *)"trace_complex", (char *)"ignore_actors", (char *)"parallel", (char *)"on_complete", nullptr };
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OOi|OOOO:line_trace_batch_by_channel", kw_names, &py_starts, &py_ends, &channel, &py_trace_complex, &py_ignore_actors, &py_parallel, &py_callback))
+	{
+		return nullptr;
+	}
+
+	UWorld *world = ue_get_uworld(self);
+	if (!world)
+		return PyErr_Format(PyExc_Exception, "unable to retrieve UWorld from uobject");
+
+	TArray<FVector> starts;
+	TArray<FVector> ends;
+	if (!ue_py_get_packed_vectors(py_starts, starts) || !ue_py_get_packed_vectors(py_ends, ends))
+		return nullptr;
+
+	if (starts.Num() != ends.Num())
+		return PyErr_Format(PyExc_Exception, "starts and ends must have the same number of vectors");
+
+	FCollisionQueryParams params(SCENE_QUERY_STAT(PythonLineTraceBatch));
+	if (!ue_py_batch_trace_setup(py_ignore_actors, py_trace_complex, params))
+		return nullptr;
+
+	if (py_callback && py_callback != Py_None)
+	{
+		if (!PyCallable_Check(py_callback))
+			return PyErr_Format(PyExc_Exception, "on_complete is not a callable");
+
+		TSharedRef<FPythonBatchTraceAsync> batch = MakeShareable(new FPythonBatchTraceAsync(world, py_callback, starts.Num()));
+		if (starts.Num() == 0)
+		{
+			PyObject *ret = PyObject_CallFunction(py_callback, (char *)"N", batch->Results.ToPython());
+			if (!ret)
+				return nullptr;
+			Py_DECREF(ret);
+			Py_RETURN_NONE;
+		}
+
+		FTraceDelegate trace_delegate = FTraceDelegate::CreateSP(batch, &FPythonBatchTraceAsync::OnTraceCompleted);
+		FPythonBatchTraceAsync::AddPending(batch);
+		for (int32 i = 0; i < starts.Num(); i++)
+		{
+			world->AsyncLineTraceByChannel(EAsyncTraceType::Single, starts[i], ends[i], (ECollisionChannel)channel, params, FCollisionResponseParams::DefaultResponseParam, &trace_delegate, i);
+		}
+		Py_RETURN_NONE;
+	}
+
+	FPythonBatchTraceResults results;
+	results.Init(starts.Num());
+	bool parallel = !py_parallel || PyObject_IsTrue(py_parallel);
+
+	Py_BEGIN_ALLOW_THREADS;
+	// scene queries are read only, so they can run on the task graph workers (like the world async traces do)
+	ParallelFor(starts.Num(), [&](int32 Index)
+	{
+		FHitResult hit;
+		if (world->LineTraceSingleByChannel(hit, starts[Index], ends[Index], (ECollisionChannel)channel, params))
+		{
+			results.SetHit(Index, hit);
+		}
+	}, !parallel);
+	Py_END_ALLOW_THREADS;
+
+	return results.ToPython();
+}
+
+PyObject *py_ue_sweep_batch_by_channel(ue_PyUObject * self, PyObject * args, PyObject *kwargs)
+{
+	ue_py_check(self);
+
+	PyObject *py_starts;
+	PyObject *py_ends;
+	int channel;
+	float radius = 0;
+	float half_height = 0;
+	PyObject *py_box_extent = nullptr;
+	PyObject *py_rotation = nullptr;
+	PyObject *py_trace_complex = nullptr;
+	PyObject *py_ignore_actors = nullptr;
+	PyObject *py_parallel = nullptr;
+	PyObject *py_callback = nullptr;
+
+	static char *kw_names[] = { (char *)"starts", (char *)"ends", (char *)"channel", (char *)"radius", (char *)"half_height", (char *)"box_extent", (char *)"rotation", (char *)"trace_complex", (char *)"ignore_actors", (char *)"parallel", (char *)"on_complete", nullptr };
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OOi|ffOOOOOO:sweep_batch_by_channel", kw_names, &py_starts, &py_ends, &channel, &radius, &half_height, &py_box_extent, &py_rotation, &py_trace_complex, &py_ignore_actors, &py_parallel, &py_callback))
+	{
+		return nullptr;
+	}
+
+	UWorld *world = ue_get_uworld(self);
+	if (!world)
+		return PyErr_Format(PyExc_Exception, "unable to retrieve UWorld from uobject");
+
+	TArray<FVector> starts;
+	TArray<FVector> ends;
+	if (!ue_py_get_packed_vectors(py_starts, starts) || !ue_py_get_packed_vectors(py_ends, ends))
+		return nullptr;
+
+	if (starts.Num() != ends.Num())
+		return PyErr_Format(PyExc_Exception, "starts and ends must have the same number of vectors");
+
+	FCollisionShape shape;
+	if (!ue_py_batch_trace_get_shape(radius, half_height, py_box_extent, shape))
+		return nullptr;
+
+	FQuat rotation = FQuat::Identity;
+	if (py_rotation && py_rotation != Py_None)
+	{
+		ue_PyFRotator *py_rot = py_ue_is_frotator(py_rotation);
+		if (!py_rot)
+			return PyErr_Format(PyExc_Exception, "rotation must be a FRotator");
+		rotation = py_rot->rot.Quaternion();
+	}
+
+	FCollisionQueryParams params(SCENE_QUERY_STAT(PythonSweepBatch));
+	if (!ue_py_batch_trace_setup(py_ignore_actors, py_trace_complex, params))
+		return nullptr;
+
+	if (py_callback && py_callback != Py_None)
+	{
+		if (!PyCallable_Check(py_callback))
+			return PyErr_Format(PyExc_Exception, "on_complete is not a callable");
+
+		TSharedRef<FPythonBatchTraceAsync> batch = MakeShareable(new FPythonBatchTraceAsync(world, py_callback, starts.Num()));
+		if (starts.Num() == 0)
+		{
+			PyObject *ret = PyObject_CallFunction(py_callback, (char *)"N", batch->Results.ToPython());
+			if (!ret)
+				return nullptr;
+			Py_DECREF(ret);
+			Py_RETURN_NONE;
+		}
+
+		FTraceDelegate trace_delegate = FTraceDelegate::CreateSP(batch, &FPythonBatchTraceAsync::OnTraceCompleted);
+		FPythonBatchTraceAsync::AddPending(batch);
+		for (int32 i = 0; i < starts.Num(); i++)
+		{
+			world->AsyncSweepByChannel(EAsyncTraceType::Single, starts[i], ends[i], rotation, (ECollisionChannel)channel, shape, params, FCollisionResponseParams::DefaultResponseParam, &trace_delegate, i);
+		}
+		Py_RETURN_NONE;
+	}
+
+	FPythonBatchTraceResults results;
+	results.Init(starts.Num());
+	bool parallel = !py_parallel || PyObject_IsTrue(py_parallel);
+
+	Py_BEGIN_ALLOW_THREADS;
+	ParallelFor(starts.Num(), [&](int32 Index)
+	{
+		FHitResult hit;
+		if (world->SweepSingleByChannel(hit, starts[Index], ends[Index], rotation, (ECollisionChannel)channel, shape, params))
+		{
+			results.SetHit(Index, hit);
+		}
+	}, !parallel);
+	Py_END_ALLOW_THREADS;
+
+	return results.ToPython();
+}
+
+PyObject *py_ue_overlap_batch_by_channel(ue_PyUObject * self, PyObject * args, PyObject *kwargs)
+{
+	ue_py_check(self);
+
+	PyObject *py_positions;
+	int channel;
+	float radius = 0;
+	float half_height = 0;
+	PyObject *py_box_extent = nullptr;
+	PyObject *py_rotation = nullptr;
+	PyObject *py_trace_complex = nullptr;
+	PyObject *py_ignore_actors = nullptr;
+	PyObject *py_parallel = nullptr;
+	PyObject *py_callback = nullptr;
+
+	static char *kw_names[] = { (char *)"positions", (char *)"channel", (char *)"radius", (char *)"half_height", (char *)"box_extent", (char *)"rotation", (char *)"trace_complex", (char *)"ignore_actors", (char *)"parallel", (char *)"on_complete", nullptr };
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "Oi|ffOOOOOO:overlap_batch_by_channel", kw_names, &py_positions, &channel, &radius, &half_height, &py_box_extent, &py_rotation, &py_trace_complex, &py_ignore_actors, &py_parallel, &py_callback))
+	{
+		return nullptr;
+	}
+
+	UWorld *world = ue_get_uworld(self);
+	if (!world)
+		return PyErr_Format(PyExc_Exception, "unable to retrieve UWorld from uobject");
+
+	TArray<FVector> positions;
+	if (!ue_py_get_packed_vectors(py_positions, positions))
+		return nullptr;
+
+	FCollisionShape shape;
+	if (!ue_py_batch_trace_get_shape(radius, half_height, py_box_extent, shape))
+		return nullptr;
+
+	FQuat rotation = FQuat::Identity;
+	if (py_rotation && py_rotation != Py_None)
+	{
+		ue_PyFRotator *py_rot = py_ue_is_frotator(py_rotation);
+		if (!py_rot)
+			return PyErr_Format(PyExc_Exception, "rotation must be a FRotator");
+		rotation = py_rot->rot.Quaternion();
+	}
+
+	FCollisionQueryParams params(SCENE_QUERY_STAT(PythonOverlapBatch));
+	if (!ue_py_batch_trace_setup(py_ignore_actors, py_trace_complex, params))
+		return nullptr;
+
+	if (py_callback && py_callback != Py_None)
+	{
+		if (!PyCallable_Check(py_callback))
+			return PyErr_Format(PyExc_Exception, "on_complete is not a callable");
+
+		TSharedRef<FPythonBatchTraceAsync> batch = MakeShareable(new FPythonBatchTraceAsync(world, py_callback, positions.Num()));
+		if (positions.Num() == 0)
+		{
+			PyObject *ret = PyObject_CallFunction(py_callback, (char *)"N", batch->Results.ToPython());
+			if (!ret)
+				return nullptr;
+			Py_DECREF(ret);
+			Py_RETURN_NONE;
+		}
+
+		FOverlapDelegate overlap_delegate = FOverlapDelegate::CreateSP(batch, &FPythonBatchTraceAsync::OnOverlapCompleted);
+		FPythonBatchTraceAsync::AddPending(batch);
+		for (int32 i = 0; i < positions.Num(); i++)
+		{
+			world->AsyncOverlapByChannel(positions[i], rotation, (ECollisionChannel)channel, shape, params, FCollisionResponseParams::DefaultResponseParam, &overlap_delegate, i);
+		}
+		Py_RETURN_NONE;
+	}
+
+	FPythonBatchTraceResults results;
+	results.Init(positions.Num());
+	bool parallel = !py_parallel || PyObject_IsTrue(py_parallel);
+
+	Py_BEGIN_ALLOW_THREADS;
+	ParallelFor(positions.Num(), [&](int32 Index)
+	{
+		TArray<FOverlapResult> overlaps;
+		world->OverlapMultiByChannel(overlaps, positions[Index], rotation, (ECollisionChannel)channel, shape, params);
+		results.SetOverlap(Index, positions[Index], overlaps);
+	}, !parallel);
+	Py_END_ALLOW_THREADS;
+
+	return results.ToPython();
+}
@@ -7,4 +7,11 @@
 PyObject *py_ue_line_trace_single_by_channel(ue_PyUObject *, PyObject *);
 PyObject *py_ue_line_trace_multi_by_channel(ue_PyUObject *, PyObject *);
 PyObject *py_ue_get_hit_result_under_cursor(ue_PyUObject *, PyObject *);
-PyObject *py_ue_draw_debug_line(ue_PyUObject *, PyObject *);
\ No newline at end of file
+PyObject *py_ue_draw_debug_line(ue_PyUObject *, PyObject *);
+
+PyObject *py_ue_line_trace_batch_by_channel(ue_PyUObject *, PyObject *, PyObject *);
+PyObject *py_ue_sweep_batch_by_channel(ue_PyUObject *, PyObject *, PyObject *);
+PyObject *py_ue_overlap_batch_by_channel(ue_PyUObject *, PyObject *, PyObject *);
+
+// read a packed float32/float64 buffer (x, y, z, x, y, z...) into an array of vectors
+bool ue_py_get_packed_vectors(PyObject *, TArray<FVector> &);
\ No newline at end of file
@@ -1,7 +1,9 @@
 #include "UEPyTransform.h"
 
 #include "GameFramework/Actor.h"
+#include "Engine/World.h"
 #include "Wrappers/UEPyFHitResult.h"
+#include "Wrappers/UEPyFMathArrays.h"
 
 static bool check_vector_args(PyObject *args, FVector &vec, bool &sweep, bool &teleport_physics)
 {
@@ -706,3 +708,251 @@ PyObject *py_ue_set_relative_scale(ue_PyUObject *self, PyObject * args)
 	}
 	return PyErr_Format(PyExc_Exception, "uobject is not a USceneComponent");
 }
+
+/* batch transforms */
+
+// actors are moved through their root component
+static USceneComponent *ue_py_batch_transform_component(PyObject *py_obj)
+{
+	if (AActor *actor = ue_py_check_type<AActor>(py_obj))
+		return actor->GetRootComponent();
+	return ue_py_check_type<USceneComponent>(py_obj);
+}
+
+static bool ue_py_batch_transform_components(PyObject *py_objects, TArray<USceneComponent *> &components)
+{
+	PyObject *py_seq = PySequence_Fast(py_objects, "argument is not a sequence of actors or components");
+	if (!py_seq)
+		return false;
+
+	const Py_ssize_t num = PySequence_Fast_GET_SIZE(py_seq);
+	components.Reserve(num);
+	for (Py_ssize_t i = 0; i < num; i++)
+	{
+		USceneComponent *component = ue_py_batch_transform_component(PySequence_Fast_GET_ITEM(py_seq, i));
+		if (!component)
+		{
+			Py_DECREF(py_seq);
+			PyErr_Format(PyExc_Exception, "item %d is not an actor with a root component or a USceneComponent", (int)i);
+			return false;
+		}
+		components.Add(component);
+	}
+	Py_DECREF(py_seq);
+	return true;
+}
+
+static bool ue_py_batch_transform_space(const char *space, bool &world)
+{
+	if (!space || !strcmp(space, "world"))
+	{
+		world = true;
+		return true;
+	}
+	if (!strcmp(space, "relative"))
+	{
+		world = false;
+		return true;
+	}
+	PyErr_Format(PyExc_Exception, "unknown transform space \"%s\", expected \"world\" or \"relative\"", space);
+	return false;
+}
+
+// components flagged as absolute keep the matching part of the world transform
+static void ue_py_batch_absolute_transform(USceneComponent *component, FTransform &relative, const FTransform &world)
+{
+#if ENGINE_MAJOR_VERSION == 5 || (ENGINE_MAJOR_VERSION == 4 && ENGINE_MINOR_VERSION >= 24)
+	if (component->IsUsingAbsoluteLocation())
+		relative.SetTranslation(world.GetTranslation());
+	if (component->IsUsingAbsoluteRotation())
+		relative.SetRotation(world.GetRotation());
+	if (component->IsUsingAbsoluteScale())
+		relative.SetScale3D(world.GetScale3D());
+#else
+	if (component->bAbsoluteLocation)
+		relative.SetTranslation(world.GetTranslation());
+	if (component->bAbsoluteRotation)
+		relative.SetRotation(world.GetRotation());
+	if (component->bAbsoluteScale)
+		relative.SetScale3D(world.GetScale3D());
+#endif
+}
+
+template<typename T>
+static bool ue_py_batch_has_moved_ancestor(USceneComponent *component, const T &moved)
+{
+	for (USceneComponent *parent = component->GetAttachParent(); parent; parent = parent->GetAttachParent())
+	{
+		if (moved.Contains(parent))
+			return true;
+	}
+	return false;
+}
+
+// the world transform the attach parent will have at the end of the batch (indices only contains the moved components),
+// parents not in the batch follow the nearest batched ancestor keeping their relative transform
+static FTransform ue_py_batch_parent_transform(USceneComponent *component, const TMap<USceneComponent *, int32> &indices, const TArray<FTransform> &world_transforms)
+{
+	USceneComponent *parent = component->GetAttachParent();
+	if (const int32 *parent_index = indices.Find(parent))
+	{
+		return parent->GetSocketTransform(component->GetAttachSocketName(), RTS_Component) * world_transforms[*parent_index];
+	}
+	if (!ue_py_batch_has_moved_ancestor(parent, indices))
+	{
+		return parent->GetSocketTransform(component->GetAttachSocketName());
+	}
+
+	FTransform parent_world = parent->GetRelativeTransform() * ue_py_batch_parent_transform(parent, indices, world_transforms);
+	ue_py_batch_absolute_transform(parent, parent_world, parent->GetRelativeTransform());
+	return parent->GetSocketTransform(component->GetAttachSocketName(), RTS_Component) * parent_world;
+}
+
+PyObject *py_unreal_engine_set_transforms(PyObject * self, PyObject * args, PyObject *kwargs)
+{
+	PyObject *py_objects;
+	PyObject *py_transforms;
+	char *space = nullptr;
+	PyObject *py_teleport = nullptr;
+	PyObject *py_skip_physics = nullptr;
+	PyObject *py_update_overlaps = nullptr;
+
+	static char *kw_names[] = { (char *)"objects", (char *)"transforms", (char *)"space", (char *)"teleport", (char *)"skip_physics", (char *)"update_overlaps", nullptr };
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OO|sOOO:set_transforms", kw_names, &py_objects, &py_transforms, &space, &py_teleport, &py_skip_physics, &py_update_overlaps))
+	{
+		return nullptr;
+	}
+
+	bool world = true;
+	if (!ue_py_batch_transform_space(space, world))
+		return nullptr;
+
+	TArray<USceneComponent *> components;
+	if (!ue_py_batch_transform_components(py_objects, components))
+		return nullptr;
+
+	// an FVectorArray only moves the components, keeping their rotation and scale
+	TArray<FTransform> transforms;
+	TArray<FVector> locations;
+	if (py_ue_fvector_array_get(py_transforms, locations))
+	{
+		if (locations.Num() != components.Num())
+			return PyErr_Format(PyExc_Exception, "expected %d locations, got %d", components.Num(), locations.Num());
+		transforms.SetNumUninitialized(components.Num());
+		for (int32 i = 0; i < components.Num(); i++)
+		{
+			transforms[i] = world ? components[i]->GetComponentTransform() : components[i]->GetRelativeTransform();
+			transforms[i].SetTranslation(locations[i]);
+		}
+	}
+	else if (!py_ue_ftransform_array_get(py_transforms, transforms))
+	{
+		// sequences of FTransform and packed buffers are converted by the FTransformArray constructor
+		PyObject *py_array = PyObject_CallFunctionObjArgs((PyObject *)&ue_PyFTransformArrayType, py_transforms, nullptr);
+		if (!py_array)
+			return nullptr;
+		py_ue_ftransform_array_get(py_array, transforms);
+		Py_DECREF(py_array);
+	}
+
+	if (transforms.Num() != components.Num())
+		return PyErr_Format(PyExc_Exception, "expected %d transforms, got %d", components.Num(), transforms.Num());
+
+	const ETeleportType teleport = (py_teleport && PyObject_IsTrue(py_teleport)) ? ETeleportType::TeleportPhysics : ETeleportType::None;
+	const EUpdateTransformFlags flags = (py_skip_physics && PyObject_IsTrue(py_skip_physics)) ? EUpdateTransformFlags::SkipPhysicsUpdate : EUpdateTransformFlags::None;
+	const bool update_overlaps = !py_update_overlaps || PyObject_IsTrue(py_update_overlaps);
+
+	// static components cannot be moved at runtime (SetWorldTransform would refuse them too), so they keep
+	// their current transform and their children are resolved against it
+	TMap<USceneComponent *, int32> indices;
+	indices.Reserve(components.Num());
+	for (int32 i = 0; i < components.Num(); i++)
+	{
+		USceneComponent *component = components[i];
+		if (component->Mobility == EComponentMobility::Static && component->GetWorld() && component->GetWorld()->IsGameWorld())
+			continue;
+		indices.Add(component, i);
+	}
+
+	// first pass: only store the new relative transforms, parents are resolved against their final transform
+	TSet<USceneComponent *> moved;
+	moved.Reserve(indices.Num());
+	for (int32 i = 0; i < components.Num(); i++)
+	{
+		USceneComponent *component = components[i];
+		// skipped, or passed again later (the last transform wins, as for the parent lookup)
+		const int32 *index = indices.Find(component);
+		if (!index || *index != i)
+			continue;
+
+		FTransform relative = transforms[i];
+		if (world && component->GetAttachParent())
+		{
+			relative = transforms[i].GetRelativeTransform(ue_py_batch_parent_transform(component, indices, transforms));
+			ue_py_batch_absolute_transform(component, relative, transforms[i]);
+		}
+
+#if ENGINE_MAJOR_VERSION == 5 || (ENGINE_MAJOR_VERSION == 4 && ENGINE_MINOR_VERSION >= 24)
+		component->SetRelativeLocation_Direct(relative.GetTranslation());
+		component->SetRelativeRotation_Direct(relative.Rotator());
+		component->SetRelativeScale3D_Direct(relative.GetScale3D());
+#else
+		component->RelativeLocation = relative.GetTranslation();
+		component->RelativeRotation = relative.Rotator();
+		component->RelativeScale3D = relative.GetScale3D();
+#endif
+		moved.Add(component);
+	}
+
+	// second pass: a single UpdateComponentToWorld per attachment subtree
+	TArray<USceneComponent *> roots;
+	roots.Reserve(moved.Num());
+	for (USceneComponent *component : moved)
+	{
+		if (!ue_py_batch_has_moved_ancestor(component, moved))
+		{
+			component->UpdateComponentToWorld(flags, teleport);
+			roots.Add(component);
+		}
+	}
+
+	if (update_overlaps)
+	{
+		// overlaps of attached children are updated by their parent
+		for (USceneComponent *component : roots)
+		{
+			component->UpdateOverlaps();
+		}
+	}
+
+	return PyLong_FromLong(moved.Num());
+}
+
+PyObject *py_unreal_engine_get_transforms(PyObject * self, PyObject * args, PyObject *kwargs)
+{
+	PyObject *py_objects;
+	char *space = nullptr;
+
+	static char *kw_names[] = { (char *)"objects", (char *)"space", nullptr };
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O|s:get_transforms", kw_names, &py_objects, &space))
+	{
+		return nullptr;
+	}
+
+	bool world = true;
+	if (!ue_py_batch_transform_space(space, world))
+		return nullptr;
+
+	TArray<USceneComponent *> components;
+	if (!ue_py_batch_transform_components(py_objects, components))
+		return nullptr;
+
+	TArray<FTransform> transforms;
+	transforms.SetNumUninitialized(components.Num());
+	for (int32 i = 0; i < components.Num(); i++)
+	{
+		transforms[i] = world ? components[i]->GetComponentTransform() : components[i]->GetRelativeTransform();
+	}
+
+	return py_ue_new_ftransform_array_from(transforms);
+}
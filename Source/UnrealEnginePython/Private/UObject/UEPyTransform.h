@@ -47,4 +47,7 @@ PyObject *py_ue_set_relative_transform(ue_PyUObject *, PyObject *);
 
 PyObject *py_ue_get_forward_vector(ue_PyUObject *, PyObject *);
 PyObject *py_ue_get_up_vector(ue_PyUObject *, PyObject *);
-PyObject *py_ue_get_right_vector(ue_PyUObject *, PyObject *);
\ No newline at end of file
+PyObject *py_ue_get_right_vector(ue_PyUObject *, PyObject *);
+
+PyObject *py_unreal_engine_set_transforms(PyObject *, PyObject *, PyObject *);
+PyObject *py_unreal_engine_get_transforms(PyObject *, PyObject *, PyObject *);
@@ -2,6 +2,11 @@
 
 #include "UnrealEnginePython.h"
 #include "UEPyModule.h"
+#include "UEPyCodeCache.h"
+#include "UEPyModuleRegistry.h"
+#include "UEPyStartupTrace.h"
+#include "UEPyTypedBindings.h"
+#include "UEPyViewportCapture.h"
 #include "PythonBlueprintFunctionLibrary.h"
 #include "HAL/IConsoleManager.h"
 #include "HAL/PlatformFilemanager.h"
@@ -26,7 +31,7 @@
 #include "Runtime/Core/Public/Mac/CocoaThread.h"
 #endif
 
-void unreal_engine_init_py_module();
+void unreal_engine_init_py_module(bool);
 void init_unreal_engine_builtin();
 
 #if PLATFORM_LINUX
@@ -245,13 +250,30 @@ void FUnrealEnginePythonModule::UESetupPythonInterpreter(bool verbose)
 
 	PySys_SetArgv(Args.Num(), argv);
 
-	unreal_engine_init_py_module();
+	unreal_engine_init_py_module(LazySubmodules);
+
+	FPythonStartupTrace::FScope TraceScope(TEXT("sys.path"));
 
 	PyObject *py_sys = PyImport_ImportModule("sys");
 	PyObject *py_sys_dict = PyModule_GetDict(py_sys);
 
 	PyObject *py_path = PyDict_GetItemString(py_sys_dict, "path");
 
+	// zipimport loads the .pyc files directly, no stat() storm over Lib/ and no compilation
+	if (!StdlibZipPath.IsEmpty())
+	{
+		if (FPaths::FileExists(StdlibZipPath))
+		{
+			PyObject *py_stdlib_zip_path = PyUnicode_FromString(TCHAR_TO_UTF8(*StdlibZipPath));
+			PyList_Insert(py_path, 0, py_stdlib_zip_path);
+			Py_DECREF(py_stdlib_zip_path);
+		}
+		else
+		{
+			UE_LOG(LogPython, Warning, TEXT("Python standard library zip %s not found"), *StdlibZipPath);
+		}
+	}
+
 	PyObject *py_zip_path = PyUnicode_FromString(TCHAR_TO_UTF8(*ZipPath));
 	PyList_Insert(py_path, 0, py_zip_path);
 
@@ -358,7 +380,10 @@ void FUnrealEnginePythonModule::StartupModule()
 	}
 #endif
 
+	FPythonStartupTrace::Get().BeginPhase(TEXT("configuration"));
+
 	BrutalFinalize = false;
+	LazySubmodules = false;
 
 	// This code will execute after your module is loaded into memory; the exact timing is specified in the .uplugin file per-module
 	FString PythonHome;
@@ -471,6 +496,43 @@ void FUnrealEnginePythonModule::StartupModule()
 		IniValue.ParseIntoArray(ImportModules, separators, 3);
 	}
 
+	FPythonCodeCache &CodeCache = FPythonCodeCache::Get();
+	GConfig->GetBool(UTF8_TO_TCHAR("Python"), UTF8_TO_TCHAR("CodeCache"), CodeCache.bEnabled, GEngineIni);
+	GConfig->GetBool(UTF8_TO_TCHAR("Python"), UTF8_TO_TCHAR("BytecodeCache"), CodeCache.bBytecodeCache, GEngineIni);
+#if ENGINE_MAJOR_VERSION == 5 || (ENGINE_MAJOR_VERSION == 4 && ENGINE_MINOR_VERSION >= 18)
+	CodeCache.BytecodeCacheDir = FPaths::Combine(FPaths::ProjectSavedDir(), UTF8_TO_TCHAR("PythonBytecode"));
+#else
+	CodeCache.BytecodeCacheDir = FPaths::Combine(FPaths::GameSavedDir(), UTF8_TO_TCHAR("PythonBytecode"));
+#endif
+
+	if (GConfig->GetString(UTF8_TO_TCHAR("Python"), UTF8_TO_TCHAR("BytecodeCachePath"), IniValue, GEngineIni))
+	{
+		CodeCache.BytecodeCacheDir = IniValue;
+	}
+
+	if (GConfig->GetString(UTF8_TO_TCHAR("Python"), UTF8_TO_TCHAR("RelativeBytecodeCachePath"), IniValue, GEngineIni))
+	{
+		CodeCache.BytecodeCacheDir = FPaths::Combine(*PROJECT_CONTENT_DIR, *IniValue);
+	}
+
+	GConfig->GetBool(UTF8_TO_TCHAR("Python"), UTF8_TO_TCHAR("HotSwapClasses"), FPythonModuleRegistry::Get().bHotSwapClasses, GEngineIni);
+
+	GConfig->GetBool(UTF8_TO_TCHAR("Python"), UTF8_TO_TCHAR("LazySubmodules"), LazySubmodules, GEngineIni);
+	GConfig->GetBool(UTF8_TO_TCHAR("Python"), UTF8_TO_TCHAR("StartupTrace"), FPythonStartupTrace::Get().bVerbose, GEngineIni);
+#if ENGINE_MAJOR_VERSION == 5 || (ENGINE_MAJOR_VERSION == 4 && ENGINE_MINOR_VERSION >= 25)
+	GConfig->GetBool(UTF8_TO_TCHAR("Python"), UTF8_TO_TCHAR("TypedBindings"), FPythonTypedBindings::Get().bEnabled, GEngineIni);
+#endif
+
+	if (GConfig->GetString(UTF8_TO_TCHAR("Python"), UTF8_TO_TCHAR("StdlibZip"), IniValue, GEngineIni))
+	{
+		StdlibZipPath = IniValue;
+	}
+
+	if (GConfig->GetString(UTF8_TO_TCHAR("Python"), UTF8_TO_TCHAR("RelativeStdlibZip"), IniValue, GEngineIni))
+	{
+		StdlibZipPath = FPaths::Combine(*PROJECT_CONTENT_DIR, *IniValue);
+	}
+
 	FString ProjectScriptsPath = FPaths::Combine(*PROJECT_CONTENT_DIR, UTF8_TO_TCHAR("Scripts"));
 	if (!FPaths::DirectoryExists(ProjectScriptsPath))
 	{
@@ -552,6 +614,10 @@ void FUnrealEnginePythonModule::StartupModule()
 	}
 
 
+	FPythonStartupTrace::Get().EndPhase();
+
+	FPythonStartupTrace::Get().BeginPhase(TEXT("interpreter"));
+
 #if PY_MAJOR_VERSION >= 3
 	init_unreal_engine_builtin();
 #if PLATFORM_ANDROID
@@ -723,6 +789,8 @@ void FUnrealEnginePythonModule::StartupModule()
 
 	PyEval_InitThreads();
 
+	FPythonStartupTrace::Get().EndPhase();
+
 #if WITH_EDITOR
 	StyleSet = MakeShareable(new FSlateStyleSet("UnrealEnginePython"));
 	StyleSet->SetContentRoot(IPluginManager::Get().FindPlugin("UnrealEnginePython")->GetBaseDir() / "Resources");
@@ -733,14 +801,19 @@ void FUnrealEnginePythonModule::StartupModule()
 #endif
 #endif
 
+	FPythonStartupTrace::Get().BeginPhase(TEXT("interpreter setup"));
 	UESetupPythonInterpreter(true);
+	FPythonStartupTrace::Get().EndPhase();
 
 	main_module = PyImport_AddModule("__main__");
 	main_dict = PyModule_GetDict((PyObject*)main_module);
 	local_dict = main_dict;// PyDict_New();
 
+	FPythonStartupTrace::Get().BeginPhase(TEXT("stdout/stderr redirection"));
 	setup_stdout_stderr();
+	FPythonStartupTrace::Get().EndPhase();
 
+	FPythonStartupTrace::Get().BeginPhase(TEXT("import ue_site"));
 	if (PyImport_ImportModule("ue_site"))
 	{
 		UE_LOG(LogPython, Log, TEXT("ue_site Python module successfully imported"));
@@ -761,10 +834,12 @@ void FUnrealEnginePythonModule::StartupModule()
 		unreal_engine_py_log_error();
 #endif
 	}
+	FPythonStartupTrace::Get().EndPhase();
 
 
 	for (FString ImportModule : ImportModules)
 	{
+		FPythonStartupTrace::FScope TraceScope(FString::Printf(TEXT("import %s"), *ImportModule));
 		if (PyImport_ImportModule(TCHAR_TO_UTF8(*ImportModule)))
 		{
 			UE_LOG(LogPython, Log, TEXT("%s Python module successfully imported"), *ImportModule);
@@ -775,6 +850,8 @@ void FUnrealEnginePythonModule::StartupModule()
 		}
 	}
 
+	FPythonStartupTrace::Get().Report();
+
 	// Release the GIL taken by Py_Initialize now that initialization has finished, to allow other threads access to Python
 	// We have to take this again prior to calling Py_Finalize, and all other code will lock on-demand via FPyScopedGIL
 	PyMainThreadState = PyEval_SaveThread();
@@ -786,6 +863,12 @@ void FUnrealEnginePythonModule::ShutdownModule()
 	// we call this function before unloading the module.
 
 	UE_LOG(LogPython, Log, TEXT("Goodbye Python"));
+
+	// the capture ticker and its workers must not outlive the module
+	ue_py_viewport_capture_stop_all();
+
+	FPythonModuleRegistry::Get().Shutdown();
+
 	// We need to restore the original GIL prior to calling Py_Finalize
 	PyEval_RestoreThread(PyMainThreadState);
 	PyMainThreadState = nullptr;
@@ -801,7 +884,19 @@ void FUnrealEnginePythonModule::RunString(char *str)
 {
 	FScopePythonGIL gil;
 
-	PyObject *eval_ret = PyRun_String(str, Py_file_input, (PyObject *)main_dict, (PyObject *)local_dict);
+	PyObject *code = FPythonCodeCache::Get().GetStringCode(str);
+	if (!code)
+	{
+		unreal_engine_py_log_error();
+		return;
+	}
+
+#if PY_MAJOR_VERSION >= 3
+	PyObject *eval_ret = PyEval_EvalCode(code, (PyObject *)main_dict, (PyObject *)local_dict);
+#else
+	PyObject *eval_ret = PyEval_EvalCode((PyCodeObject *)code, (PyObject *)main_dict, (PyObject *)local_dict);
+#endif
+	Py_DECREF(code);
 	if (!eval_ret)
 	{
 		if (PyErr_ExceptionMatches(PyExc_SystemExit))
@@ -879,30 +974,10 @@ FString FUnrealEnginePythonModule::Pep8ize(FString Code)
 void FUnrealEnginePythonModule::RunFile(char *filename)
 {
 	FScopePythonGIL gil;
-	FString full_path = UTF8_TO_TCHAR(filename);
-	FString original_path = full_path;
-	bool foundFile = false;
-	if (!FPaths::FileExists(filename))
-	{
-		for (FString ScriptsPath : ScriptsPaths)
-		{
-			full_path = FPaths::Combine(*ScriptsPath, original_path);
-
-#if PLATFORM_IOS
-			full_path = IFileManager::Get().ConvertToAbsolutePathForExternalAppForRead(*full_path);
-#endif
-			
-			if (FPaths::FileExists(full_path))
-			{
-				foundFile = true;
-				break;
-			}
-		}
-	}
-	else
-	{
-		foundFile = true;
-	}
+	FPythonCodeCache &CodeCache = FPythonCodeCache::Get();
+	FString original_path = UTF8_TO_TCHAR(filename);
+	FString full_path;
+	bool foundFile = CodeCache.ResolveScript(original_path, ScriptsPaths, full_path);
 
 	if (!foundFile)
 	{
@@ -913,25 +988,32 @@ void FUnrealEnginePythonModule::RunFile(char *filename)
 	}
 
 #if PY_MAJOR_VERSION >= 3
-	FILE *fd = nullptr;
-
-#if PLATFORM_WINDOWS
-	if (fopen_s(&fd, TCHAR_TO_UTF8(*full_path), "r") != 0)
+	bool bMissing = false;
+	PyObject *code = CodeCache.GetFileCode(full_path, bMissing);
+	if (!code && bMissing)
 	{
-		UE_LOG(LogPython, Error, TEXT("Unable to open file %s"), *full_path);
-		return;
+		// the cached location could be stale, search again
+		PyErr_Clear();
+		CodeCache.ForgetScript(original_path);
+		if (CodeCache.ResolveScript(original_path, ScriptsPaths, full_path))
+		{
+			code = CodeCache.GetFileCode(full_path, bMissing);
+		}
+		if (!code && bMissing)
+		{
+			PyErr_Clear();
+			UE_LOG(LogPython, Error, TEXT("Unable to open file %s"), *full_path);
+			return;
+		}
 	}
-#else
-	fd = fopen(TCHAR_TO_UTF8(*full_path), "r");
-	if (!fd)
+	if (!code)
 	{
-		UE_LOG(LogPython, Error, TEXT("Unable to open file %s"), *full_path);
+		unreal_engine_py_log_error();
 		return;
 	}
-#endif
 
-	PyObject *eval_ret = PyRun_File(fd, TCHAR_TO_UTF8(*full_path), Py_file_input, (PyObject *)main_dict, (PyObject *)local_dict);
-	fclose(fd);
+	PyObject *eval_ret = PyEval_EvalCode(code, (PyObject *)main_dict, (PyObject *)local_dict);
+	Py_DECREF(code);
 	if (!eval_ret)
 	{
 		if (PyErr_ExceptionMatches(PyExc_SystemExit))
@@ -3,6 +3,7 @@
 #if WITH_EDITOR
 
 #include "ObjectTools.h"
+#include "Runtime/AssetRegistry/Public/AssetRegistry/AssetRegistryModule.h"
 #include "Wrappers/UEPyFObjectThumbnail.h"
 
 static PyObject *py_ue_fassetdata_get_asset(ue_PyFAssetData *self, PyObject * args)
@@ -10,6 +11,64 @@ static PyObject *py_ue_fassetdata_get_asset(ue_PyFAssetData *self, PyObject * ar
 	Py_RETURN_UOBJECT(self->asset_data.GetAsset());
 }
 
+// like get_asset(), load(True) returns None instead of loading the package when it is not in memory
+static PyObject *py_ue_fassetdata_load(ue_PyFAssetData *self, PyObject * args)
+{
+	PyObject *py_only_if_loaded = nullptr;
+	if (!PyArg_ParseTuple(args, "|O:load", &py_only_if_loaded))
+	{
+		return nullptr;
+	}
+
+	if (py_only_if_loaded && PyObject_IsTrue(py_only_if_loaded) && !self->asset_data.IsAssetLoaded())
+	{
+		Py_RETURN_NONE;
+	}
+
+	UObject *u_object = self->asset_data.GetAsset();
+	if (!u_object)
+		return PyErr_Format(PyExc_Exception, "unable to load asset %s", TCHAR_TO_UTF8(*self->asset_data.ObjectPath.ToString()));
+
+	Py_RETURN_UOBJECT(u_object);
+}
+
+static PyObject *py_ue_fassetdata_get_tag_value(ue_PyFAssetData *self, PyObject * args)
+{
+	char *tag;
+	if (!PyArg_ParseTuple(args, "s:get_tag_value", &tag))
+	{
+		return nullptr;
+	}
+
+	FString value;
+	if (!self->asset_data.GetTagValue(FName(UTF8_TO_TCHAR(tag)), value))
+	{
+		Py_RETURN_NONE;
+	}
+
+	return PyUnicode_FromString(TCHAR_TO_UTF8(*value));
+}
+
+static PyObject *py_ue_fassetdata_has_tag(ue_PyFAssetData *self, PyObject * args)
+{
+	char *tag;
+	if (!PyArg_ParseTuple(args, "s:has_tag", &tag))
+	{
+		return nullptr;
+	}
+
+	if (self->asset_data.TagsAndValues.Contains(FName(UTF8_TO_TCHAR(tag))))
+		Py_RETURN_TRUE;
+	Py_RETURN_FALSE;
+}
+
+static PyObject *py_ue_fassetdata_is_redirector(ue_PyFAssetData *self, PyObject * args)
+{
+	if (self->asset_data.IsRedirector())
+		Py_RETURN_TRUE;
+	Py_RETURN_FALSE;
+}
+
 static PyObject *py_ue_fassetdata_is_asset_loaded(ue_PyFAssetData *self, PyObject * args)
 {
 	if (self->asset_data.IsAssetLoaded())
@@ -69,7 +128,11 @@ static PyObject *py_ue_fassetdata_has_cached_thumbnail(ue_PyFAssetData *self, Py
 
 static PyMethodDef ue_PyFAssetData_methods[] = {
 	{ "get_asset", (PyCFunction)py_ue_fassetdata_get_asset, METH_VARARGS, "" },
+	{ "load", (PyCFunction)py_ue_fassetdata_load, METH_VARARGS, "" },
 	{ "is_asset_loaded", (PyCFunction)py_ue_fassetdata_is_asset_loaded, METH_VARARGS, "" },
+	{ "get_tag_value", (PyCFunction)py_ue_fassetdata_get_tag_value, METH_VARARGS, "" },
+	{ "has_tag", (PyCFunction)py_ue_fassetdata_has_tag, METH_VARARGS, "" },
+	{ "is_redirector", (PyCFunction)py_ue_fassetdata_is_redirector, METH_VARARGS, "" },
 	{ "get_thumbnail", (PyCFunction)py_ue_fassetdata_get_thumbnail, METH_VARARGS, "" },
 
 #if ENGINE_MAJOR_VERSION == 5 || (ENGINE_MAJOR_VERSION == 4 && ENGINE_MINOR_VERSION >= 18)
@@ -128,9 +191,20 @@ static PyObject *py_ue_fassetdata_get_tags_and_values(ue_PyFAssetData *self, voi
 	return ret;
 }
 
+static PyObject *py_ue_fassetdata_get_disk_size(ue_PyFAssetData *self, void *closure)
+{
+	int64 disk_size = -1;
+	if (ue_py_fassetdata_disk_size(self->asset_data, disk_size))
+	{
+		return PyLong_FromLongLong(disk_size);
+	}
+	Py_RETURN_NONE;
+}
+
 static PyGetSetDef ue_PyFAssetData_getseters[] = {
 	{ (char *)"asset_class", (getter)py_ue_fassetdata_get_asset_class, nullptr, (char *)"asset_class" },
 	{ (char *)"asset_name", (getter)py_ue_fassetdata_get_asset_name, nullptr, (char *)"asset_name" },
+	{ (char *)"disk_size", (getter)py_ue_fassetdata_get_disk_size, nullptr, (char *)"disk_size" },
 #if !(ENGINE_MAJOR_VERSION == 5 || (ENGINE_MAJOR_VERSION == 4 && ENGINE_MINOR_VERSION >= 17))
 	{ (char *)"group_names", (getter)py_ue_fassetdata_get_group_names, nullptr, (char *)"group_names" },
 #endif
@@ -142,6 +216,12 @@ static PyGetSetDef ue_PyFAssetData_getseters[] = {
 	{ NULL }  /* Sentinel */
 };
 
+static void ue_py_fassetdata_dealloc(ue_PyFAssetData *self)
+{
+	self->asset_data.~FAssetData();
+	Py_TYPE(self)->tp_free((PyObject *)self);
+}
+
 static int ue_py_fassetdata_init(ue_PyFAssetData *self, PyObject *args, PyObject *kwargs)
 {
 	// avoid FAssetData manual creation
@@ -159,7 +239,7 @@ static PyTypeObject ue_PyFAssetDataType = {
 	"unreal_engine.FAssetData", /* tp_name */
 	sizeof(ue_PyFAssetData),    /* tp_basicsize */
 	0,                         /* tp_itemsize */
-	0,   /* tp_dealloc */
+	(destructor)ue_py_fassetdata_dealloc,   /* tp_dealloc */
 	0,                         /* tp_print */
 	0,                         /* tp_getattr */
 	0,                         /* tp_setattr */
@@ -206,6 +286,23 @@ PyObject *py_ue_new_fassetdata(FAssetData asset_data)
 	return (PyObject *)ret;
 }
 
+bool ue_py_fassetdata_disk_size(const FAssetData& asset_data, int64& disk_size)
+{
+	IAssetRegistry& AssetRegistry = FModuleManager::GetModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 1
+	TOptional<FAssetPackageData> package_data = AssetRegistry.GetAssetPackageDataCopy(asset_data.PackageName);
+	if (!package_data.IsSet())
+		return false;
+	disk_size = package_data->DiskSize;
+#else
+	const FAssetPackageData *package_data = AssetRegistry.GetAssetPackageData(asset_data.PackageName);
+	if (!package_data)
+		return false;
+	disk_size = package_data->DiskSize;
+#endif
+	return true;
+}
+
 ue_PyFAssetData *py_ue_is_fassetdata(PyObject *obj)
 {
 	if (!PyObject_IsInstance(obj, (PyObject *)&ue_PyFAssetDataType))
@@ -14,6 +14,9 @@ struct ue_PyFAssetData
 PyObject *py_ue_new_fassetdata(FAssetData);
 ue_PyFAssetData *py_ue_is_fassetdata(PyObject *);
 
+// reads the package size from the registry cache, never loads the package
+bool ue_py_fassetdata_disk_size(const FAssetData&, int64&);
+
 void ue_python_init_fassetdata(PyObject *);
 
 #endif
@@ -0,0 +1,1282 @@
+#include "UEPyFMathArrays.h"
+
+#define UEPY_FMATH_ARRAY_MAX_COMPONENTS 10
+
+static int32 ue_py_fmath_array_type_components(PyTypeObject *type)
+{
+	if (PyType_IsSubtype(type, &ue_PyFTransformArrayType))
+		return 10;
+	if (PyType_IsSubtype(type, &ue_PyFQuatArrayType))
+		return 4;
+	return 3;
+}
+
+static FPythonArrayReal *ue_py_fmath_array_component(ue_PyFMathArray *self, int32 component)
+{
+	return self->data + (int64)component * self->num;
+}
+
+static void ue_py_fmath_array_alloc(ue_PyFMathArray *self, int32 num)
+{
+	if (self->data)
+		FMemory::Free(self->data);
+	self->num = num;
+	self->data = (FPythonArrayReal *)FMemory::Malloc(FMath::Max<SIZE_T>(sizeof(FPythonArrayReal) * self->components * num, 1), 16);
+	self->shape[0] = self->components;
+	self->shape[1] = num;
+	self->strides[0] = sizeof(FPythonArrayReal) * num;
+	self->strides[1] = sizeof(FPythonArrayReal);
+}
+
+// zeros for vectors, identities for quaternions and transforms
+static void ue_py_fmath_array_reset(ue_PyFMathArray *self)
+{
+	FMemory::Memzero(self->data, sizeof(FPythonArrayReal) * self->components * self->num);
+	if (self->components == 4)
+	{
+		FPythonArrayReal *w = ue_py_fmath_array_component(self, 3);
+		for (int32 i = 0; i < self->num; i++)
+			w[i] = 1;
+	}
+	else if (self->components == 10)
+	{
+		FPythonArrayReal *w = ue_py_fmath_array_component(self, 6);
+		for (int32 i = 0; i < self->num * 4; i++)
+			w[i] = 1;
+		// the loop above also wrote the three scale components
+	}
+}
+
+static ue_PyFMathArray *ue_py_fmath_array_new(PyTypeObject *type, int32 num)
+{
+	ue_PyFMathArray *ret = (ue_PyFMathArray *)PyObject_New(ue_PyFMathArray, type);
+	if (!ret)
+		return nullptr;
+	ret->data = nullptr;
+	ret->exports = 0;
+	ret->components = ue_py_fmath_array_type_components(type);
+	ue_py_fmath_array_alloc(ret, num);
+	return ret;
+}
+
+static void ue_py_fmath_array_dealloc(ue_PyFMathArray *self)
+{
+	if (self->data)
+		FMemory::Free(self->data);
+	Py_TYPE(self)->tp_free((PyObject *)self);
+}
+
+static int ue_py_fmath_array_getbuffer(ue_PyFMathArray *self, Py_buffer *view, int flags)
+{
+	view->obj = (PyObject *)self;
+	Py_INCREF(view->obj);
+	view->buf = self->data;
+	view->len = sizeof(FPythonArrayReal) * self->components * self->num;
+	view->readonly = 0;
+	view->itemsize = sizeof(FPythonArrayReal);
+	view->format = (flags & PyBUF_FORMAT) ? (char *)(sizeof(FPythonArrayReal) == sizeof(double) ? "d" : "f") : nullptr;
+	// without PyBUF_ND the consumer sees a flat buffer
+	view->ndim = (flags & PyBUF_ND) == PyBUF_ND ? 2 : 1;
+	view->shape = (flags & PyBUF_ND) == PyBUF_ND ? self->shape : nullptr;
+	view->strides = (flags & PyBUF_STRIDES) == PyBUF_STRIDES ? self->strides : nullptr;
+	view->suboffsets = nullptr;
+	view->internal = nullptr;
+	self->exports++;
+	return 0;
+}
+
+static void ue_py_fmath_array_releasebuffer(ue_PyFMathArray *self, Py_buffer *view)
+{
+	self->exports--;
+}
+
+static PyBufferProcs ue_PyFMathArray_as_buffer = {
+	(getbufferproc)ue_py_fmath_array_getbuffer,
+	(releasebufferproc)ue_py_fmath_array_releasebuffer,
+};
+
+/* element access */
+
+static FVector ue_py_fvector_array_at(ue_PyFMathArray *self, int32 i)
+{
+	return FVector(self->data[i], self->data[self->num + i], self->data[self->num * 2 + i]);
+}
+
+static void ue_py_fvector_array_set(ue_PyFMathArray *self, int32 i, const FVector &vec)
+{
+	self->data[i] = vec.X;
+	self->data[self->num + i] = vec.Y;
+	self->data[self->num * 2 + i] = vec.Z;
+}
+
+static FQuat ue_py_fquat_array_at(ue_PyFMathArray *self, int32 i, int32 first = 0)
+{
+	const FPythonArrayReal *data = self->data + (int64)first * self->num;
+	return FQuat(data[i], data[self->num + i], data[self->num * 2 + i], data[self->num * 3 + i]);
+}
+
+static void ue_py_fquat_array_set(ue_PyFMathArray *self, int32 i, const FQuat &quat, int32 first = 0)
+{
+	FPythonArrayReal *data = self->data + (int64)first * self->num;
+	data[i] = quat.X;
+	data[self->num + i] = quat.Y;
+	data[self->num * 2 + i] = quat.Z;
+	data[self->num * 3 + i] = quat.W;
+}
+
+static FTransform ue_py_ftransform_array_at(ue_PyFMathArray *self, int32 i)
+{
+	const FPythonArrayReal *data = self->data;
+	const int32 n = self->num;
+	return FTransform(ue_py_fquat_array_at(self, i, 3),
+		FVector(data[i], data[n + i], data[n * 2 + i]),
+		FVector(data[n * 7 + i], data[n * 8 + i], data[n * 9 + i]));
+}
+
+static void ue_py_ftransform_array_set(ue_PyFMathArray *self, int32 i, const FTransform &transform)
+{
+	FPythonArrayReal *data = self->data;
+	const int32 n = self->num;
+	const FVector translation = transform.GetTranslation();
+	const FVector scale = transform.GetScale3D();
+	data[i] = translation.X;
+	data[n + i] = translation.Y;
+	data[n * 2 + i] = translation.Z;
+	ue_py_fquat_array_set(self, i, transform.GetRotation(), 3);
+	data[n * 7 + i] = scale.X;
+	data[n * 8 + i] = scale.Y;
+	data[n * 9 + i] = scale.Z;
+}
+
+static PyObject *ue_py_fmath_array_item_to_py(ue_PyFMathArray *self, int32 i)
+{
+	if (self->components == 10)
+		return py_ue_new_ftransform(ue_py_ftransform_array_at(self, i));
+	if (self->components == 4)
+		return py_ue_new_fquat(ue_py_fquat_array_at(self, i));
+	return py_ue_new_fvector(ue_py_fvector_array_at(self, i));
+}
+
+static bool ue_py_fmath_array_item_from_py(ue_PyFMathArray *self, int32 i, PyObject *py_item)
+{
+	if (self->components == 10)
+	{
+		ue_PyFTransform *py_transform = py_ue_is_ftransform(py_item);
+		if (!py_transform)
+		{
+			PyErr_SetString(PyExc_TypeError, "item is not a FTransform");
+			return false;
+		}
+		ue_py_ftransform_array_set(self, i, py_transform->transform);
+	}
+	else if (self->components == 4)
+	{
+		ue_PyFQuat *py_quat = py_ue_is_fquat(py_item);
+		if (!py_quat)
+		{
+			PyErr_SetString(PyExc_TypeError, "item is not a FQuat");
+			return false;
+		}
+		ue_py_fquat_array_set(self, i, py_quat->quat);
+	}
+	else
+	{
+		ue_PyFVector *py_vec = py_ue_is_fvector(py_item);
+		if (!py_vec)
+		{
+			PyErr_SetString(PyExc_TypeError, "item is not a FVector");
+			return false;
+		}
+		ue_py_fvector_array_set(self, i, py_vec->vec);
+	}
+	return true;
+}
+
+/* broadcastable operands */
+
+// either a single value (every component pointer targets Values) or an array of the same length
+struct FPythonArrayOperand
+{
+	const FPythonArrayReal *Components[UEPY_FMATH_ARRAY_MAX_COMPONENTS];
+	FPythonArrayReal Values[UEPY_FMATH_ARRAY_MAX_COMPONENTS];
+	bool bBroadcast;
+
+	void SetArray(ue_PyFMathArray *array)
+	{
+		for (int32 c = 0; c < array->components; c++)
+			Components[c] = ue_py_fmath_array_component(array, c);
+		bBroadcast = false;
+	}
+
+	void SetValues(const FPythonArrayReal *values, int32 num)
+	{
+		for (int32 c = 0; c < num; c++)
+		{
+			Values[c] = values[c];
+			Components[c] = &Values[c];
+		}
+		bBroadcast = true;
+	}
+
+	void SetVector(const FVector &vec)
+	{
+		const FPythonArrayReal values[] = { (FPythonArrayReal)vec.X, (FPythonArrayReal)vec.Y, (FPythonArrayReal)vec.Z };
+		SetValues(values, 3);
+	}
+
+	void SetQuat(const FQuat &quat)
+	{
+		const FPythonArrayReal values[] = { (FPythonArrayReal)quat.X, (FPythonArrayReal)quat.Y, (FPythonArrayReal)quat.Z, (FPythonArrayReal)quat.W };
+		SetValues(values, 4);
+	}
+
+	void SetTransform(const FTransform &transform)
+	{
+		const FVector t = transform.GetTranslation();
+		const FQuat q = transform.GetRotation();
+		const FVector s = transform.GetScale3D();
+		const FPythonArrayReal values[] = {
+			(FPythonArrayReal)t.X, (FPythonArrayReal)t.Y, (FPythonArrayReal)t.Z,
+			(FPythonArrayReal)q.X, (FPythonArrayReal)q.Y, (FPythonArrayReal)q.Z, (FPythonArrayReal)q.W,
+			(FPythonArrayReal)s.X, (FPythonArrayReal)s.Y, (FPythonArrayReal)s.Z };
+		SetValues(values, 10);
+	}
+};
+
+static bool ue_py_fmath_array_same_num(ue_PyFMathArray *array, int32 num)
+{
+	if (array->num != num)
+	{
+		PyErr_Format(PyExc_Exception, "array length mismatch (%d, expected %d)", array->num, num);
+		return false;
+	}
+	return true;
+}
+
+static bool ue_py_vector_operand(PyObject *py_obj, int32 num, FPythonArrayOperand &operand, bool allow_number)
+{
+	if (ue_PyFMathArray *py_array = py_ue_is_fvector_array(py_obj))
+	{
+		if (!ue_py_fmath_array_same_num(py_array, num))
+			return false;
+		operand.SetArray(py_array);
+		return true;
+	}
+	if (ue_PyFVector *py_vec = py_ue_is_fvector(py_obj))
+	{
+		operand.SetVector(py_vec->vec);
+		return true;
+	}
+	if (allow_number && PyNumber_Check(py_obj))
+	{
+		PyObject *f_value = PyNumber_Float(py_obj);
+		if (!f_value)
+			return false;
+		const FPythonArrayReal f = PyFloat_AsDouble(f_value);
+		Py_DECREF(f_value);
+		operand.SetVector(FVector(f, f, f));
+		return true;
+	}
+	PyErr_SetString(PyExc_TypeError, allow_number ? "argument is not a FVectorArray, a FVector or a number" : "argument is not a FVectorArray or a FVector");
+	return false;
+}
+
+static bool ue_py_quat_operand(PyObject *py_obj, int32 num, FPythonArrayOperand &operand)
+{
+	if (ue_PyFMathArray *py_array = py_ue_is_fquat_array(py_obj))
+	{
+		if (!ue_py_fmath_array_same_num(py_array, num))
+			return false;
+		operand.SetArray(py_array);
+		return true;
+	}
+	if (ue_PyFQuat *py_quat = py_ue_is_fquat(py_obj))
+	{
+		operand.SetQuat(py_quat->quat);
+		return true;
+	}
+	PyErr_SetString(PyExc_TypeError, "argument is not a FQuatArray or a FQuat");
+	return false;
+}
+
+static bool ue_py_transform_operand(PyObject *py_obj, int32 num, FPythonArrayOperand &operand)
+{
+	if (ue_PyFMathArray *py_array = py_ue_is_ftransform_array(py_obj))
+	{
+		if (!ue_py_fmath_array_same_num(py_array, num))
+			return false;
+		operand.SetArray(py_array);
+		return true;
+	}
+	if (ue_PyFTransform *py_transform = py_ue_is_ftransform(py_obj))
+	{
+		operand.SetTransform(py_transform->transform);
+		return true;
+	}
+	PyErr_SetString(PyExc_TypeError, "argument is not a FTransformArray or a FTransform");
+	return false;
+}
+
+/*
+
+kernels: every loop walks a single component run, so with the broadcast flag resolved at compile time
+they are plain streaming loops the compiler can vectorize
+
+*/
+
+#define UEPY_OPERAND(c, i) (bBroadcast ? *B[c] : B[c][i])
+
+enum class EPythonVectorArrayOp
+{
+	Add,
+	Sub,
+	Mul,
+	Div,
+	Cross,
+	Lerp,
+};
+
+template<bool bBroadcast>
+static void ue_py_fvector_array_kernel(EPythonVectorArrayOp op, ue_PyFMathArray *a, const FPythonArrayOperand &b, ue_PyFMathArray *out, FPythonArrayReal alpha)
+{
+	const int32 n = a->num;
+	const FPythonArrayReal *ax = ue_py_fmath_array_component(a, 0);
+	const FPythonArrayReal *ay = ue_py_fmath_array_component(a, 1);
+	const FPythonArrayReal *az = ue_py_fmath_array_component(a, 2);
+	FPythonArrayReal *ox = ue_py_fmath_array_component(out, 0);
+	FPythonArrayReal *oy = ue_py_fmath_array_component(out, 1);
+	FPythonArrayReal *oz = ue_py_fmath_array_component(out, 2);
+	const FPythonArrayReal * const *B = b.Components;
+
+	switch (op)
+	{
+	case EPythonVectorArrayOp::Add:
+		for (int32 c = 0; c < 3; c++)
+		{
+			const FPythonArrayReal *src = ue_py_fmath_array_component(a, c);
+			FPythonArrayReal *dst = ue_py_fmath_array_component(out, c);
+			for (int32 i = 0; i < n; i++)
+				dst[i] = src[i] + UEPY_OPERAND(c, i);
+		}
+		break;
+	case EPythonVectorArrayOp::Sub:
+		for (int32 c = 0; c < 3; c++)
+		{
+			const FPythonArrayReal *src = ue_py_fmath_array_component(a, c);
+			FPythonArrayReal *dst = ue_py_fmath_array_component(out, c);
+			for (int32 i = 0; i < n; i++)
+				dst[i] = src[i] - UEPY_OPERAND(c, i);
+		}
+		break;
+	case EPythonVectorArrayOp::Mul:
+		for (int32 c = 0; c < 3; c++)
+		{
+			const FPythonArrayReal *src = ue_py_fmath_array_component(a, c);
+			FPythonArrayReal *dst = ue_py_fmath_array_component(out, c);
+			for (int32 i = 0; i < n; i++)
+				dst[i] = src[i] * UEPY_OPERAND(c, i);
+		}
+		break;
+	case EPythonVectorArrayOp::Div:
+		for (int32 c = 0; c < 3; c++)
+		{
+			const FPythonArrayReal *src = ue_py_fmath_array_component(a, c);
+			FPythonArrayReal *dst = ue_py_fmath_array_component(out, c);
+			for (int32 i = 0; i < n; i++)
+				dst[i] = src[i] / UEPY_OPERAND(c, i);
+		}
+		break;
+	case EPythonVectorArrayOp::Cross:
+		for (int32 i = 0; i < n; i++)
+		{
+			const FPythonArrayReal x = ay[i] * UEPY_OPERAND(2, i) - az[i] * UEPY_OPERAND(1, i);
+			const FPythonArrayReal y = az[i] * UEPY_OPERAND(0, i) - ax[i] * UEPY_OPERAND(2, i);
+			const FPythonArrayReal z = ax[i] * UEPY_OPERAND(1, i) - ay[i] * UEPY_OPERAND(0, i);
+			ox[i] = x;
+			oy[i] = y;
+			oz[i] = z;
+		}
+		break;
+	case EPythonVectorArrayOp::Lerp:
+		for (int32 c = 0; c < 3; c++)
+		{
+			const FPythonArrayReal *src = ue_py_fmath_array_component(a, c);
+			FPythonArrayReal *dst = ue_py_fmath_array_component(out, c);
+			for (int32 i = 0; i < n; i++)
+				dst[i] = src[i] + (UEPY_OPERAND(c, i) - src[i]) * alpha;
+		}
+		break;
+	}
+}
+
+template<bool bBroadcast>
+static void ue_py_fvector_array_dot_kernel(ue_PyFMathArray *a, const FPythonArrayOperand &b, FPythonArrayReal *out)
+{
+	const int32 n = a->num;
+	const FPythonArrayReal *ax = ue_py_fmath_array_component(a, 0);
+	const FPythonArrayReal *ay = ue_py_fmath_array_component(a, 1);
+	const FPythonArrayReal *az = ue_py_fmath_array_component(a, 2);
+	const FPythonArrayReal * const *B = b.Components;
+	for (int32 i = 0; i < n; i++)
+		out[i] = ax[i] * UEPY_OPERAND(0, i) + ay[i] * UEPY_OPERAND(1, i) + az[i] * UEPY_OPERAND(2, i);
+}
+
+// v' = v + w * t + cross(q, t) with t = 2 * cross(q, v), the same formula of FQuat::RotateVector
+template<bool bBroadcast>
+static void ue_py_fvector_array_rotate_kernel(const FPythonArrayReal *vx, const FPythonArrayReal *vy, const FPythonArrayReal *vz, const FPythonArrayReal * const *B, int32 first, bool inverse, FPythonArrayReal *ox, FPythonArrayReal *oy, FPythonArrayReal *oz, int32 n)
+{
+	const FPythonArrayReal sign = inverse ? -1 : 1;
+	for (int32 i = 0; i < n; i++)
+	{
+		const FPythonArrayReal qx = UEPY_OPERAND(first, i) * sign;
+		const FPythonArrayReal qy = UEPY_OPERAND(first + 1, i) * sign;
+		const FPythonArrayReal qz = UEPY_OPERAND(first + 2, i) * sign;
+		const FPythonArrayReal qw = UEPY_OPERAND(first + 3, i);
+		const FPythonArrayReal tx = 2 * (qy * vz[i] - qz * vy[i]);
+		const FPythonArrayReal ty = 2 * (qz * vx[i] - qx * vz[i]);
+		const FPythonArrayReal tz = 2 * (qx * vy[i] - qy * vx[i]);
+		const FPythonArrayReal x = vx[i] + qw * tx + (qy * tz - qz * ty);
+		const FPythonArrayReal y = vy[i] + qw * ty + (qz * tx - qx * tz);
+		const FPythonArrayReal z = vz[i] + qw * tz + (qx * ty - qy * tx);
+		ox[i] = x;
+		oy[i] = y;
+		oz[i] = z;
+	}
+}
+
+// TransformPosition: rotate(v * s) + t, InverseTransformPosition: unrotate(v - t) / s
+template<bool bBroadcast>
+static void ue_py_fvector_array_transform_kernel(ue_PyFMathArray *a, const FPythonArrayOperand &b, bool inverse, ue_PyFMathArray *out)
+{
+	const int32 n = a->num;
+	const FPythonArrayReal * const *B = b.Components;
+	FPythonArrayReal *ox = ue_py_fmath_array_component(out, 0);
+	FPythonArrayReal *oy = ue_py_fmath_array_component(out, 1);
+	FPythonArrayReal *oz = ue_py_fmath_array_component(out, 2);
+
+	if (!inverse)
+	{
+		for (int32 c = 0; c < 3; c++)
+		{
+			const FPythonArrayReal *src = ue_py_fmath_array_component(a, c);
+			FPythonArrayReal *dst = ue_py_fmath_array_component(out, c);
+			for (int32 i = 0; i < n; i++)
+				dst[i] = src[i] * UEPY_OPERAND(7 + c, i);
+		}
+		ue_py_fvector_array_rotate_kernel<bBroadcast>(ox, oy, oz, B, 3, false, ox, oy, oz, n);
+		for (int32 c = 0; c < 3; c++)
+		{
+			FPythonArrayReal *dst = ue_py_fmath_array_component(out, c);
+			for (int32 i = 0; i < n; i++)
+				dst[i] += UEPY_OPERAND(c, i);
+		}
+		return;
+	}
+
+	for (int32 c = 0; c < 3; c++)
+	{
+		const FPythonArrayReal *src = ue_py_fmath_array_component(a, c);
+		FPythonArrayReal *dst = ue_py_fmath_array_component(out, c);
+		for (int32 i = 0; i < n; i++)
+			dst[i] = src[i] - UEPY_OPERAND(c, i);
+	}
+	ue_py_fvector_array_rotate_kernel<bBroadcast>(ox, oy, oz, B, 3, true, ox, oy, oz, n);
+	for (int32 c = 0; c < 3; c++)
+	{
+		FPythonArrayReal *dst = ue_py_fmath_array_component(out, c);
+		for (int32 i = 0; i < n; i++)
+		{
+			const FPythonArrayReal s = UEPY_OPERAND(7 + c, i);
+			dst[i] = s != 0 ? dst[i] / s : 0;
+		}
+	}
+}
+
+// Hamilton product, same as FQuat::operator*
+template<bool bBroadcast>
+static void ue_py_fquat_array_multiply_kernel(ue_PyFMathArray *a, const FPythonArrayOperand &b, ue_PyFMathArray *out)
+{
+	const int32 n = a->num;
+	const FPythonArrayReal * const *B = b.Components;
+	const FPythonArrayReal *ax = ue_py_fmath_array_component(a, 0);
+	const FPythonArrayReal *ay = ue_py_fmath_array_component(a, 1);
+	const FPythonArrayReal *az = ue_py_fmath_array_component(a, 2);
+	const FPythonArrayReal *aw = ue_py_fmath_array_component(a, 3);
+	FPythonArrayReal *ox = ue_py_fmath_array_component(out, 0);
+	FPythonArrayReal *oy = ue_py_fmath_array_component(out, 1);
+	FPythonArrayReal *oz = ue_py_fmath_array_component(out, 2);
+	FPythonArrayReal *ow = ue_py_fmath_array_component(out, 3);
+	for (int32 i = 0; i < n; i++)
+	{
+		const FPythonArrayReal bx = UEPY_OPERAND(0, i);
+		const FPythonArrayReal by = UEPY_OPERAND(1, i);
+		const FPythonArrayReal bz = UEPY_OPERAND(2, i);
+		const FPythonArrayReal bw = UEPY_OPERAND(3, i);
+		const FPythonArrayReal x = aw[i] * bx + ax[i] * bw + ay[i] * bz - az[i] * by;
+		const FPythonArrayReal y = aw[i] * by - ax[i] * bz + ay[i] * bw + az[i] * bx;
+		const FPythonArrayReal z = aw[i] * bz + ax[i] * by - ay[i] * bx + az[i] * bw;
+		const FPythonArrayReal w = aw[i] * bw - ax[i] * bx - ay[i] * by - az[i] * bz;
+		ox[i] = x;
+		oy[i] = y;
+		oz[i] = z;
+		ow[i] = w;
+	}
+}
+
+#undef UEPY_OPERAND
+
+static void ue_py_fmath_array_normalize(ue_PyFMathArray *self, int32 first, int32 components, ue_PyFMathArray *out)
+{
+	const int32 n = self->num;
+	TArray<FPythonArrayReal> inv_length;
+	inv_length.SetNumZeroed(n);
+	for (int32 c = first; c < first + components; c++)
+	{
+		const FPythonArrayReal *src = ue_py_fmath_array_component(self, c);
+		for (int32 i = 0; i < n; i++)
+			inv_length[i] += src[i] * src[i];
+	}
+	for (int32 i = 0; i < n; i++)
+		inv_length[i] = inv_length[i] > SMALL_NUMBER ? 1 / FMath::Sqrt(inv_length[i]) : 0;
+	for (int32 c = first; c < first + components; c++)
+	{
+		const FPythonArrayReal *src = ue_py_fmath_array_component(self, c);
+		FPythonArrayReal *dst = ue_py_fmath_array_component(out, c);
+		for (int32 i = 0; i < n; i++)
+			dst[i] = src[i] * inv_length[i];
+	}
+}
+
+static PyObject *ue_py_fmath_array_reals(const TArray<FPythonArrayReal> &values)
+{
+	return PyByteArray_FromStringAndSize((const char *)values.GetData(), values.Num() * sizeof(FPythonArrayReal));
+}
+
+/* common methods */
+
+static PyObject *py_ue_fmath_array_copy(ue_PyFMathArray *self, PyObject * args)
+{
+	ue_PyFMathArray *ret = ue_py_fmath_array_new(Py_TYPE(self), self->num);
+	FMemory::Memcpy(ret->data, self->data, sizeof(FPythonArrayReal) * self->components * self->num);
+	return (PyObject *)ret;
+}
+
+/* FVectorArray */
+
+static PyObject *ue_py_fvector_array_binary(ue_PyFMathArray *self, PyObject *py_obj, EPythonVectorArrayOp op, bool allow_number, FPythonArrayReal alpha = 0)
+{
+	FPythonArrayOperand operand;
+	if (!ue_py_vector_operand(py_obj, self->num, operand, allow_number))
+		return nullptr;
+
+	ue_PyFMathArray *ret = py_ue_new_fvector_array(self->num);
+	if (operand.bBroadcast)
+		ue_py_fvector_array_kernel<true>(op, self, operand, ret, alpha);
+	else
+		ue_py_fvector_array_kernel<false>(op, self, operand, ret, alpha);
+	return (PyObject *)ret;
+}
+
+static PyObject *py_ue_fvector_array_add(ue_PyFMathArray *self, PyObject * args)
+{
+	PyObject *py_obj;
+	if (!PyArg_ParseTuple(args, "O:add", &py_obj))
+		return nullptr;
+	return ue_py_fvector_array_binary(self, py_obj, EPythonVectorArrayOp::Add, true);
+}
+
+static PyObject *py_ue_fvector_array_sub(ue_PyFMathArray *self, PyObject * args)
+{
+	PyObject *py_obj;
+	if (!PyArg_ParseTuple(args, "O:sub", &py_obj))
+		return nullptr;
+	return ue_py_fvector_array_binary(self, py_obj, EPythonVectorArrayOp::Sub, true);
+}
+
+static PyObject *py_ue_fvector_array_scale(ue_PyFMathArray *self, PyObject * args)
+{
+	PyObject *py_obj;
+	if (!PyArg_ParseTuple(args, "O:scale", &py_obj))
+		return nullptr;
+	return ue_py_fvector_array_binary(self, py_obj, EPythonVectorArrayOp::Mul, true);
+}
+
+static PyObject *py_ue_fvector_array_cross(ue_PyFMathArray *self, PyObject * args)
+{
+	PyObject *py_obj;
+	if (!PyArg_ParseTuple(args, "O:cross", &py_obj))
+		return nullptr;
+	return ue_py_fvector_array_binary(self, py_obj, EPythonVectorArrayOp::Cross, false);
+}
+
+static PyObject *py_ue_fvector_array_lerp(ue_PyFMathArray *self, PyObject * args)
+{
+	PyObject *py_obj;
+	float alpha;
+	if (!PyArg_ParseTuple(args, "Of:lerp", &py_obj, &alpha))
+		return nullptr;
+	return ue_py_fvector_array_binary(self, py_obj, EPythonVectorArrayOp::Lerp, false, alpha);
+}
+
+static PyObject *py_ue_fvector_array_dot(ue_PyFMathArray *self, PyObject * args)
+{
+	PyObject *py_obj;
+	if (!PyArg_ParseTuple(args, "O:dot", &py_obj))
+		return nullptr;
+
+	FPythonArrayOperand operand;
+	if (!ue_py_vector_operand(py_obj, self->num, operand, false))
+		return nullptr;
+
+	TArray<FPythonArrayReal> values;
+	values.SetNumUninitialized(self->num);
+	if (operand.bBroadcast)
+		ue_py_fvector_array_dot_kernel<true>(self, operand, values.GetData());
+	else
+		ue_py_fvector_array_dot_kernel<false>(self, operand, values.GetData());
+	return ue_py_fmath_array_reals(values);
+}
+
+static PyObject *py_ue_fvector_array_length(ue_PyFMathArray *self, PyObject * args)
+{
+	FPythonArrayOperand operand;
+	operand.SetArray(self);
+
+	TArray<FPythonArrayReal> values;
+	values.SetNumUninitialized(self->num);
+	ue_py_fvector_array_dot_kernel<false>(self, operand, values.GetData());
+	for (FPythonArrayReal &value : values)
+		value = FMath::Sqrt(value);
+	return ue_py_fmath_array_reals(values);
+}
+
+static PyObject *py_ue_fvector_array_normalized(ue_PyFMathArray *self, PyObject * args)
+{
+	ue_PyFMathArray *ret = py_ue_new_fvector_array(self->num);
+	ue_py_fmath_array_normalize(self, 0, 3, ret);
+	return (PyObject *)ret;
+}
+
+static PyObject *ue_py_fvector_array_transform(ue_PyFMathArray *self, PyObject * args, bool inverse)
+{
+	PyObject *py_obj;
+	if (!PyArg_ParseTuple(args, inverse ? "O:inverse_transform_by" : "O:transform_by", &py_obj))
+		return nullptr;
+
+	FPythonArrayOperand operand;
+	if (!ue_py_transform_operand(py_obj, self->num, operand))
+		return nullptr;
+
+	ue_PyFMathArray *ret = py_ue_new_fvector_array(self->num);
+	if (operand.bBroadcast)
+		ue_py_fvector_array_transform_kernel<true>(self, operand, inverse, ret);
+	else
+		ue_py_fvector_array_transform_kernel<false>(self, operand, inverse, ret);
+	return (PyObject *)ret;
+}
+
+static PyObject *py_ue_fvector_array_transform_by(ue_PyFMathArray *self, PyObject * args)
+{
+	return ue_py_fvector_array_transform(self, args, false);
+}
+
+static PyObject *py_ue_fvector_array_inverse_transform_by(ue_PyFMathArray *self, PyObject * args)
+{
+	return ue_py_fvector_array_transform(self, args, true);
+}
+
+static PyObject *ue_py_fvector_array_rotate(ue_PyFMathArray *self, PyObject * args, bool inverse)
+{
+	PyObject *py_obj;
+	if (!PyArg_ParseTuple(args, inverse ? "O:unrotate_by" : "O:rotate_by", &py_obj))
+		return nullptr;
+
+	FPythonArrayOperand operand;
+	if (!ue_py_quat_operand(py_obj, self->num, operand))
+		return nullptr;
+
+	ue_PyFMathArray *ret = py_ue_new_fvector_array(self->num);
+	const FPythonArrayReal *vx = ue_py_fmath_array_component(self, 0);
+	const FPythonArrayReal *vy = ue_py_fmath_array_component(self, 1);
+	const FPythonArrayReal *vz = ue_py_fmath_array_component(self, 2);
+	FPythonArrayReal *ox = ue_py_fmath_array_component(ret, 0);
+	FPythonArrayReal *oy = ue_py_fmath_array_component(ret, 1);
+	FPythonArrayReal *oz = ue_py_fmath_array_component(ret, 2);
+	if (operand.bBroadcast)
+		ue_py_fvector_array_rotate_kernel<true>(vx, vy, vz, operand.Components, 0, inverse, ox, oy, oz, self->num);
+	else
+		ue_py_fvector_array_rotate_kernel<false>(vx, vy, vz, operand.Components, 0, inverse, ox, oy, oz, self->num);
+	return (PyObject *)ret;
+}
+
+static PyObject *py_ue_fvector_array_rotate_by(ue_PyFMathArray *self, PyObject * args)
+{
+	return ue_py_fvector_array_rotate(self, args, false);
+}
+
+static PyObject *py_ue_fvector_array_unrotate_by(ue_PyFMathArray *self, PyObject * args)
+{
+	return ue_py_fvector_array_rotate(self, args, true);
+}
+
+static PyMethodDef ue_PyFVectorArray_methods[] = {
+	{ "copy", (PyCFunction)py_ue_fmath_array_copy, METH_VARARGS, "" },
+	{ "add", (PyCFunction)py_ue_fvector_array_add, METH_VARARGS, "" },
+	{ "sub", (PyCFunction)py_ue_fvector_array_sub, METH_VARARGS, "" },
+	{ "scale", (PyCFunction)py_ue_fvector_array_scale, METH_VARARGS, "" },
+	{ "dot", (PyCFunction)py_ue_fvector_array_dot, METH_VARARGS, "" },
+	{ "cross", (PyCFunction)py_ue_fvector_array_cross, METH_VARARGS, "" },
+	{ "length", (PyCFunction)py_ue_fvector_array_length, METH_VARARGS, "" },
+	{ "size", (PyCFunction)py_ue_fvector_array_length, METH_VARARGS, "" },
+	{ "normalized", (PyCFunction)py_ue_fvector_array_normalized, METH_VARARGS, "" },
+	{ "lerp", (PyCFunction)py_ue_fvector_array_lerp, METH_VARARGS, "" },
+	{ "transform_by", (PyCFunction)py_ue_fvector_array_transform_by, METH_VARARGS, "" },
+	{ "inverse_transform_by", (PyCFunction)py_ue_fvector_array_inverse_transform_by, METH_VARARGS, "" },
+	{ "rotate_by", (PyCFunction)py_ue_fvector_array_rotate_by, METH_VARARGS, "" },
+	{ "unrotate_by", (PyCFunction)py_ue_fvector_array_unrotate_by, METH_VARARGS, "" },
+	{ NULL }  /* Sentinel */
+};
+
+/* FQuatArray */
+
+static PyObject *py_ue_fquat_array_normalized(ue_PyFMathArray *self, PyObject * args)
+{
+	ue_PyFMathArray *ret = py_ue_new_fquat_array(self->num);
+	ue_py_fmath_array_normalize(self, 0, 4, ret);
+	return (PyObject *)ret;
+}
+
+static PyObject *py_ue_fquat_array_inverse(ue_PyFMathArray *self, PyObject * args)
+{
+	// conjugate, the quaternions are expected to be normalized like FQuat::Inverse
+	ue_PyFMathArray *ret = py_ue_new_fquat_array(self->num);
+	for (int32 c = 0; c < 4; c++)
+	{
+		const FPythonArrayReal *src = ue_py_fmath_array_component(self, c);
+		FPythonArrayReal *dst = ue_py_fmath_array_component(ret, c);
+		const FPythonArrayReal sign = c < 3 ? -1 : 1;
+		for (int32 i = 0; i < self->num; i++)
+			dst[i] = src[i] * sign;
+	}
+	return (PyObject *)ret;
+}
+
+static PyObject *py_ue_fquat_array_multiply(ue_PyFMathArray *self, PyObject * args)
+{
+	PyObject *py_obj;
+	if (!PyArg_ParseTuple(args, "O:multiply", &py_obj))
+		return nullptr;
+
+	FPythonArrayOperand operand;
+	if (!ue_py_quat_operand(py_obj, self->num, operand))
+		return nullptr;
+
+	ue_PyFMathArray *ret = py_ue_new_fquat_array(self->num);
+	if (operand.bBroadcast)
+		ue_py_fquat_array_multiply_kernel<true>(self, operand, ret);
+	else
+		ue_py_fquat_array_multiply_kernel<false>(self, operand, ret);
+	return (PyObject *)ret;
+}
+
+static PyObject *py_ue_fquat_array_slerp(ue_PyFMathArray *self, PyObject * args)
+{
+	PyObject *py_obj;
+	float alpha;
+	if (!PyArg_ParseTuple(args, "Of:slerp", &py_obj, &alpha))
+		return nullptr;
+
+	FPythonArrayOperand operand;
+	if (!ue_py_quat_operand(py_obj, self->num, operand))
+		return nullptr;
+
+	ue_PyFMathArray *ret = py_ue_new_fquat_array(self->num);
+	const int32 step = operand.bBroadcast ? 0 : 1;
+	for (int32 i = 0; i < self->num; i++)
+	{
+		const int32 j = i * step;
+		const FQuat other(operand.Components[0][j], operand.Components[1][j], operand.Components[2][j], operand.Components[3][j]);
+		ue_py_fquat_array_set(ret, i, FQuat::Slerp(ue_py_fquat_array_at(self, i), other, alpha));
+	}
+	return (PyObject *)ret;
+}
+
+static PyMethodDef ue_PyFQuatArray_methods[] = {
+	{ "copy", (PyCFunction)py_ue_fmath_array_copy, METH_VARARGS, "" },
+	{ "normalized", (PyCFunction)py_ue_fquat_array_normalized, METH_VARARGS, "" },
+	{ "inverse", (PyCFunction)py_ue_fquat_array_inverse, METH_VARARGS, "" },
+	{ "multiply", (PyCFunction)py_ue_fquat_array_multiply, METH_VARARGS, "" },
+	{ "slerp", (PyCFunction)py_ue_fquat_array_slerp, METH_VARARGS, "" },
+	{ NULL }  /* Sentinel */
+};
+
+/* FTransformArray */
+
+static PyObject *ue_py_ftransform_array_extract(ue_PyFMathArray *self, ue_PyFMathArray *ret, int32 first)
+{
+	FMemory::Memcpy(ret->data, ue_py_fmath_array_component(self, first), sizeof(FPythonArrayReal) * ret->components * self->num);
+	return (PyObject *)ret;
+}
+
+static PyObject *py_ue_ftransform_array_get_translations(ue_PyFMathArray *self, PyObject * args)
+{
+	return ue_py_ftransform_array_extract(self, py_ue_new_fvector_array(self->num), 0);
+}
+
+static PyObject *py_ue_ftransform_array_get_rotations(ue_PyFMathArray *self, PyObject * args)
+{
+	return ue_py_ftransform_array_extract(self, py_ue_new_fquat_array(self->num), 3);
+}
+
+static PyObject *py_ue_ftransform_array_get_scales(ue_PyFMathArray *self, PyObject * args)
+{
+	return ue_py_ftransform_array_extract(self, py_ue_new_fvector_array(self->num), 7);
+}
+
+static PyObject *ue_py_ftransform_array_positions(ue_PyFMathArray *self, PyObject * args, bool inverse)
+{
+	PyObject *py_obj;
+	if (!PyArg_ParseTuple(args, inverse ? "O:inverse_transform_positions" : "O:transform_positions", &py_obj))
+		return nullptr;
+
+	ue_PyFMathArray *py_vectors = py_ue_is_fvector_array(py_obj);
+	if (!py_vectors)
+		return PyErr_Format(PyExc_TypeError, "argument is not a FVectorArray");
+
+	if (!ue_py_fmath_array_same_num(py_vectors, self->num))
+		return nullptr;
+
+	FPythonArrayOperand operand;
+	operand.SetArray(self);
+
+	ue_PyFMathArray *ret = py_ue_new_fvector_array(self->num);
+	ue_py_fvector_array_transform_kernel<false>(py_vectors, operand, inverse, ret);
+	return (PyObject *)ret;
+}
+
+static PyObject *py_ue_ftransform_array_transform_positions(ue_PyFMathArray *self, PyObject * args)
+{
+	return ue_py_ftransform_array_positions(self, args, false);
+}
+
+static PyObject *py_ue_ftransform_array_inverse_transform_positions(ue_PyFMathArray *self, PyObject * args)
+{
+	return ue_py_ftransform_array_positions(self, args, true);
+}
+
+static PyObject *py_ue_ftransform_array_inverse(ue_PyFMathArray *self, PyObject * args)
+{
+	ue_PyFMathArray *ret = py_ue_new_ftransform_array(self->num);
+	for (int32 i = 0; i < self->num; i++)
+		ue_py_ftransform_array_set(ret, i, ue_py_ftransform_array_at(self, i).Inverse());
+	return (PyObject *)ret;
+}
+
+static PyObject *py_ue_ftransform_array_multiply(ue_PyFMathArray *self, PyObject * args)
+{
+	PyObject *py_obj;
+	if (!PyArg_ParseTuple(args, "O:multiply", &py_obj))
+		return nullptr;
+
+	ue_PyFMathArray *py_array = py_ue_is_ftransform_array(py_obj);
+	ue_PyFTransform *py_transform = py_array ? nullptr : py_ue_is_ftransform(py_obj);
+	if (!py_array && !py_transform)
+		return PyErr_Format(PyExc_TypeError, "argument is not a FTransformArray or a FTransform");
+	if (py_array && !ue_py_fmath_array_same_num(py_array, self->num))
+		return nullptr;
+
+	ue_PyFMathArray *ret = py_ue_new_ftransform_array(self->num);
+	for (int32 i = 0; i < self->num; i++)
+	{
+		const FTransform other = py_array ? ue_py_ftransform_array_at(py_array, i) : py_transform->transform;
+		ue_py_ftransform_array_set(ret, i, ue_py_ftransform_array_at(self, i) * other);
+	}
+	return (PyObject *)ret;
+}
+
+static PyObject *py_ue_ftransform_array_blend(ue_PyFMathArray *self, PyObject * args)
+{
+	PyObject *py_obj;
+	float alpha;
+	if (!PyArg_ParseTuple(args, "Of:blend", &py_obj, &alpha))
+		return nullptr;
+
+	ue_PyFMathArray *py_array = py_ue_is_ftransform_array(py_obj);
+	ue_PyFTransform *py_transform = py_array ? nullptr : py_ue_is_ftransform(py_obj);
+	if (!py_array && !py_transform)
+		return PyErr_Format(PyExc_TypeError, "argument is not a FTransformArray or a FTransform");
+	if (py_array && !ue_py_fmath_array_same_num(py_array, self->num))
+		return nullptr;
+
+	ue_PyFMathArray *ret = py_ue_new_ftransform_array(self->num);
+	for (int32 i = 0; i < self->num; i++)
+	{
+		FTransform blended;
+		blended.Blend(ue_py_ftransform_array_at(self, i), py_array ? ue_py_ftransform_array_at(py_array, i) : py_transform->transform, alpha);
+		ue_py_ftransform_array_set(ret, i, blended);
+	}
+	return (PyObject *)ret;
+}
+
+static PyMethodDef ue_PyFTransformArray_methods[] = {
+	{ "copy", (PyCFunction)py_ue_fmath_array_copy, METH_VARARGS, "" },
+	{ "get_translations", (PyCFunction)py_ue_ftransform_array_get_translations, METH_VARARGS, "" },
+	{ "get_rotations", (PyCFunction)py_ue_ftransform_array_get_rotations, METH_VARARGS, "" },
+	{ "get_scales", (PyCFunction)py_ue_ftransform_array_get_scales, METH_VARARGS, "" },
+	{ "transform_positions", (PyCFunction)py_ue_ftransform_array_transform_positions, METH_VARARGS, "" },
+	{ "inverse_transform_positions", (PyCFunction)py_ue_ftransform_array_inverse_transform_positions, METH_VARARGS, "" },
+	{ "inverse", (PyCFunction)py_ue_ftransform_array_inverse, METH_VARARGS, "" },
+	{ "multiply", (PyCFunction)py_ue_ftransform_array_multiply, METH_VARARGS, "" },
+	{ "blend", (PyCFunction)py_ue_ftransform_array_blend, METH_VARARGS, "" },
+	{ NULL }  /* Sentinel */
+};
+
+/* number and sequence protocols */
+
+static PyObject *ue_py_fvector_array_number_binary(PyObject *a, PyObject *b, EPythonVectorArrayOp op, bool commutative)
+{
+	ue_PyFMathArray *self = py_ue_is_fvector_array(a);
+	if (!self)
+	{
+		if (!commutative)
+			Py_RETURN_NOTIMPLEMENTED;
+		self = py_ue_is_fvector_array(b);
+		b = a;
+	}
+
+	// unsupported operands let python try the reflected operation of the other type
+	if (!py_ue_is_fvector_array(b) && !py_ue_is_fvector(b))
+	{
+		PyObject *f_value = PyNumber_Check(b) ? PyNumber_Float(b) : nullptr;
+		if (!f_value)
+		{
+			PyErr_Clear();
+			Py_RETURN_NOTIMPLEMENTED;
+		}
+		Py_DECREF(f_value);
+	}
+
+	return ue_py_fvector_array_binary(self, b, op, true);
+}
+
+static PyObject *ue_py_fvector_array_nb_add(PyObject *a, PyObject *b)
+{
+	return ue_py_fvector_array_number_binary(a, b, EPythonVectorArrayOp::Add, true);
+}
+
+static PyObject *ue_py_fvector_array_nb_sub(PyObject *a, PyObject *b)
+{
+	return ue_py_fvector_array_number_binary(a, b, EPythonVectorArrayOp::Sub, false);
+}
+
+static PyObject *ue_py_fvector_array_nb_mul(PyObject *a, PyObject *b)
+{
+	return ue_py_fvector_array_number_binary(a, b, EPythonVectorArrayOp::Mul, true);
+}
+
+static PyObject *ue_py_fvector_array_nb_div(PyObject *a, PyObject *b)
+{
+	return ue_py_fvector_array_number_binary(a, b, EPythonVectorArrayOp::Div, false);
+}
+
+static PyNumberMethods ue_PyFVectorArray_number_methods;
+
+static Py_ssize_t ue_py_fmath_array_seq_length(ue_PyFMathArray *self)
+{
+	return self->num;
+}
+
+static PyObject *ue_py_fmath_array_seq_item(ue_PyFMathArray *self, Py_ssize_t i)
+{
+	if (i < 0 || i >= self->num)
+		return PyErr_Format(PyExc_IndexError, "index out of range");
+	return ue_py_fmath_array_item_to_py(self, (int32)i);
+}
+
+static int ue_py_fmath_array_seq_ass_item(ue_PyFMathArray *self, Py_ssize_t i, PyObject *value)
+{
+	if (i < 0 || i >= self->num)
+	{
+		PyErr_SetString(PyExc_IndexError, "index out of range");
+		return -1;
+	}
+	if (!value)
+	{
+		PyErr_SetString(PyExc_TypeError, "items cannot be deleted");
+		return -1;
+	}
+	return ue_py_fmath_array_item_from_py(self, (int32)i, value) ? 0 : -1;
+}
+
+static PySequenceMethods ue_PyFMathArray_sequence_methods;
+
+/* construction */
+
+// packed array of structures: num * components float32 or float64 values
+// the element type comes from the buffer format ('f' or 'd'), untyped buffers (bytes, bytearray...) need an explicit dtype
+static bool ue_py_fmath_array_from_packed(ue_PyFMathArray *self, PyObject *py_obj, const char *dtype)
+{
+	Py_buffer py_buf;
+	if (PyObject_GetBuffer(py_obj, &py_buf, dtype ? PyBUF_SIMPLE : PyBUF_FORMAT) < 0)
+		return false;
+
+	const char *format = dtype ? dtype : py_buf.format;
+	if (format && (format[0] == '<' || format[0] == '=' || format[0] == '@'))
+		format++;
+	bool is_double = format && ((format[0] == 'd' && format[1] == 0) || !strcmp(format, "float64"));
+	bool is_float = format && ((format[0] == 'f' && format[1] == 0) || !strcmp(format, "float32"));
+	if (!is_double && !is_float)
+	{
+		PyBuffer_Release(&py_buf);
+		if (dtype)
+			PyErr_Format(PyExc_Exception, "unsupported dtype %s (expected 'f', 'd', 'float32' or 'float64')", dtype);
+		else
+			PyErr_SetString(PyExc_Exception, "buffer must contain float32 or float64 values (pass dtype for untyped buffers)");
+		return false;
+	}
+
+	Py_ssize_t element_size = (is_double ? sizeof(double) : sizeof(float)) * self->components;
+	if (py_buf.len % element_size != 0)
+	{
+		PyBuffer_Release(&py_buf);
+		PyErr_Format(PyExc_Exception, "buffer size must be a multiple of %d", (int)element_size);
+		return false;
+	}
+
+	const int32 num = (int32)(py_buf.len / element_size);
+	ue_py_fmath_array_alloc(self, num);
+	for (int32 c = 0; c < self->components; c++)
+	{
+		FPythonArrayReal *dst = ue_py_fmath_array_component(self, c);
+		if (is_double)
+		{
+			const double *src = (const double *)py_buf.buf + c;
+			for (int32 i = 0; i < num; i++)
+				dst[i] = src[i * self->components];
+		}
+		else
+		{
+			const float *src = (const float *)py_buf.buf + c;
+			for (int32 i = 0; i < num; i++)
+				dst[i] = src[i * self->components];
+		}
+	}
+
+	PyBuffer_Release(&py_buf);
+	return true;
+}
+
+static int ue_py_fmath_array_init(ue_PyFMathArray *self, PyObject *args, PyObject *kwargs)
+{
+	PyObject *py_obj = nullptr;
+	char *dtype = nullptr;
+	static char *kw_names[] = { (char *)"data", (char *)"dtype", nullptr };
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "|Oz", kw_names, &py_obj, &dtype))
+		return -1;
+
+	if (self->exports > 0)
+	{
+		PyErr_SetString(PyExc_BufferError, "cannot reinitialize an array with exported buffers");
+		return -1;
+	}
+
+	self->components = ue_py_fmath_array_type_components(Py_TYPE(self));
+
+	if (!py_obj)
+	{
+		ue_py_fmath_array_alloc(self, 0);
+		return 0;
+	}
+
+	if (PyLong_Check(py_obj))
+	{
+		long num = PyLong_AsLong(py_obj);
+		if (num < 0 || num > MAX_int32)
+		{
+			PyErr_SetString(PyExc_ValueError, "invalid array length");
+			return -1;
+		}
+		ue_py_fmath_array_alloc(self, (int32)num);
+		ue_py_fmath_array_reset(self);
+		return 0;
+	}
+
+	if (py_obj == (PyObject *)self)
+		return 0;
+
+	if (py_ue_is_fvector_array(py_obj) || py_ue_is_fquat_array(py_obj) || py_ue_is_ftransform_array(py_obj))
+	{
+		ue_PyFMathArray *other = (ue_PyFMathArray *)py_obj;
+		// their packed buffers have a different layout, never reinterpret them
+		if (ue_py_fmath_array_type_components(Py_TYPE(other)) != self->components)
+		{
+			PyErr_Format(PyExc_TypeError, "cannot build a %s from a %s", Py_TYPE(self)->tp_name, Py_TYPE(other)->tp_name);
+			return -1;
+		}
+		ue_py_fmath_array_alloc(self, other->num);
+		FMemory::Memcpy(self->data, other->data, sizeof(FPythonArrayReal) * self->components * self->num);
+		return 0;
+	}
+
+	if (PyObject_CheckBuffer(py_obj))
+		return ue_py_fmath_array_from_packed(self, py_obj, dtype) ? 0 : -1;
+
+	PyObject *py_seq = PySequence_Fast(py_obj, "argument is not a length, a packed buffer or an iterable");
+	if (!py_seq)
+		return -1;
+
+	const Py_ssize_t num = PySequence_Fast_GET_SIZE(py_seq);
+	ue_py_fmath_array_alloc(self, (int32)num);
+	for (Py_ssize_t i = 0; i < num; i++)
+	{
+		if (!ue_py_fmath_array_item_from_py(self, (int32)i, PySequence_Fast_GET_ITEM(py_seq, i)))
+		{
+			Py_DECREF(py_seq);
+			ue_py_fmath_array_alloc(self, 0);
+			return -1;
+		}
+	}
+	Py_DECREF(py_seq);
+	return 0;
+}
+
+static PyObject *ue_PyFMathArray_str(ue_PyFMathArray *self)
+{
+	return PyUnicode_FromFormat("<unreal_engine.%s of %d items>", Py_TYPE(self)->tp_name + strlen("unreal_engine."), self->num);
+}
+
+#define UEPY_FMATH_ARRAY_TYPE(name, methods) { \
+	PyVarObject_HEAD_INIT(NULL, 0) \
+	"unreal_engine." name, /* tp_name */ \
+	sizeof(ue_PyFMathArray), /* tp_basicsize */ \
+	0,                         /* tp_itemsize */ \
+	(destructor)ue_py_fmath_array_dealloc,       /* tp_dealloc */ \
+	0,                         /* tp_print */ \
+	0,                         /* tp_getattr */ \
+	0,                         /* tp_setattr */ \
+	0,                         /* tp_reserved */ \
+	0,                         /* tp_repr */ \
+	0,                         /* tp_as_number */ \
+	0,                         /* tp_as_sequence */ \
+	0,                         /* tp_as_mapping */ \
+	0,                         /* tp_hash  */ \
+	0,                         /* tp_call */ \
+	(reprfunc)ue_PyFMathArray_str, /* tp_str */ \
+	0,                         /* tp_getattro */ \
+	0,                         /* tp_setattro */ \
+	&ue_PyFMathArray_as_buffer, /* tp_as_buffer */ \
+	Py_TPFLAGS_DEFAULT,        /* tp_flags */ \
+	"Unreal Engine " name,     /* tp_doc */ \
+	0,                         /* tp_traverse */ \
+	0,                         /* tp_clear */ \
+	0,                         /* tp_richcompare */ \
+	0,                         /* tp_weaklistoffset */ \
+	0,                         /* tp_iter */ \
+	0,                         /* tp_iternext */ \
+	methods,                   /* tp_methods */ \
+}
+
+PyTypeObject ue_PyFVectorArrayType = UEPY_FMATH_ARRAY_TYPE("FVectorArray", ue_PyFVectorArray_methods);
+PyTypeObject ue_PyFQuatArrayType = UEPY_FMATH_ARRAY_TYPE("FQuatArray", ue_PyFQuatArray_methods);
+PyTypeObject ue_PyFTransformArrayType = UEPY_FMATH_ARRAY_TYPE("FTransformArray", ue_PyFTransformArray_methods);
+
+#undef UEPY_FMATH_ARRAY_TYPE
+
+void ue_python_init_fmath_arrays(PyObject *ue_module)
+{
+	memset(&ue_PyFMathArray_sequence_methods, 0, sizeof(PySequenceMethods));
+	ue_PyFMathArray_sequence_methods.sq_length = (lenfunc)ue_py_fmath_array_seq_length;
+	ue_PyFMathArray_sequence_methods.sq_item = (ssizeargfunc)ue_py_fmath_array_seq_item;
+	ue_PyFMathArray_sequence_methods.sq_ass_item = (ssizeobjargproc)ue_py_fmath_array_seq_ass_item;
+
+	memset(&ue_PyFVectorArray_number_methods, 0, sizeof(PyNumberMethods));
+	ue_PyFVectorArray_number_methods.nb_add = (binaryfunc)ue_py_fvector_array_nb_add;
+	ue_PyFVectorArray_number_methods.nb_subtract = (binaryfunc)ue_py_fvector_array_nb_sub;
+	ue_PyFVectorArray_number_methods.nb_multiply = (binaryfunc)ue_py_fvector_array_nb_mul;
+	ue_PyFVectorArray_number_methods.nb_true_divide = (binaryfunc)ue_py_fvector_array_nb_div;
+	ue_PyFVectorArrayType.tp_as_number = &ue_PyFVectorArray_number_methods;
+
+	PyTypeObject *types[] = { &ue_PyFVectorArrayType, &ue_PyFQuatArrayType, &ue_PyFTransformArrayType };
+	for (PyTypeObject *type : types)
+	{
+		type->tp_new = PyType_GenericNew;
+		type->tp_init = (initproc)ue_py_fmath_array_init;
+		type->tp_as_sequence = &ue_PyFMathArray_sequence_methods;
+
+		if (PyType_Ready(type) < 0)
+			return;
+
+		Py_INCREF(type);
+		PyModule_AddObject(ue_module, type->tp_name + strlen("unreal_engine."), (PyObject *)type);
+	}
+}
+
+ue_PyFMathArray *py_ue_new_fvector_array(int32 num)
+{
+	return ue_py_fmath_array_new(&ue_PyFVectorArrayType, num);
+}
+
+ue_PyFMathArray *py_ue_new_fquat_array(int32 num)
+{
+	return ue_py_fmath_array_new(&ue_PyFQuatArrayType, num);
+}
+
+ue_PyFMathArray *py_ue_new_ftransform_array(int32 num)
+{
+	return ue_py_fmath_array_new(&ue_PyFTransformArrayType, num);
+}
+
+ue_PyFMathArray *py_ue_is_fvector_array(PyObject *obj)
+{
+	if (!PyObject_IsInstance(obj, (PyObject *)&ue_PyFVectorArrayType))
+		return nullptr;
+	return (ue_PyFMathArray *)obj;
+}
+
+ue_PyFMathArray *py_ue_is_fquat_array(PyObject *obj)
+{
+	if (!PyObject_IsInstance(obj, (PyObject *)&ue_PyFQuatArrayType))
+		return nullptr;
+	return (ue_PyFMathArray *)obj;
+}
+
+ue_PyFMathArray *py_ue_is_ftransform_array(PyObject *obj)
+{
+	if (!PyObject_IsInstance(obj, (PyObject *)&ue_PyFTransformArrayType))
+		return nullptr;
+	return (ue_PyFMathArray *)obj;
+}
+
+bool py_ue_fvector_array_get(PyObject *obj, TArray<FVector> &vectors)
+{
+	ue_PyFMathArray *py_array = py_ue_is_fvector_array(obj);
+	if (!py_array)
+		return false;
+
+	vectors.SetNumUninitialized(py_array->num);
+	for (int32 i = 0; i < py_array->num; i++)
+		vectors[i] = ue_py_fvector_array_at(py_array, i);
+	return true;
+}
+
+bool py_ue_ftransform_array_get(PyObject *obj, TArray<FTransform> &transforms)
+{
+	ue_PyFMathArray *py_array = py_ue_is_ftransform_array(obj);
+	if (!py_array)
+		return false;
+
+	transforms.SetNumUninitialized(py_array->num);
+	for (int32 i = 0; i < py_array->num; i++)
+		transforms[i] = ue_py_ftransform_array_at(py_array, i);
+	return true;
+}
+
+PyObject *py_ue_new_ftransform_array_from(const TArray<FTransform> &transforms)
+{
+	ue_PyFMathArray *ret = py_ue_new_ftransform_array(transforms.Num());
+	if (!ret)
+		return nullptr;
+	for (int32 i = 0; i < transforms.Num(); i++)
+		ue_py_ftransform_array_set(ret, i, transforms[i]);
+	return (PyObject *)ret;
+}
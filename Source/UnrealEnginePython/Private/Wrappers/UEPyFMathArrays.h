@@ -0,0 +1,55 @@
+#pragma once
+
+
+
+#include "UEPyModule.h"
+
+#include "Runtime/Core/Public/Math/Quat.h"
+
+#if ENGINE_MAJOR_VERSION == 5
+typedef double FPythonArrayReal;
+#else
+typedef float FPythonArrayReal;
+#endif
+
+/*
+
+FVectorArray, FQuatArray and FTransformArray store their elements as structure of arrays:
+every component is a contiguous run of num values (x0 x1 ... y0 y1 ... z0 z1 ...).
+The buffer protocol exposes them as a writable (components, num) matrix of FPythonArrayReal.
+
+FTransformArray components are tx ty tz qx qy qz qw sx sy sz.
+
+*/
+typedef struct
+{
+	PyObject_HEAD
+		/* Type-specific fields go here. */
+	int32 num;
+	int32 components;
+	// number of live buffer exports, the storage cannot be reallocated while > 0
+	int32 exports;
+	FPythonArrayReal *data;
+	Py_ssize_t shape[2];
+	Py_ssize_t strides[2];
+} ue_PyFMathArray;
+
+extern PyTypeObject ue_PyFVectorArrayType;
+extern PyTypeObject ue_PyFQuatArrayType;
+extern PyTypeObject ue_PyFTransformArrayType;
+
+ue_PyFMathArray *py_ue_new_fvector_array(int32);
+ue_PyFMathArray *py_ue_new_fquat_array(int32);
+ue_PyFMathArray *py_ue_new_ftransform_array(int32);
+
+ue_PyFMathArray *py_ue_is_fvector_array(PyObject *);
+ue_PyFMathArray *py_ue_is_fquat_array(PyObject *);
+ue_PyFMathArray *py_ue_is_ftransform_array(PyObject *);
+
+// returns false (without setting an error) when the object is not an FVectorArray
+bool py_ue_fvector_array_get(PyObject *, TArray<FVector> &);
+// returns false (without setting an error) when the object is not an FTransformArray
+bool py_ue_ftransform_array_get(PyObject *, TArray<FTransform> &);
+PyObject *py_ue_new_ftransform_array_from(const TArray<FTransform> &);
+
+void ue_python_init_fmath_arrays(PyObject *);
@@ -1,4 +1,5 @@
 #include "UEPyFRawAnimSequenceTrack.h"
+#include "UEPyFMathArrays.h"
 
 static PyObject *py_ue_fraw_anim_sequence_track_get_pos_keys(ue_PyFRawAnimSequenceTrack *self, void *closure)
 {
@@ -55,6 +56,15 @@ static PyObject *py_ue_fraw_anim_sequence_track_get_rot_keys(ue_PyFRawAnimSequen
 static int py_ue_fraw_anim_sequence_track_set_pos_keys(ue_PyFRawAnimSequenceTrack *self, PyObject *value, void *closure)
 {
 	TArray<FVector> pos;
+	if (value && py_ue_fvector_array_get(value, pos))
+	{
+#if ENGINE_MAJOR_VERSION == 5
+		self->raw_anim_sequence_track.PosKeys = TArray<FVector3f>(pos);
+#else
+		self->raw_anim_sequence_track.PosKeys = pos;
+#endif
+		return 0;
+	}
 	if (value)
 	{
 		PyObject *py_iter = PyObject_GetIter(value);
@@ -90,6 +100,15 @@ static int py_ue_fraw_anim_sequence_track_set_pos_keys(ue_PyFRawAnimSequenceTrac
 static int py_ue_fraw_anim_sequence_track_set_scale_keys(ue_PyFRawAnimSequenceTrack *self, PyObject *value, void *closure)
 {
 	TArray<FVector> scale;
+	if (value && py_ue_fvector_array_get(value, scale))
+	{
+#if ENGINE_MAJOR_VERSION == 5
+		self->raw_anim_sequence_track.ScaleKeys = TArray<FVector3f>(scale);
+#else
+		self->raw_anim_sequence_track.ScaleKeys = scale;
+#endif
+		return 0;
+	}
 	if (value)
 	{
 		PyObject *py_iter = PyObject_GetIter(value);
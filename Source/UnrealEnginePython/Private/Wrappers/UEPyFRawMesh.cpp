@@ -1,4 +1,5 @@
 #include "UEPyFRawMesh.h"
+#include "UEPyFMathArrays.h"
 
 #if WITH_EDITOR
 
@@ -14,6 +15,17 @@ static PyObject *py_ue_fraw_mesh_set_vertex_positions(ue_PyFRawMesh *self, PyObj
 		return nullptr;
 	}
 
+	TArray<FVector> packed;
+	if (py_ue_fvector_array_get(data, packed))
+	{
+#if ENGINE_MAJOR_VERSION == 5
+		self->raw_mesh.VertexPositions = TArray<FVector3f>(packed);
+#else
+		self->raw_mesh.VertexPositions = packed;
+#endif
+		Py_RETURN_NONE;
+	}
+
 	PyObject *iter = PyObject_GetIter(data);
 	if (!iter)
 		return PyErr_Format(PyExc_TypeError, "argument is not an iterable");
@@ -262,6 +274,17 @@ static PyObject *py_ue_fraw_mesh_set_wedge_tangent_x(ue_PyFRawMesh *self, PyObje
 		return nullptr;
 	}
 
+	TArray<FVector> packed;
+	if (py_ue_fvector_array_get(data, packed))
+	{
+#if ENGINE_MAJOR_VERSION == 5
+		self->raw_mesh.WedgeTangentX = TArray<FVector3f>(packed);
+#else
+		self->raw_mesh.WedgeTangentX = packed;
+#endif
+		Py_RETURN_NONE;
+	}
+
 	PyObject *iter = PyObject_GetIter(data);
 	if (!iter)
 		return PyErr_Format(PyExc_TypeError, "argument is not an iterable");
@@ -327,6 +350,17 @@ static PyObject *py_ue_fraw_mesh_set_wedge_tangent_y(ue_PyFRawMesh *self, PyObje
 		return nullptr;
 	}
 
+	TArray<FVector> packed;
+	if (py_ue_fvector_array_get(data, packed))
+	{
+#if ENGINE_MAJOR_VERSION == 5
+		self->raw_mesh.WedgeTangentY = TArray<FVector3f>(packed);
+#else
+		self->raw_mesh.WedgeTangentY = packed;
+#endif
+		Py_RETURN_NONE;
+	}
+
 	PyObject *iter = PyObject_GetIter(data);
 	if (!iter)
 		return PyErr_Format(PyExc_TypeError, "argument is not an iterable");
@@ -392,6 +426,17 @@ static PyObject *py_ue_fraw_mesh_set_wedge_tangent_z(ue_PyFRawMesh *self, PyObje
 		return nullptr;
 	}
 
+	TArray<FVector> packed;
+	if (py_ue_fvector_array_get(data, packed))
+	{
+#if ENGINE_MAJOR_VERSION == 5
+		self->raw_mesh.WedgeTangentZ = TArray<FVector3f>(packed);
+#else
+		self->raw_mesh.WedgeTangentZ = packed;
+#endif
+		Py_RETURN_NONE;
+	}
+
 	PyObject *iter = PyObject_GetIter(data);
 	if (!iter)
 		return PyErr_Format(PyExc_TypeError, "argument is not an iterable");
@@ -206,6 +206,10 @@ static PyObject *ue_py_fvector_add(ue_PyFVector *self, PyObject *value)
 		vec.Z += f;
 		Py_DECREF(f_value);
 	}
+	else
+	{
+		Py_RETURN_NOTIMPLEMENTED;
+	}
 	return py_ue_new_fvector(vec);
 }
 
@@ -226,6 +230,10 @@ static PyObject *ue_py_fvector_sub(ue_PyFVector *self, PyObject *value)
 		vec.Z -= f;
 		Py_DECREF(f_value);
 	}
+	else
+	{
+		Py_RETURN_NOTIMPLEMENTED;
+	}
 	return py_ue_new_fvector(vec);
 }
 
@@ -252,6 +260,10 @@ static PyObject *ue_py_fvector_mul(ue_PyFVector *self, PyObject *value)
 		vec *= f;
 		Py_DECREF(f_value);
 	}
+	else
+	{
+		Py_RETURN_NOTIMPLEMENTED;
+	}
 	return py_ue_new_fvector(vec);
 }
 
@@ -274,6 +286,10 @@ static PyObject *ue_py_fvector_div(ue_PyFVector *self, PyObject *value)
 		vec /= f;
 		Py_DECREF(f_value);
 	}
+	else
+	{
+		Py_RETURN_NOTIMPLEMENTED;
+	}
 	return py_ue_new_fvector(vec);
 }
 
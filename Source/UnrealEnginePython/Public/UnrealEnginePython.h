@@ -190,8 +190,12 @@ public:
 	TArray<FString> ScriptsPaths;
 	FString ZipPath;
 	FString AdditionalModulesPath;
+	// zip of the (precompiled) standard library, searched before the default python paths
+	FString StdlibZipPath;
 
 	bool BrutalFinalize;
+	// register the Slate, FBX and HTTP types on first access
+	bool LazySubmodules;
 
 	// pep8ize a string using various strategy (currently only autopep8 is supported)
 	FString Pep8ize(FString Code);
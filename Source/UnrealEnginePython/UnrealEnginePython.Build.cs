@@ -211,6 +211,7 @@ public class UnrealEnginePython : ModuleRules
                 "UnrealEd",
                 "LevelEditor",
                 "BlueprintGraph",
+                "Kismet",
                 "Projects",
                 "Sequencer",
                 "SequencerWidgets",
@@ -230,7 +231,8 @@ public class UnrealEnginePython : ModuleRules
                 "Persona",
                 "PropertyEditor",
                 "LandscapeEditor",
-                "MaterialEditor"
+                "MaterialEditor",
+                "DirectoryWatcher"
             });
         }
 
@@ -1,7 +1,7 @@
 import unittest
 import unreal_engine as ue
 from unreal_engine.classes import Actor, Character, CharacterMovementComponent, CapsuleComponent
-from unreal_engine import FVector, FRotator
+from unreal_engine import FVector, FRotator, FTransform
 import time
 import math
 
@@ -56,6 +56,26 @@ class TestActor(unittest.TestCase):
     	new_actor = self.world.actor_spawn(Character, FVector(100, 200, 300))
     	self.assertTrue(len(new_actor.get_actor_components()), 4)
 
+    def test_set_transforms_unbatched_parent(self):
+    	root = self.world.actor_spawn(Character, FVector())
+    	middle = self.world.actor_spawn(Character, FVector())
+    	leaf = self.world.actor_spawn(Character, FVector())
+    	middle.attach_to_actor(root)
+    	leaf.attach_to_actor(middle)
+    	middle.set_actor_location(FVector(100, 0, 0))
+    	middle.set_actor_rotation(FRotator(0, 0, 90))
+    	leaf.set_actor_location(FVector(100, 50, 0))
+    	# the middle actor is not in the batch, it follows the root and the leaf must still land on its world transform
+    	ue.set_transforms([root, leaf], [FTransform(FVector(0, 0, 500)), FTransform(FVector(10, 20, 30))])
+    	middle_location = middle.get_actor_location()
+    	leaf_location = leaf.get_actor_location()
+    	self.assertAlmostEqual(middle_location.x, 100, places=2)
+    	self.assertAlmostEqual(middle_location.z, 500, places=2)
+    	self.assertTrue(math.fabs(90 - middle.get_actor_rotation().yaw) < 0.1)
+    	self.assertAlmostEqual(leaf_location.x, 10, places=2)
+    	self.assertAlmostEqual(leaf_location.y, 20, places=2)
+    	self.assertAlmostEqual(leaf_location.z, 30, places=2)
+
 
 
 if __name__ == '__main__':
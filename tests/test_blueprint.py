@@ -51,6 +51,49 @@ class TestBlueprint(unittest.TestCase):
         new_actor.TestEvent()
         self.assertEqual(new_actor.get_actor_location(), FVector(17, 30, 22))
 
+    def test_graph_batch(self):
+        new_blueprint = ue.create_blueprint(Character, '/Game/Tests/Blueprints/Test4_' + self.random_string)
+        ue.blueprint_add_member_variable(new_blueprint, 'TestValue', 'int')
+        uber_page = new_blueprint.UberGraphPages[0]
+        ue.begin_graph_batch()
+        try:
+            test_event = uber_page.graph_add_node_custom_event('TestEvent', 0, 0)
+            node_get = uber_page.graph_add_node_variable_get('TestValue', None, 0, 200)
+            node_set = uber_page.graph_add_node_variable_set('TestValue', None, 300, 0)
+            test_event.node_find_pin('then').make_link_to(node_set.node_find_pin('execute'))
+            node_get.node_find_pin('TestValue').make_link_to(node_set.node_find_pin('TestValue'))
+        finally:
+            touched, failed = ue.end_graph_batch()
+        self.assertEqual(touched, [new_blueprint])
+        self.assertEqual(failed, [])
+        self.assertTrue(node_get in uber_page.Nodes)
+        self.assertTrue(node_set in uber_page.Nodes)
+        new_actor = self.world.actor_spawn(new_blueprint.GeneratedClass)
+        self.assertTrue(hasattr(new_actor, 'TestEvent'))
+
+    def test_graph_batch_nested(self):
+        new_blueprint = ue.create_blueprint(Character, '/Game/Tests/Blueprints/Test5_' + self.random_string)
+        uber_page = new_blueprint.UberGraphPages[0]
+        ue.begin_graph_batch()
+        ue.begin_graph_batch()
+        uber_page.graph_add_node_custom_event('TestEvent', 0, 0)
+        self.assertEqual(ue.end_graph_batch(compile=False), ([], []))
+        touched, failed = ue.end_graph_batch(compile=False)
+        self.assertEqual(touched, [new_blueprint])
+        self.assertEqual(failed, [])
+        self.assertRaises(Exception, ue.end_graph_batch)
+
+    def test_compile_blueprints(self):
+        blueprints = [ue.create_blueprint(Actor, '/Game/Tests/Blueprints/Test6_{0}_{1}'.format(i, self.random_string)) for i in range(3)]
+        for blueprint in blueprints:
+            ue.blueprint_add_member_variable(blueprint, 'TestValue', 'int')
+        self.assertEqual(ue.compile_blueprints(blueprints), [])
+        for blueprint in blueprints:
+            new_actor = self.world.actor_spawn(blueprint.GeneratedClass)
+            new_actor.TestValue = 17
+            self.assertEqual(new_actor.get_property('TestValue'), 17)
+        self.assertRaises(Exception, ue.compile_blueprints, [Actor])
+
 
 if __name__ == '__main__':
     unittest.main(exit=False)
@@ -0,0 +1,146 @@
+import unittest
+import struct
+import unreal_engine as ue
+from unreal_engine import FVector, FQuat, FRotator, FTransform, FVectorArray, FQuatArray, FTransformArray
+
+def make_quat(a, b, c):
+    return FRotator(a, b, c).quaternion()
+
+def make_transform(translation, rotation, scale):
+    return FTransform(translation, rotation, scale)
+
+def reals(data, num):
+    # dot and length return packed float64 (float32 on UE4)
+    fmt = 'd' if len(data) == num * 8 else 'f'
+    return struct.unpack('{0}{1}'.format(num, fmt), bytes(data))
+
+class ReflectedOperand:
+    def __radd__(self, other):
+        return 'radd'
+    def __rmul__(self, other):
+        return 'rmul'
+    def __rsub__(self, other):
+        return 'rsub'
+
+class TestFMathArrays(unittest.TestCase):
+
+    def setUp(self):
+        self.vectors = [FVector(1, 2, 3), FVector(-4, 5, 0.5), FVector(0, -7, 10), FVector(3, 3, -3)]
+        self.others = [FVector(0.5, 0, 2), FVector(1, 1, 1), FVector(-2, 3, 4), FVector(6, -1, 0)]
+        self.quats = [make_quat(10, 20, 30), make_quat(-45, 90, 0), make_quat(0, 0, 170), make_quat(33, -12, 5)]
+        self.transforms = [make_transform(FVector(10, 20, 30), self.quats[0], FVector(1, 2, 3)),
+            make_transform(FVector(-5, 0, 1), self.quats[1], FVector(2, 2, 2)),
+            make_transform(FVector(0, 0, 0), self.quats[2], FVector(1, 1, 1)),
+            make_transform(FVector(100, -100, 7), self.quats[3], FVector(0.5, 0.5, 0.5))]
+
+    def assertVectorEqual(self, a, b):
+        self.assertAlmostEqual(a.x, b.x, places=3)
+        self.assertAlmostEqual(a.y, b.y, places=3)
+        self.assertAlmostEqual(a.z, b.z, places=3)
+
+    def assertQuatEqual(self, a, b):
+        self.assertAlmostEqual(a.x, b.x, places=4)
+        self.assertAlmostEqual(a.y, b.y, places=4)
+        self.assertAlmostEqual(a.z, b.z, places=4)
+        self.assertAlmostEqual(a.w, b.w, places=4)
+
+    def assertTransformEqual(self, a, b):
+        self.assertVectorEqual(a.translation, b.translation)
+        self.assertQuatEqual(a.quaternion, b.quaternion)
+        self.assertVectorEqual(a.scale, b.scale)
+
+    def test_vector_array_arithmetic(self):
+        a = FVectorArray(self.vectors)
+        b = FVectorArray(self.others)
+        added = a + b
+        subtracted = a - b
+        multiplied = a * b
+        divided = a / FVector(2, 4, 8)
+        scaled = a.scale(3)
+        for i in range(len(self.vectors)):
+            self.assertVectorEqual(added[i], self.vectors[i] + self.others[i])
+            self.assertVectorEqual(subtracted[i], self.vectors[i] - self.others[i])
+            self.assertVectorEqual(multiplied[i], self.vectors[i] * self.others[i])
+            self.assertVectorEqual(divided[i], self.vectors[i] / FVector(2, 4, 8))
+            self.assertVectorEqual(scaled[i], self.vectors[i] * 3)
+
+    def test_vector_array_cross_dot_length(self):
+        a = FVectorArray(self.vectors)
+        b = FVectorArray(self.others)
+        crossed = a.cross(b)
+        dots = reals(a.dot(b), len(self.vectors))
+        lengths = reals(a.length(), len(self.vectors))
+        normalized = a.normalized()
+        for i in range(len(self.vectors)):
+            self.assertVectorEqual(crossed[i], self.vectors[i].cross(self.others[i]))
+            self.assertAlmostEqual(dots[i], self.vectors[i].dot(self.others[i]), places=3)
+            self.assertAlmostEqual(lengths[i], self.vectors[i].length(), places=3)
+            self.assertVectorEqual(normalized[i], self.vectors[i].normalized())
+
+    def test_vector_array_lerp(self):
+        lerped = FVectorArray(self.vectors).lerp(FVectorArray(self.others), 0.25)
+        for i in range(len(self.vectors)):
+            self.assertVectorEqual(lerped[i], self.vectors[i] + (self.others[i] - self.vectors[i]) * 0.25)
+
+    def test_vector_array_rotate(self):
+        a = FVectorArray(self.vectors)
+        rotated = a.rotate_by(FQuatArray(self.quats))
+        unrotated = a.unrotate_by(FQuatArray(self.quats))
+        broadcast = a.rotate_by(self.quats[0])
+        for i in range(len(self.vectors)):
+            self.assertVectorEqual(rotated[i], self.quats[i] * self.vectors[i])
+            self.assertVectorEqual(unrotated[i], self.quats[i].inverse() * self.vectors[i])
+            self.assertVectorEqual(broadcast[i], self.quats[0] * self.vectors[i])
+
+    def test_vector_array_transform(self):
+        a = FVectorArray(self.vectors)
+        transformed = a.transform_by(FTransformArray(self.transforms))
+        # uniform scales only, FTransform.inverse() of a non uniform scale is not an exact inverse
+        uniform = self.transforms[1:]
+        b = FVectorArray(self.vectors[1:])
+        inverse_transformed = b.inverse_transform_by(FTransformArray(uniform))
+        for i in range(len(self.vectors)):
+            self.assertVectorEqual(transformed[i], self.transforms[i].transform_position(self.vectors[i]))
+        for i in range(len(uniform)):
+            self.assertVectorEqual(inverse_transformed[i], uniform[i].inverse().transform_position(self.vectors[i + 1]))
+
+    def test_vector_array_reflected_operand(self):
+        a = FVectorArray(self.vectors)
+        self.assertEqual(a + ReflectedOperand(), 'radd')
+        self.assertEqual(a * ReflectedOperand(), 'rmul')
+        self.assertEqual(a - ReflectedOperand(), 'rsub')
+        self.assertRaises(TypeError, lambda: a + 'not a vector')
+        self.assertRaises(TypeError, lambda: 'not a vector' - a)
+        # FVector defers to the array too
+        scaled = FVector(2, 2, 2) * a
+        for i in range(len(self.vectors)):
+            self.assertVectorEqual(scaled[i], self.vectors[i] * 2)
+
+    def test_quat_array(self):
+        a = FQuatArray(self.quats)
+        b = FQuatArray(list(reversed(self.quats)))
+        multiplied = a.multiply(b)
+        inverted = a.inverse()
+        normalized = FQuatArray([q * 2 for q in self.quats]).normalized()
+        for i in range(len(self.quats)):
+            self.assertQuatEqual(multiplied[i], self.quats[i] * self.quats[-1 - i])
+            self.assertQuatEqual(inverted[i], self.quats[i].inverse())
+            self.assertQuatEqual(normalized[i], (self.quats[i] * 2).get_normalized())
+
+    def test_transform_array(self):
+        a = FTransformArray(self.transforms)
+        b = FTransformArray(list(reversed(self.transforms)))
+        multiplied = a.multiply(b)
+        inverted = a.inverse()
+        positions = a.transform_positions(FVectorArray(self.vectors))
+        for i in range(len(self.transforms)):
+            self.assertTransformEqual(multiplied[i], self.transforms[i] * self.transforms[-1 - i])
+            self.assertTransformEqual(inverted[i], self.transforms[i].inverse())
+            self.assertVectorEqual(positions[i], self.transforms[i].transform_position(self.vectors[i]))
+        self.assertVectorEqual(a.get_translations()[0], self.transforms[0].translation)
+        self.assertVectorEqual(a.get_scales()[1], self.transforms[1].scale)
+        self.assertQuatEqual(a.get_rotations()[2], self.transforms[2].quaternion)
+
+
+if __name__ == '__main__':
+    unittest.main(exit=False)
@@ -1,6 +1,8 @@
 import unittest
 import unreal_engine as ue
-from unreal_engine.classes import LevelSequenceFactoryNew, Character, MovieSceneAudioTrack, CineCameraActor
+from unreal_engine.classes import LevelSequenceFactoryNew, Character, MovieSceneAudioTrack, CineCameraActor, MovieScene3DTransformTrack
+import struct
+import array
 
 class TestSequencer(unittest.TestCase):
 
@@ -59,3 +61,60 @@ class TestSequencer(unittest.TestCase):
     	new_subfolder = self.asset.sequencer_create_folder('Test003', new_folder)
     	self.assertTrue(new_subfolder in self.asset.sequencer_folders(new_folder))
 
+    def test_add_keys(self):
+    	world = ue.get_editor_world()
+    	character = world.actor_spawn(Character)
+    	guid = self.asset.sequencer_add_actor(character)
+    	transform_track = self.asset.sequencer_add_track(MovieScene3DTransformTrack, guid)
+    	transform_section = transform_track.sequencer_track_add_section()
+    	times = struct.pack('3d', 0.0, 0.5, 1.0)
+    	values = struct.pack('27d', *([17, 22, 30, 0, 0, 0, 1, 1, 1] * 3))
+    	self.assertEqual(transform_section.sequencer_section_add_keys(times, values, interpolation=3), 3)
+    	keys = transform_section.sequencer_section_get_keys(0)
+    	self.assertEqual(struct.unpack('3d', keys['times']), (0.0, 0.5, 1.0))
+    	self.assertEqual(struct.unpack('3d', keys['values']), (17.0, 17.0, 17.0))
+
+    def test_add_keys_invalid_interpolation(self):
+    	world = ue.get_editor_world()
+    	character = world.actor_spawn(Character)
+    	guid = self.asset.sequencer_add_actor(character)
+    	transform_track = self.asset.sequencer_add_track(MovieScene3DTransformTrack, guid)
+    	transform_section = transform_track.sequencer_track_add_section()
+    	with self.assertRaises(Exception):
+    		transform_section.sequencer_section_add_keys([0.0], [0] * 9, interpolation=float('nan'))
+    	with self.assertRaises(Exception):
+    		transform_section.sequencer_section_add_keys([0.0], [0] * 9, interpolation=300)
+    	with self.assertRaises(Exception):
+    		transform_section.sequencer_section_add_keys([0.0], [0] * 9, interpolation=[-1])
+
+    def test_add_keys_typed_buffers(self):
+    	world = ue.get_editor_world()
+    	character = world.actor_spawn(Character)
+    	guid = self.asset.sequencer_add_actor(character)
+    	transform_track = self.asset.sequencer_add_track(MovieScene3DTransformTrack, guid)
+    	transform_section = transform_track.sequencer_track_add_section()
+    	times = array.array('f', [0.0, 0.5, 1.0])
+    	values = array.array('d', [17, 22, 30, 0, 0, 0, 1, 1, 1] * 3)
+    	interpolation = memoryview(bytes([3, 4, 3])).cast('B')
+    	self.assertEqual(transform_section.sequencer_section_add_keys(times, values, interpolation=interpolation), 3)
+    	keys = transform_section.sequencer_section_get_keys(0)
+    	self.assertEqual(list(keys['interpolation']), [3, 4, 3])
+    	# the returned buffers are typed, so they can be passed back
+    	self.assertEqual(transform_section.sequencer_section_add_keys(keys['times'], keys['values'], interpolation=keys['interpolation'], channel=0), 3)
+    	self.assertEqual(list(transform_section.sequencer_section_get_keys(0)['values']), [17.0, 17.0, 17.0])
+
+    def test_add_keys_untyped_bytes(self):
+    	world = ue.get_editor_world()
+    	character = world.actor_spawn(Character)
+    	guid = self.asset.sequencer_add_actor(character)
+    	transform_track = self.asset.sequencer_add_track(MovieScene3DTransformTrack, guid)
+    	transform_section = transform_track.sequencer_track_add_section()
+    	values = struct.pack('9d', 17, 22, 30, 0, 0, 0, 1, 1, 1)
+    	# bytes are packed float64, not uint8
+    	with self.assertRaises(Exception):
+    		transform_section.sequencer_section_add_keys(bytes([0, 1, 2]), values)
+    	# uint8 buffers are accepted only for the interpolation
+    	with self.assertRaises(Exception):
+    		transform_section.sequencer_section_add_keys(array.array('B', [0]), values)
+    	with self.assertRaises(Exception):
+    		transform_section.sequencer_section_add_keys(struct.pack('d', 0.0), values, interpolation=bytes([3]))
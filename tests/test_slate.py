@@ -0,0 +1,48 @@
+import unittest
+import unreal_engine as ue
+from unreal_engine import SPythonListView, STableRow, STextBlock
+import gc
+import weakref
+
+class TestSlate(unittest.TestCase):
+
+    def generate_row(self, item, table):
+        return STableRow(owner_table=table)(STextBlock(text=str(item)))
+
+    def test_list_view_replace_selected_items(self):
+        list_view = SPythonListView(list_items_source=['one', 'two', 'three'], item_key=lambda item: item, on_generate_row=self.generate_row)
+        list_view.set_item_selection(0)
+        list_view.set_item_selection(2)
+        self.assertEqual(list_view.get_num_items_selected(), 2)
+        list_view.update_item_source_list(['zero', 'one', 'three'])
+        self.assertEqual(sorted(list_view.get_selected_items()), ['one', 'three'])
+        list_view.update_item_source_list(['four'])
+        for item in list_view.get_selected_items():
+            self.assertTrue(item in ('one', 'three', None))
+        self.assertEqual(list_view.get_item_source_list(), ['four'])
+
+    def test_list_view_replace_virtual_source_with_selected_items(self):
+        def get_item(index):
+            return 'item {0}'.format(index)
+        source_ref = weakref.ref(get_item)
+        list_view = SPythonListView(virtual_item_count=100, on_get_item=get_item, on_generate_row=self.generate_row)
+        del get_item
+        list_view.set_item_selection(3)
+        list_view.set_item_selection(5)
+        self.assertEqual(sorted(list_view.get_selected_items()), ['item 3', 'item 5'])
+        list_view.invalidate_virtual_items(0, 10)
+        list_view.update_item_source_list(['one', 'two'])
+        gc.collect()
+        # the view released the source callable, the items still selected in slate must not call it
+        self.assertIsNone(source_ref())
+        for item in list_view.get_selected_items():
+            self.assertTrue(item in ('item 3', 'item 5', None))
+        self.assertEqual(list_view.get_item_source_list(), ['one', 'two'])
+
+    def test_list_view_selection_out_of_range(self):
+        list_view = SPythonListView(list_items_source=['one'], on_generate_row=self.generate_row)
+        self.assertRaises(IndexError, list_view.set_item_selection, 1)
+
+
+if __name__ == '__main__':
+    unittest.main(exit=False)
@@ -2,6 +2,7 @@ import unittest
 import unreal_engine as ue
 from unreal_engine.structs import ColorMaterialInput, Key
 from unreal_engine.structs import StaticMeshSourceModel, MeshBuildSettings
+from unreal_engine.structs import Transform
 
 
 class TestStructs(unittest.TestCase):
@@ -55,5 +56,28 @@ class TestStructs(unittest.TestCase):
 
    
 
+    def test_inline_clone(self):
+        key1 = Key(KeyName='SpaceBar')
+        key2 = key1.clone()
+        key1.KeyName = 'Enter'
+        self.assertEqual(key2.KeyName, 'SpaceBar')
+        self.assertEqual(key1.KeyName, 'Enter')
+
+    def test_inline_reinit(self):
+        material_input = ColorMaterialInput(MaskR=1)
+        material_input.__init__(Key)
+        self.assertTrue('KeyName' in material_input.fields())
+        material_input.__init__(StaticMeshSourceModel)
+        self.assertTrue('BuildSettings' in material_input.fields())
 
+    def test_aligned_struct(self):
+        transforms = [Transform() for i in range(100)]
+        clones = [transform.clone() for transform in transforms]
+        self.assertEqual(transforms[99], clones[99])
 
+    def test_big_struct(self):
+        source_models = [StaticMeshSourceModel() for i in range(100)]
+        source_models[99].BuildSettings.bRecomputeNormals = False
+        source_model2 = source_models[99].clone()
+        del source_models
+        self.assertEqual(source_model2.BuildSettings.bRecomputeNormals, False)
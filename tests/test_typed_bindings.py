@@ -0,0 +1,71 @@
+import unittest
+import unreal_engine as ue
+from unreal_engine.classes import Actor, Character
+from unreal_engine import FVector
+import time
+
+
+def typed_bindings_enabled():
+    return hasattr(ue, 'typed_bindings_stats') and ue.typed_bindings_stats()['enabled']
+
+
+@unittest.skipUnless(typed_bindings_enabled(), 'requires [Python] TypedBindings = True')
+class TestTypedBindings(unittest.TestCase):
+
+    def setUp(self):
+        self.world = ue.get_editor_world()
+        self.random_string = str(int(time.time()))
+
+    def tearDown(self):
+        ue.allow_actor_script_execution_in_editor(False)
+
+    def test_typed_class(self):
+        new_actor = self.world.actor_spawn(Character, FVector(100, 200, 300))
+        self.assertIs(type(new_actor), ue.typed_class(Character))
+        self.assertTrue(isinstance(new_actor, ue.typed_class(Actor)))
+        self.assertTrue(isinstance(new_actor, ue.UObject))
+
+    def test_property_descriptor(self):
+        new_actor = self.world.actor_spawn(Character, FVector(100, 200, 300))
+        descriptor = vars(ue.typed_class(Character))['JumpMaxCount']
+        self.assertEqual(type(descriptor).__name__, 'TypedProperty')
+        new_actor.JumpMaxCount = 3
+        self.assertEqual(new_actor.get_property('JumpMaxCount'), 3)
+        new_actor.set_property('JumpMaxCount', 5)
+        self.assertEqual(new_actor.JumpMaxCount, 5)
+        # inherited properties come from the type of the native ancestor
+        self.assertFalse('bHidden' in vars(ue.typed_class(Character)))
+        self.assertEqual(new_actor.bHidden, new_actor.get_property('bHidden'))
+
+    def test_function_descriptor(self):
+        new_actor = self.world.actor_spawn(Character, FVector(100, 200, 300))
+        descriptor = vars(ue.typed_class(Actor))['K2_GetActorLocation']
+        self.assertEqual(type(descriptor).__name__, 'TypedFunction')
+        self.assertEqual(new_actor.K2_GetActorLocation(), FVector(100, 200, 300))
+        # K2_ functions are aliased without the prefix
+        self.assertEqual(new_actor.GetActorLocation(), FVector(100, 200, 300))
+        new_actor.SetActorHiddenInGame(True)
+        self.assertTrue(new_actor.get_property('bHidden'))
+
+    def test_blueprint_event_override(self):
+        new_blueprint = ue.create_blueprint(Character, '/Game/Tests/Blueprints/TypedTest0_' + self.random_string)
+        uber_page = new_blueprint.UberGraphPages[0]
+        x, y = uber_page.graph_get_good_place_for_new_node()
+        begin_play = uber_page.graph_add_node_event(Actor, 'ReceiveBeginPlay', x, y)
+        x, y = uber_page.graph_get_good_place_for_new_node()
+        node_set_actor_location = uber_page.graph_add_node_call_function(Actor.K2_SetActorLocation, x, y)
+        begin_play.node_find_pin('then').make_link_to(node_set_actor_location.node_find_pin('execute'))
+        node_set_actor_location.node_find_pin('NewLocation').default_value = '17,30,22'
+        ue.compile_blueprint(new_blueprint)
+        new_actor = self.world.actor_spawn(new_blueprint.GeneratedClass)
+        # blueprint classes share the type of their native parent
+        self.assertIs(type(new_actor), ue.typed_class(Character))
+        self.assertEqual(new_actor.get_actor_location(), FVector(0, 0, 0))
+        ue.allow_actor_script_execution_in_editor(True)
+        # the descriptor is bound to AActor::ReceiveBeginPlay, the call must reach the blueprint override
+        new_actor.ReceiveBeginPlay()
+        self.assertEqual(new_actor.get_actor_location(), FVector(17, 30, 22))
+
+
+if __name__ == '__main__':
+    unittest.main(exit=False)
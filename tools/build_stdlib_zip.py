@@ -0,0 +1,42 @@
+import os
+import py_compile
+import sys
+import tempfile
+import zipfile
+
+# builds a zip of precompiled standard library modules for the [Python] StdlibZip setting
+# it must be run with the same python version the plugin is linked to (the .pyc magic number must match)
+#
+# python build_stdlib_zip.py <python Lib directory> <output zip> [optimization level]
+
+EXCLUDED_DIRS = {'site-packages', 'test', 'tests', 'idlelib', 'tkinter', 'turtledemo', 'ensurepip', 'lib2to3', '__pycache__'}
+
+
+def build(lib_dir, output, optimize):
+    count = 0
+    with tempfile.TemporaryDirectory() as tmp_dir, zipfile.ZipFile(output, 'w', zipfile.ZIP_DEFLATED) as archive:
+        cfile = os.path.join(tmp_dir, 'module.pyc')
+        for root, dirs, files in os.walk(lib_dir):
+            dirs[:] = [d for d in dirs if d not in EXCLUDED_DIRS]
+            for filename in files:
+                if not filename.endswith('.py'):
+                    continue
+                source = os.path.join(root, filename)
+                relative = os.path.relpath(source, lib_dir)
+                try:
+                    # unchecked hash pycs do not need the source (nor its timestamp) at import time
+                    py_compile.compile(source, cfile=cfile, dfile=relative, doraise=True, optimize=optimize,
+                                       invalidation_mode=py_compile.PycInvalidationMode.UNCHECKED_HASH)
+                except py_compile.PyCompileError as e:
+                    print('skipping {0}: {1}'.format(relative, e.msg))
+                    continue
+                archive.write(cfile, relative[:-3].replace(os.sep, '/') + '.pyc')
+                count += 1
+    print('{0} modules compiled into {1}'.format(count, output))
+
+
+if __name__ == '__main__':
+    if len(sys.argv) < 3:
+        print('usage: {0} <python Lib directory> <output zip> [optimization level]'.format(sys.argv[0]))
+        sys.exit(1)
+    build(sys.argv[1], sys.argv[2], int(sys.argv[3]) if len(sys.argv) > 3 else -1)
@@ -22,10 +22,6 @@ def is_valid_name(name):
     return VALID_NAME_PATTERN.match(name) is not None and name not in FILTERED_NAMES
 
 
-def filter_names(names):
-    return (name for name in names if is_valid_name(name))
-
-
 def filter_attributes(attributes):
     return {name: value for name, value in attributes.items() if is_valid_name(name)}
 
@@ -96,38 +92,14 @@ def write_object(file, name, value, indent):
         write_variable(file, name, value, indent)
 
 
-def write_ue_classes(file, classes):
-    for class_ in classes:
-        file.write("class {}:\n".format(class_.get_name()))
-
-        attributes_count = 0
-
-        for property_ in filter_names(class_.properties()):
-            file.write("    ")
-            file.write("{}: 'typing.Any'\n".format(property_))
-            attributes_count += 1
-
-        for function_ in filter_names(class_.functions()):
-            file.write("    ")
-            file.write("def {}(*args, **kwargs) -> 'typing.Any': pass\n".format(function_))
-            attributes_count += 1
-
-        if attributes_count == 0:
-            file.write("    ")
-            file.write("pass\n")
-
-        file.write("\n")
-
-
 def generate_pyi_stubs(directory, include_reflection=False):
     """
-    Generates pyi file. Note include_reflection has not been implemented yet.
+    Generates pyi file. With include_reflection the stubs of the native classes are generated
+    too (in unreal_engine/typed.pyi) straight from the reflection data.
     """
-    # include_reflection is still WIP and bit unusable, because:
-    # * the result file is very large and PyCharm by default ignores such files
-    # * it contains some invalid identifiers ('IsInAir?')
-    if include_reflection:
-        raise NotImplementedError
+    # the typed bindings are built only on top of FProperty
+    if include_reflection and not hasattr(ue, 'generate_typed_stubs'):
+        raise NotImplementedError('include_reflection requires the typed bindings (UE5 or UE 4.25+, FProperty)')
 
     package_dir = os.path.join(directory, 'unreal_engine')
     os.mkdir(package_dir)
@@ -143,9 +115,7 @@ def generate_pyi_stubs(directory, include_reflection=False):
             file.write('\n')
 
     if include_reflection:
-        classes_path = os.path.join(package_dir, 'classes.pyi')
-        with open(classes_path, mode='w') as file:
-            write_ue_classes(file, ue.all_classes())
+        ue.generate_typed_stubs(os.path.join(package_dir, 'typed.pyi'))
 
 
 if __name__ == '__main__':